@@ -98,6 +98,19 @@ static const char layout_message[] =
 /// @brief message for execution mode
 static const char api_message[] = "Optional (deprecated). Enable Sync/Async API. Default value is \"async\".";
 
+/// @brief message for the target arrival rate
+static const char qps_message[] =
+    "Optional. Target rate of the inference requests (queries per second). If set, the requests are submitted "
+    "at the scheduled arrival times independently of the completion of the previous ones (open loop), so the "
+    "reported latency includes the time a request waits for an idle infer request. Queueing and execution "
+    "times are reported separately. Default value is 0 (a new request is submitted as soon as an infer request "
+    "is idle). Requires \"-api async\".";
+
+/// @brief message for the arrival process
+static const char arrival_message[] =
+    "Optional. Arrival process of the requests for the -qps option: \"constant\" (fixed interval between the "
+    "requests) or \"poisson\" (exponentially distributed intervals). Default value is \"constant\".";
+
 /// @brief message for #streams for CPU inference
 static const char infer_num_streams_message[] =
     "Optional. Number of streams to use for inference on the CPU or GPU devices "
@@ -205,6 +218,11 @@ static const char report_type_message[] =
     "extends \"average_counters\" report and additionally includes per-layer PM "
     "counters and latency for each executed infer request.";
 
+/// @brief message for latency histogram option
+static const char latency_histogram_message[] =
+    "Optional. Path to a CSV file where to store the latency histogram (values with 3 significant digits and "
+    "the corresponding percentiles) of the total, queueing and execution times.";
+
 // @brief message for report_folder option
 static const char report_folder_message[] = "Optional. Path to a folder where statistics report is stored.";
 
@@ -310,6 +328,12 @@ DEFINE_bool(load_from_file, false, load_from_file_message);
 /// @brief Define execution mode
 DEFINE_string(api, "async", api_message);
 
+/// @brief Target arrival rate of the requests, 0 means closed loop
+DEFINE_double(qps, 0.0, qps_message);
+
+/// @brief Arrival process of the requests for the open loop mode
+DEFINE_string(arrival, "constant", arrival_message);
+
 /// @brief Number of infer requests in parallel
 DEFINE_uint64(nireq, 0, infer_requests_count_message);
 
@@ -355,6 +379,9 @@ DEFINE_bool(use_device_mem, false, use_device_mem_message);
 /// @brief The percentile which will be reported in latency metric
 DEFINE_uint64(latency_percentile, 50, infer_latency_percentile_message);
 
+/// @brief Path to a file where the latency histogram is stored
+DEFINE_string(latency_histogram, "", latency_histogram_message);
+
 /// @brief Enables statistics report collecting
 DEFINE_string(report_type, "", report_type_message);
 
@@ -411,6 +438,8 @@ static void show_usage() {
     std::cout << "    -load_from_file               " << load_from_file_message << std::endl;
     std::cout << "    -api <sync/async>             " << api_message << std::endl;
     std::cout << "    -nireq  <integer>             " << infer_requests_count_message << std::endl;
+    std::cout << "    -qps  <float>                 " << qps_message << std::endl;
+    std::cout << "    -arrival <constant/poisson>   " << arrival_message << std::endl;
     std::cout << "    -nstreams  <integer>          " << infer_num_streams_message << std::endl;
     std::cout << "    -inference_only         " << inference_only_message << std::endl;
     std::cout << "    -infer_precision        " << inference_precision_message << std::endl;
@@ -432,6 +461,7 @@ static void show_usage() {
     std::cout << std::endl;
     std::cout << "Statistics dumping options:" << std::endl;
     std::cout << "    -latency_percentile     " << infer_latency_percentile_message << std::endl;
+    std::cout << "    -latency_histogram      " << latency_histogram_message << std::endl;
     std::cout << "    -report_type  <type>    " << report_type_message << std::endl;
     std::cout << "    -report_folder          " << report_folder_message << std::endl;
     std::cout << "    -json_stats             " << json_stats_message << std::endl;
@@ -23,7 +23,11 @@
 #include "utils.hpp"
 // clang-format on
 
-typedef std::function<void(size_t id, size_t group_id, const double latency, const std::exception_ptr& ptr)>
+typedef std::function<void(size_t id,
+                           size_t group_id,
+                           const double latency,
+                           const double queueing,
+                           const std::exception_ptr& ptr)>
     QueueCallbackFunction;
 
 /// @brief Handles asynchronous callbacks and calculates execution time
@@ -41,7 +45,11 @@ public:
           outputClBuffer() {
         _request.set_callback([&](const std::exception_ptr& ptr) {
             _endTime = Time::now();
-            _callbackQueue(_id, _lat_group_id, get_execution_time_in_milliseconds(), ptr);
+            _callbackQueue(_id,
+                           _lat_group_id,
+                           get_execution_time_in_milliseconds(),
+                           get_queueing_time_in_milliseconds(),
+                           ptr);
         });
     }
 
@@ -58,7 +66,11 @@ public:
         _startTime = Time::now();
         _request.infer();
         _endTime = Time::now();
-        _callbackQueue(_id, _lat_group_id, get_execution_time_in_milliseconds(), nullptr);
+        _callbackQueue(_id,
+                       _lat_group_id,
+                       get_execution_time_in_milliseconds(),
+                       get_queueing_time_in_milliseconds(),
+                       nullptr);
     }
 
     std::vector<ov::ProfilingInfo> get_performance_counts() {
@@ -83,6 +95,21 @@ public:
         return static_cast<double>(execTime.count()) * 0.000001;
     }
 
+    // time between the scheduled arrival of the request and the actual start of its execution,
+    // zero if no arrival time was set (a request is started as soon as it is idle)
+    double get_queueing_time_in_milliseconds() const {
+        if (!_hasArrivalTime) {
+            return 0.0;
+        }
+        auto queueTime = std::chrono::duration_cast<ns>(_startTime - _arrivalTime);
+        return std::max(0.0, static_cast<double>(queueTime.count()) * 0.000001);
+    }
+
+    void set_arrival_time(Time::time_point arrivalTime) {
+        _arrivalTime = arrivalTime;
+        _hasArrivalTime = true;
+    }
+
     void set_latency_group_id(size_t id) {
         _lat_group_id = id;
     }
@@ -98,6 +125,8 @@ private:
     ov::InferRequest _request;
     Time::time_point _startTime;
     Time::time_point _endTime;
+    Time::time_point _arrivalTime;
+    bool _hasArrivalTime = false;
     size_t _id;
     size_t _lat_group_id;
     QueueCallbackFunction _callbackQueue;
@@ -116,7 +145,8 @@ public:
                                                                         std::placeholders::_1,
                                                                         std::placeholders::_2,
                                                                         std::placeholders::_3,
-                                                                        std::placeholders::_4)));
+                                                                        std::placeholders::_4,
+                                                                        std::placeholders::_5)));
             _idleIds.push(id);
         }
         _latency_groups.resize(lat_group_n);
@@ -137,6 +167,8 @@ public:
         _startTime = Time::time_point::max();
         _endTime = Time::time_point::min();
         _latencies.clear();
+        _queueingLatencies.clear();
+        _executionLatencies.clear();
         for (auto& group : _latency_groups) {
             group.clear();
         }
@@ -146,17 +178,23 @@ public:
         return std::chrono::duration_cast<ns>(_endTime - _startTime).count() * 0.000001;
     }
 
+    /// @param latency execution time of the request
+    /// @param queueing time the request waited for the execution after its scheduled arrival,
+    ///        the total latency of the request is the sum of both
     void put_idle_request(size_t id,
                           size_t lat_group_id,
                           const double latency,
+                          const double queueing,
                           const std::exception_ptr& ptr = nullptr) {
         std::unique_lock<std::mutex> lock(_mutex);
         if (ptr) {
             inferenceException = ptr;
         } else {
-            _latencies.push_back(latency);
+            _latencies.push_back(queueing + latency);
+            _queueingLatencies.push_back(queueing);
+            _executionLatencies.push_back(latency);
             if (enable_lat_groups) {
-                _latency_groups[lat_group_id].push_back(latency);
+                _latency_groups[lat_group_id].push_back(queueing + latency);
             }
             _idleIds.push(id);
             _endTime = std::max(Time::now(), _endTime);
@@ -192,6 +230,14 @@ public:
         return _latencies;
     }
 
+    std::vector<double> get_queueing_latencies() {
+        return _queueingLatencies;
+    }
+
+    std::vector<double> get_execution_latencies() {
+        return _executionLatencies;
+    }
+
     std::vector<std::vector<double>> get_latency_groups() {
         return _latency_groups;
     }
@@ -205,6 +251,8 @@ private:
     Time::time_point _startTime;
     Time::time_point _endTime;
     std::vector<double> _latencies;
+    std::vector<double> _queueingLatencies;
+    std::vector<double> _executionLatencies;
     std::vector<std::vector<double>> _latency_groups;
     bool enable_lat_groups;
     std::exception_ptr inferenceException = nullptr;
@@ -0,0 +1,115 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+// clang-format off
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "samples/slog.hpp"
+
+#include "latency_histogram.hpp"
+// clang-format on
+
+namespace {
+// 2^11 linear sub-buckets give the resolution of 1/1024 within every power of 2 range of the values
+constexpr size_t sub_bucket_count = 2048;
+constexpr size_t sub_bucket_half_count = sub_bucket_count / 2;
+constexpr size_t sub_bucket_half_count_bits = 10;
+}  // namespace
+
+size_t LatencyHistogram::index_of(uint64_t value_us) {
+    if (value_us < sub_bucket_count) {
+        return static_cast<size_t>(value_us);
+    }
+    size_t msb = 0;
+    for (uint64_t v = value_us; v > 1; v >>= 1) {
+        ++msb;
+    }
+    // the values of [2^msb, 2^(msb + 1)) range are mapped to the upper half of the sub-buckets with the step of 2^shift
+    const size_t shift = msb - sub_bucket_half_count_bits;
+    return shift * sub_bucket_half_count + static_cast<size_t>(value_us >> shift);
+}
+
+uint64_t LatencyHistogram::lowest_value_at(size_t index) {
+    if (index < sub_bucket_count) {
+        return index;
+    }
+    const size_t shift = index / sub_bucket_half_count - 1;
+    return static_cast<uint64_t>(index - shift * sub_bucket_half_count) << shift;
+}
+
+uint64_t LatencyHistogram::highest_value_at(size_t index) {
+    return lowest_value_at(index + 1) - 1;
+}
+
+void LatencyHistogram::record(double latency_ms) {
+    const auto value_us = static_cast<uint64_t>(std::llround(std::max(0.0, latency_ms) * 1000.0));
+    const size_t index = index_of(value_us);
+    if (index >= _counts.size()) {
+        _counts.resize(index + 1, 0);
+    }
+    ++_counts[index];
+    ++_total;
+}
+
+void LatencyHistogram::record(const std::vector<double>& latencies_ms) {
+    for (const auto latency : latencies_ms) {
+        record(latency);
+    }
+}
+
+double LatencyHistogram::value_at_percentile(double percentile) const {
+    if (_total == 0) {
+        return 0.0;
+    }
+    const double fraction = std::min(100.0, std::max(0.0, percentile)) / 100.0;
+    const auto count_at_percentile =
+        std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(fraction * static_cast<double>(_total))));
+    uint64_t count = 0;
+    for (size_t i = 0; i < _counts.size(); ++i) {
+        count += _counts[i];
+        if (count >= count_at_percentile) {
+            return static_cast<double>(highest_value_at(i)) / 1000.0;
+        }
+    }
+    return static_cast<double>(highest_value_at(_counts.size() - 1)) / 1000.0;
+}
+
+void LatencyHistogram::write_to_stream(std::ostream& stream) const {
+    uint64_t count = 0;
+    for (size_t i = 0; i < _counts.size(); ++i) {
+        if (_counts[i] == 0) {
+            continue;
+        }
+        count += _counts[i];
+        const double fraction = static_cast<double>(count) / static_cast<double>(_total);
+        stream << _name << ";" << static_cast<double>(highest_value_at(i)) / 1000.0 << ";" << fraction << ";"
+               << count << ";";
+        if (count < _total) {
+            stream << 1.0 / (1.0 - fraction);
+        } else {
+            stream << "inf";
+        }
+        stream << "\n";
+    }
+}
+
+void dump_latency_histograms(const std::string& path, const std::vector<LatencyHistogram>& histograms) {
+    std::ofstream out_stream(path);
+    if (!out_stream) {
+        slog::warn << "Cannot create latency histogram file " << path << slog::endl;
+        return;
+    }
+    out_stream << std::fixed << std::setprecision(6);
+    out_stream << "Metric;Value (ms);Percentile;Total count;1/(1-Percentile)\n";
+    for (const auto& histogram : histograms) {
+        histogram.write_to_stream(out_stream);
+    }
+    slog::info << "Latency histogram is stored to " << path << slog::endl;
+}
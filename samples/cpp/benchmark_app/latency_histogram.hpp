@@ -0,0 +1,50 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <utility>
+#include <vector>
+
+/// @brief Latency histogram with the log-linear buckets layout of HdrHistogram.
+/// The values are recorded in microseconds with 3 significant digits (the relative error is below 0.1%), so the
+/// memory footprint depends on the range of the values only, not on the number of the recorded samples.
+class LatencyHistogram {
+public:
+    explicit LatencyHistogram(std::string name = "") : _name(std::move(name)) {}
+
+    void record(double latency_ms);
+    void record(const std::vector<double>& latencies_ms);
+
+    uint64_t total_count() const {
+        return _total;
+    }
+
+    const std::string& name() const {
+        return _name;
+    }
+
+    /// @brief Returns the value in milliseconds which is not exceeded by the given percent of the samples
+    /// @param percentile percent of the samples in range [0, 100]
+    double value_at_percentile(double percentile) const;
+
+    /// @brief Writes "name;value (ms);percentile;total count;1/(1-percentile)" line for every non-empty bucket,
+    /// the same layout as the percentile distribution output of HdrHistogram
+    void write_to_stream(std::ostream& stream) const;
+
+private:
+    static size_t index_of(uint64_t value_us);
+    static uint64_t lowest_value_at(size_t index);
+    static uint64_t highest_value_at(size_t index);
+
+    std::string _name;
+    std::vector<uint64_t> _counts;
+    uint64_t _total = 0;
+};
+
+/// @brief Stores the percentile distributions of the histograms to the CSV file
+void dump_latency_histograms(const std::string& path, const std::vector<LatencyHistogram>& histograms);
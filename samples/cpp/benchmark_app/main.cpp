@@ -6,7 +6,9 @@
 #include <chrono>
 #include <map>
 #include <memory>
+#include <random>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -34,6 +36,7 @@
 #include "benchmark_app.hpp"
 #include "infer_request_wrap.hpp"
 #include "inputs_filling.hpp"
+#include "latency_histogram.hpp"
 #include "remote_tensors_filling.hpp"
 #include "statistics_report.hpp"
 #include "utils.hpp"
@@ -63,6 +66,16 @@ bool parse_and_check_command_line(int argc, char* argv[]) {
     if (FLAGS_api != "async" && FLAGS_api != "sync") {
         throw std::logic_error("Incorrect API. Please set -api option to `sync` or `async` value.");
     }
+    if (FLAGS_qps < 0) {
+        throw std::logic_error("Incorrect target rate. Please set -qps option to a positive value.");
+    }
+    if (FLAGS_qps > 0 && FLAGS_api != "async") {
+        throw std::logic_error("-qps option is supported for the asynchronous API only.");
+    }
+    if (FLAGS_arrival != "constant" && FLAGS_arrival != "poisson") {
+        throw std::logic_error("Incorrect arrival process. Please set -arrival option to `constant` or `poisson` "
+                               "value.");
+    }
     if (!FLAGS_hint.empty() && FLAGS_hint != "throughput" && FLAGS_hint != "tput" && FLAGS_hint != "latency" &&
         FLAGS_hint != "cumulative_throughput" && FLAGS_hint != "ctput" && FLAGS_hint != "none") {
         throw std::logic_error("Incorrect performance hint. Please set -hint option to"
@@ -941,6 +954,11 @@ int main(int argc, char* argv[]) {
                 statistics->add_parameters(StatisticsReport::Category::RUNTIME_CONFIG,
                                            {StatisticsVariant(ss.str(), dev_name + "_streams_num", nstreams.second)});
             }
+            if (FLAGS_qps > 0) {
+                statistics->add_parameters(StatisticsReport::Category::RUNTIME_CONFIG,
+                                           {StatisticsVariant("target QPS", "target_qps", FLAGS_qps),
+                                            StatisticsVariant("arrival process", "arrival", FLAGS_arrival)});
+            }
         }
 
         // ----------------- 9. Creating infer requests and filling input blobs
@@ -1013,6 +1031,9 @@ int main(int argc, char* argv[]) {
                 ss << " using " << device_ss.str();
             }
         }
+        if (FLAGS_qps > 0) {
+            ss << ", " << FLAGS_arrival << " arrivals at " << double_to_string(FLAGS_qps) << " QPS";
+        }
         ss << ", limits: ";
         if (duration_seconds > 0) {
             ss << get_duration_in_milliseconds(duration_seconds) << " ms duration";
@@ -1113,12 +1134,26 @@ int main(int argc, char* argv[]) {
         auto startTime = Time::now();
         auto execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
 
+        // open loop: the requests arrive on the schedule which does not depend on the completion of the previous
+        // ones, a request that finds no idle infer request is queued and the waiting time is accounted in its latency
+        const bool openLoop = FLAGS_qps > 0;
+        std::mt19937 arrivalGenerator;
+        std::exponential_distribution<double> arrivalIntervals(openLoop ? FLAGS_qps : 1.0);
+        auto nextArrivalTime = startTime;
+        auto next_arrival_interval = [&]() {
+            const double seconds = FLAGS_arrival == "poisson" ? arrivalIntervals(arrivalGenerator) : 1.0 / FLAGS_qps;
+            return std::chrono::duration_cast<Time::duration>(std::chrono::duration<double>(seconds));
+        };
+
         /** Start inference & calculate performance **/
         /** to align number if iterations to guarantee that last infer requests are
          * executed in the same conditions **/
         while ((niter != 0LL && iteration < niter) ||
                (duration_nanoseconds != 0LL && (uint64_t)execTime < duration_nanoseconds) ||
-               (FLAGS_api == "async" && iteration % nireq != 0)) {
+               (FLAGS_api == "async" && !openLoop && iteration % nireq != 0)) {
+            if (openLoop) {
+                std::this_thread::sleep_until(nextArrivalTime);
+            }
             inferRequest = inferRequestsQueue.get_idle_request();
             if (!inferRequest) {
                 OPENVINO_THROW("No idle Infer Requests!");
@@ -1150,6 +1185,11 @@ int main(int argc, char* argv[]) {
                 }
             }
 
+            if (openLoop) {
+                inferRequest->set_arrival_time(nextArrivalTime);
+                nextArrivalTime += next_arrival_interval();
+            }
+
             if (FLAGS_api == "sync") {
                 inferRequest->infer();
             } else {
@@ -1165,6 +1205,18 @@ int main(int argc, char* argv[]) {
         inferRequestsQueue.wait_all();
 
         LatencyMetrics generalLatency(inferRequestsQueue.get_latencies(), "", FLAGS_latency_percentile);
+        std::vector<LatencyHistogram> latencyHistograms = {LatencyHistogram("total")};
+        latencyHistograms[0].record(inferRequestsQueue.get_latencies());
+        if (openLoop) {
+            latencyHistograms.emplace_back("queueing");
+            latencyHistograms.back().record(inferRequestsQueue.get_queueing_latencies());
+            latencyHistograms.emplace_back("execution");
+            latencyHistograms.back().record(inferRequestsQueue.get_execution_latencies());
+        }
+        const std::vector<std::pair<std::string, double>> tailPercentiles = {{"p50", 50.0},
+                                                                             {"p90", 90.0},
+                                                                             {"p99", 99.0},
+                                                                             {"p99.9", 99.9}};
         std::vector<LatencyMetrics> groupLatencies = {};
         if (FLAGS_pcseq && app_inputs_info.size() > 1) {
             const auto& lat_groups = inferRequestsQueue.get_latency_groups();
@@ -1203,6 +1255,15 @@ int main(int argc, char* argv[]) {
                      StatisticsVariant("Average latency (ms)", "latency_avg", generalLatency.avg),
                      StatisticsVariant("Min latency (ms)", "latency_min", generalLatency.min),
                      StatisticsVariant("Max latency (ms)", "latency_max", generalLatency.max)});
+                for (const auto& histogram : latencyHistograms) {
+                    for (const auto& percentile : tailPercentiles) {
+                        statistics->add_parameters(
+                            StatisticsReport::Category::EXECUTION_RESULTS,
+                            {StatisticsVariant(percentile.first + " " + histogram.name() + " latency (ms)",
+                                               "latency_" + histogram.name() + "_" + percentile.first,
+                                               histogram.value_at_percentile(percentile.second))});
+                    }
+                }
 
                 if (FLAGS_pcseq && app_inputs_info.size() > 1) {
                     for (size_t i = 0; i < groupLatencies.size(); ++i) {
@@ -1219,6 +1280,10 @@ int main(int argc, char* argv[]) {
         // -------------------------------------------------------------
         next_step();
 
+        if (!FLAGS_latency_histogram.empty()) {
+            dump_latency_histograms(FLAGS_latency_histogram, latencyHistograms);
+        }
+
         if (!FLAGS_dump_config.empty()) {
             dump_config(FLAGS_dump_config, config);
             slog::info << "OpenVINO Runtime configuration settings were dumped to " << FLAGS_dump_config << slog::endl;
@@ -1271,6 +1336,17 @@ int main(int argc, char* argv[]) {
         if (device_name.find("MULTI") == std::string::npos) {
             slog::info << "Latency:" << slog::endl;
             generalLatency.write_to_slog();
+            for (const auto& histogram : latencyHistograms) {
+                if (openLoop) {
+                    slog::info << "Latency (" << histogram.name() << "):" << slog::endl;
+                }
+                std::stringstream percentiles;
+                for (const auto& percentile : tailPercentiles) {
+                    percentiles << (percentiles.str().empty() ? "" : ", ") << percentile.first << " "
+                                << double_to_string(histogram.value_at_percentile(percentile.second));
+                }
+                slog::info << "   Percentiles:      " << percentiles.str() << " ms" << slog::endl;
+            }
 
             if (FLAGS_pcseq && app_inputs_info.size() > 1) {
                 slog::info << "Latency for each data shape group:" << slog::endl;
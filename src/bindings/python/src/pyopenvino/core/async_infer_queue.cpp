@@ -7,13 +7,17 @@
 #include <pybind11/functional.h>
 #include <pybind11/stl.h>
 
+#include <algorithm>
+#include <atomic>
 #include <chrono>
 #include <condition_variable>
+#include <memory>
 #include <mutex>
 #include <queue>
 #include <string>
 #include <vector>
 
+#include "openvino/runtime/threading/thread_safe_containers.hpp"
 #include "pyopenvino/core/common.hpp"
 #include "pyopenvino/core/infer_request.hpp"
 
@@ -36,6 +40,8 @@ public:
             m_user_ids.push_back(py::none());
             m_idle_handles.push(handle);
         }
+        // every request is in the ring at most once, so the push never fails
+        m_completed.reset(new ov::threading::LockFreeBoundedQueue<size_t>(jobs));
 
         this->set_default_callbacks();
     }
@@ -90,6 +96,7 @@ public:
 
             m_requests[handle].m_request.set_callback([this, handle /* ... */](std::exception_ptr exception_ptr) {
                 *m_requests[handle].m_end_time = Time::now();
+                m_running--;
                 {
                     // acquire the mutex to access m_idle_handles
                     std::lock_guard<std::mutex> lock(m_mutex);
@@ -114,6 +121,7 @@ public:
         for (size_t handle = 0; handle < m_requests.size(); handle++) {
             m_requests[handle].m_request.set_callback([this, f_callback, handle](std::exception_ptr exception_ptr) {
                 *m_requests[handle].m_end_time = Time::now();
+                m_running--;
                 if (exception_ptr == nullptr) {
                     // Acquire GIL, execute Python function
                     py::gil_scoped_acquire acquire;
@@ -151,6 +159,103 @@ public:
         }
     }
 
+    void set_batch_callbacks(py::function f_callback, size_t batch_size) {
+        if (batch_size == 0) {
+            OPENVINO_THROW("AsyncInferQueue batch size must be greater than zero.");
+        }
+        // the requests of the incomplete batch are not returned to the pool, so the batch can't be larger than the pool
+        m_batch_size = std::min(batch_size, m_requests.size());
+        m_batch_callback = f_callback;
+        for (size_t handle = 0; handle < m_requests.size(); handle++) {
+            m_requests[handle].m_request.set_callback([this, handle](std::exception_ptr exception_ptr) {
+                *m_requests[handle].m_end_time = Time::now();
+                if (exception_ptr == nullptr) {
+                    // the handle is published before the counters are updated, so the thread observing the full
+                    // batch (or the last running request) is guaranteed to find all the completions in the ring
+                    m_completed->try_push(size_t(handle));
+                    m_pending++;
+                }
+                const bool drained = --m_running == 0;
+                if (m_pending >= static_cast<int64_t>(m_batch_size) || drained) {
+                    deliver_completed();
+                }
+
+                if (exception_ptr) {
+                    {
+                        // acquire the mutex to access m_idle_handles
+                        std::lock_guard<std::mutex> lock(m_mutex);
+                        m_idle_handles.push(handle);
+                    }
+                    m_cv.notify_one();
+                    try {
+                        std::rethrow_exception(exception_ptr);
+                    } catch (const std::exception& e) {
+                        OPENVINO_THROW(e.what());
+                    }
+                }
+            });
+        }
+    }
+
+    // Delivers the completed requests to the batch callback, one GIL acquisition per batch.
+    // The outputs are passed as numpy views of the request tensors, the requests are returned to the pool
+    // only after the callback is finished, so the views stay valid while the callback runs.
+    void deliver_completed() {
+        std::vector<size_t> handles;
+        handles.reserve(m_batch_size);
+        while (true) {
+            handles.clear();
+            size_t handle = 0;
+            while (handles.size() < m_batch_size && m_completed->try_pop(handle)) {
+                handles.push_back(handle);
+            }
+            if (handles.empty()) {
+                return;
+            }
+            m_pending -= static_cast<int64_t>(handles.size());
+            {
+                py::gil_scoped_acquire acquire;
+                try {
+                    py::list results;
+                    for (auto completed_handle : handles) {
+                        auto& request = m_requests[completed_handle];
+                        results.append(py::make_tuple(py::cast(request, py::return_value_policy::reference),
+                                                      m_user_ids[completed_handle],
+                                                      Common::outputs_to_dict(request, true)));
+                    }
+                    m_batch_callback(results);
+                } catch (const py::error_already_set& py_error) {
+                    assert(py_error.type());
+                    // acquire the mutex to access m_errors
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    m_errors.push(py_error);
+                }
+            }
+            {
+                // acquire the mutex to access m_idle_handles
+                std::lock_guard<std::mutex> lock(m_mutex);
+                for (auto idle_handle : handles) {
+                    m_idle_handles.push(idle_handle);
+                }
+            }
+            // Notify locks in getIdleRequestId()
+            m_cv.notify_all();
+            // keep delivering while there is a full batch or nothing else is going to complete
+            if (m_pending < static_cast<int64_t>(m_batch_size) && m_running != 0) {
+                return;
+            }
+        }
+    }
+
+    void start_request(size_t handle) {
+        // Now GIL can be released - we are NOT working with Python objects in this block
+        py::gil_scoped_release release;
+        *m_requests[handle].m_start_time = Time::now();
+        m_running++;
+        // Start InferRequest in asynchronus mode
+        m_requests[handle].m_request.start_async();
+    }
+
     // AsyncInferQueue is the owner of all requests. When AsyncInferQueue is destroyed,
     // all of requests are destroyed as well.
     std::vector<InferRequestWrapper> m_requests;
@@ -159,6 +264,12 @@ public:
     std::mutex m_mutex;
     std::condition_variable m_cv;
     std::queue<py::error_already_set> m_errors;
+    // batched callback mode: completed requests are collected in the lock-free ring and handed over to Python in batches
+    std::unique_ptr<ov::threading::LockFreeBoundedQueue<size_t>> m_completed;
+    std::atomic<int64_t> m_pending{0};
+    std::atomic<size_t> m_running{0};
+    size_t m_batch_size = 1;
+    py::function m_batch_callback;
 };
 
 void regclass_AsyncInferQueue(py::module m) {
@@ -195,13 +306,7 @@ void regclass_AsyncInferQueue(py::module m) {
             self.m_user_ids[handle] = userdata;
             // Update inputs if there are any
             self.m_requests[handle].m_request.set_input_tensor(inputs);
-            // Now GIL can be released - we are NOT working with Python objects in this block
-            {
-                py::gil_scoped_release release;
-                *self.m_requests[handle].m_start_time = Time::now();
-                // Start InferRequest in asynchronus mode
-                self.m_requests[handle].m_request.start_async();
-            }
+            self.start_request(handle);
         },
         py::arg("inputs"),
         py::arg("userdata"),
@@ -241,13 +346,7 @@ void regclass_AsyncInferQueue(py::module m) {
             self.m_user_ids[handle] = userdata;
             // Update inputs if there are any
             Common::set_request_tensors(self.m_requests[handle].m_request, inputs);
-            // Now GIL can be released - we are NOT working with Python objects in this block
-            {
-                py::gil_scoped_release release;
-                *self.m_requests[handle].m_start_time = Time::now();
-                // Start InferRequest in asynchronus mode
-                self.m_requests[handle].m_request.start_async();
-            }
+            self.start_request(handle);
         },
         py::arg("inputs"),
         py::arg("userdata"),
@@ -318,6 +417,36 @@ void regclass_AsyncInferQueue(py::module m) {
             :type callback: function
         )");
 
+    cls.def("set_batch_callback",
+            &AsyncInferQueue::set_batch_callbacks,
+            py::arg("callback"),
+            py::arg("batch_size"),
+            R"(
+            Sets callback which is called once per a batch of completed InferRequests
+            instead of once per request, so the GIL is acquired once per batch.
+            The callback is called when `batch_size` requests are completed or when
+            there are no running requests left. `batch_size` is limited by the pool size.
+
+            The only argument of the callback is the list of tuples
+            (request, userdata, results), where results is the dictionary of
+            numpy arrays which share memory with the output tensors of the request.
+            The arrays are valid only until the callback returns, since the request
+            is returned to the pool afterwards: copy the data to keep it.
+
+            .. code-block:: python
+
+                def f(completed):
+                    for request, userdata, results in completed:
+                        outputs[userdata] = next(iter(results.values())).copy()
+
+                async_infer_queue.set_batch_callback(f, 16)
+
+            :param callback: Any Python defined function that matches callback's requirements.
+            :type callback: function
+            :param batch_size: Maximum number of requests passed to the single callback call.
+            :type batch_size: int
+        )");
+
     cls.def(
         "__len__",
         [](AsyncInferQueue& self) {
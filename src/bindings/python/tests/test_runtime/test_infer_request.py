@@ -513,6 +513,35 @@ def test_infer_queue(device, share_inputs):
     assert all(job["latency"] > 0 for job in jobs_done)
 
 
+@pytest.mark.parametrize("batch_size", [1, 3, 16])
+def test_infer_queue_batch_callback(device, batch_size):
+    jobs = 20
+    num_request = 4
+    core = Core()
+    param = ops.parameter([10], np.float32)
+    model = Model(ops.relu(param), [param])
+    compiled_model = core.compile_model(model, device)
+    infer_queue = AsyncInferQueue(compiled_model, num_request)
+    results = {}
+    batch_sizes = []
+
+    def callback(completed):
+        batch_sizes.append(len(completed))
+        for request, job_id, outputs in completed:
+            assert request.latency > 0
+            results[job_id] = next(iter(outputs.values())).copy()
+
+    infer_queue.set_batch_callback(callback, batch_size)
+    data = [np.random.normal(size=[10]).astype(np.float32) for _ in range(jobs)]
+    for i in range(jobs):
+        infer_queue.start_async({0: data[i]}, i)
+    infer_queue.wait_all()
+
+    assert sorted(results.keys()) == list(range(jobs))
+    assert all(np.array_equal(results[i], np.maximum(data[i], 0)) for i in range(jobs))
+    assert max(batch_sizes) <= min(batch_size, num_request)
+
+
 def test_infer_queue_iteration(device):
     core = Core()
     param = ops.parameter([10])
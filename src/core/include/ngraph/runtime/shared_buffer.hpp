@@ -37,6 +37,11 @@ public:
         m_byte_size = 0;
     }
 
+    /// \brief Returns the object which owns the shared memory.
+    const T& get_shared_object() const {
+        return _shared_object;
+    }
+
 private:
     T _shared_object;
 };
@@ -13,7 +13,8 @@ namespace pass {
 /**
  * @brief Constant folding iterates over the function and tries to evaluate nodes
  *        with constant inputs. Such nodes are then replaced with new Constants containing
- *        the result of a folded operation.
+ *        the result of a folded operation. The independent nodes with constant inputs
+ *        are evaluated in parallel.
  * @ingroup ov_pass_cpp_api
  */
 class OPENVINO_API ConstantFolding : public ModelPass {
@@ -26,6 +27,12 @@ protected:
     /// \brief Folds pre-calculated output tensor values to constants in case lower and
     /// upper estimations are equal. Traverses graph backwards starting from the results.
     bool pre_calculated_values_folding(const std::shared_ptr<ov::Model>& model);
+    /// \brief Replaces the outputs of the folded node with the replacements and propagates the names and runtime info.
+    bool replace_with_folded(const std::shared_ptr<Node>& node, const OutputVector& replacements);
+    /// \brief Folds the nodes which have all the inputs Constant wave by wave: the nodes of a wave are evaluated
+    /// in parallel, their consumers which get all the inputs Constant make the next wave.
+    /// \param revalidate  validate the nodes of the first wave before folding
+    bool parallel_folding(const std::shared_ptr<ov::Model>& model, bool revalidate);
 };
 
 /**
@@ -0,0 +1,103 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "openvino/core/core_visibility.hpp"
+#include "openvino/core/model.hpp"
+
+namespace ov {
+namespace pass {
+
+/// \brief Execution statistics of a transformation pass collected by PassProfiler.
+///
+/// The entries of the passes executed by pass::Manager are kept in the execution order, the passes
+/// run by a nested pass::Manager and the matchers of a GraphRewrite are the children of the enclosing
+/// pass entry. The matchers of a GraphRewrite execution are aggregated into one entry per matcher.
+struct PassProfile {
+    std::string name;
+    /// \brief Number of executions of the pass. For the matchers it is the number of nodes the matcher was applied to.
+    size_t runs = 0;
+    /// \brief Number of executions which changed the model
+    size_t applied = 0;
+    /// \brief Wall time of the executions including the children, in milliseconds
+    double time_ms = 0.0;
+    /// \brief Change of the number of the model nodes, it is not measured for the matchers
+    int64_t node_count_delta = 0;
+    /// \brief Process peak resident memory after the execution, in kilobytes
+    size_t peak_memory_kb = 0;
+    /// \brief Growth of the process peak resident memory during the execution, in kilobytes
+    size_t peak_memory_delta_kb = 0;
+    std::vector<PassProfile> children;
+};
+
+/// \brief Prints the profile as an indented tree, one line per entry
+OPENVINO_API std::ostream& operator<<(std::ostream& os, const PassProfile& profile);
+
+/// \brief Collects PassProfile of all the pass::Manager runs made on the current thread while the profiler
+/// is alive. Profilers may be nested, the innermost one collects the statistics.
+///
+///     pass::PassProfiler profiler;
+///     manager.run_passes(model);
+///     std::cout << profiler.get_profile();
+///
+/// Counting the model nodes requires the topological sort of the model after each pass, so the
+/// profiling noticeably slows down the transformations of the big models. The reported pass time
+/// does not include this overhead.
+class OPENVINO_API PassProfiler {
+public:
+    PassProfiler();
+    ~PassProfiler();
+
+    PassProfiler(const PassProfiler&) = delete;
+    PassProfiler& operator=(const PassProfiler&) = delete;
+
+    /// \brief Returns the collected statistics, the top level passes are the children of the returned entry,
+    /// which holds the totals
+    const PassProfile& get_profile() const {
+        return m_root;
+    }
+
+    /// \brief Returns the profiler collecting the statistics on the current thread or nullptr
+    static PassProfiler* get_active();
+
+    /// \brief Opens the entry of the pass execution, the entries opened until the matching end_pass() are
+    /// its children
+    void begin_pass(const std::string& name, const std::shared_ptr<const Model>& model);
+
+    /// \brief Closes the last opened entry
+    /// \param applied true if the pass changed the model
+    /// \param discard drop the entry, e.g. if the pass was skipped
+    void end_pass(const std::shared_ptr<const Model>& model, bool applied, bool discard = false);
+
+    /// \brief Adds the aggregated statistics of a matcher to the last opened entry, the statistics of the
+    /// same matcher are summed up
+    void add_matcher_profile(const PassProfile& profile);
+
+private:
+    struct OpenPass {
+        PassProfile profile;
+        std::chrono::steady_clock::time_point start;
+        std::chrono::steady_clock::duration overhead_at_start;
+        int64_t node_count = 0;
+    };
+
+    PassProfile& current();
+
+    PassProfile m_root;
+    // time spent by the profiler itself, it is excluded from the time of the passes
+    std::chrono::steady_clock::duration m_overhead{0};
+    std::vector<OpenPass> m_open_passes;
+    PassProfiler* m_previous = nullptr;
+};
+
+}  // namespace pass
+}  // namespace ov
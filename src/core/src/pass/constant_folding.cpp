@@ -4,7 +4,12 @@
 
 #include "openvino/pass/constant_folding.hpp"
 
+#include <algorithm>
+#include <exception>
+#include <unordered_map>
+
 #include "openvino/cc/pass/itt.hpp"
+#include "openvino/core/parallel.hpp"
 #include "openvino/core/rt_info.hpp"
 #include "openvino/core/validation_util.hpp"
 #include "openvino/op/constant.hpp"
@@ -48,12 +53,40 @@ const auto friendly_name_from = [](const ov::Node& node, const size_t output_cou
     }
 };
 
+/**
+ * \brief Check if node can be folded together with the other nodes of its wave.
+ *
+ * Only the nodes which have all the inputs Constant and no internal subgraphs are evaluated in parallel,
+ * the rest is left to the sequential folding.
+ *
+ * \param node  Node to check.
+ *
+ * \return true if node can be folded in parallel otherwise false.
+ */
+const auto is_parallel_folding_candidate = [](const std::shared_ptr<ov::Node>& node) {
+    if (node->get_input_size() == 0 || ov::op::util::is_constant(node) || ov::op::util::is_output(node) ||
+        ov::op::util::is_sink(node) || ov::is_type<ov::op::util::ReadValueBase>(node) ||
+        ov::is_type<ov::op::util::MultiSubGraphOp>(node) || ov::pass::constant_folding_is_disabled(node)) {
+        return false;
+    }
+    for (const auto& input : node->input_values()) {
+        if (!ov::op::util::is_constant(input.get_node())) {
+            return false;
+        }
+    }
+    return true;
+};
+
 bool ov::pass::ConstantFolding::run_on_model(const std::shared_ptr<ov::Model>& model) {
     RUN_ON_MODEL_SCOPE(ConstantFolding);
 
     bool rewritten = pre_calculated_values_folding(model);
+    rewritten |= parallel_folding(model, rewritten);
 
-    for (const auto& node : model->get_ordered_ops()) {
+    auto ops = model->get_ordered_ops();
+    for (auto& op : ops) {
+        // the folded nodes are released right away together with the intermediate constants which are not used anymore
+        const auto node = std::move(op);
         if (rewritten) {
             node->validate_and_infer_types();
         }
@@ -61,29 +94,7 @@ bool ov::pass::ConstantFolding::run_on_model(const std::shared_ptr<ov::Model>& m
         OutputVector replacements(node->get_output_size());
 
         if (node->constant_fold(replacements, node->input_values())) {
-            OPENVINO_ASSERT(!constant_folding_is_disabled(node),
-                            "Node folded but constant folding disabled. Check constant_fold implementation for ",
-                            node);
-            OPENVINO_ASSERT(replacements.size() == node->get_output_size(),
-                            "constant_fold_default returned incorrect number of replacements for ",
-                            node);
-
-            for (size_t i = 0; i < replacements.size(); ++i) {
-                auto node_output = node->output(i);
-                auto replacement = replacements.at(i);
-                if (replacement.get_node_shared_ptr() && (node_output != replacement)) {
-                    replacement.get_node()->set_friendly_name(friendly_name_from(*node, replacements.size(), i));
-
-                    node_output.replace(replacement);
-                    // Copy runtime info from source nodes
-                    // when it was not propogated during pre-calculation
-                    copy_runtime_info_from_input_values(node);
-                    // Propagate runtime info attributes to replacement
-                    copy_runtime_info(node, replacement.get_node_shared_ptr());
-
-                    rewritten = true;
-                }
-            }
+            rewritten |= replace_with_folded(node, replacements);
         } else {
             // recursively constant fold operators containing subgraphs (ie: TensorIterator, Loop)
             if (auto sub_graph_node = std::dynamic_pointer_cast<ov::op::util::MultiSubGraphOp>(node)) {
@@ -98,6 +109,109 @@ bool ov::pass::ConstantFolding::run_on_model(const std::shared_ptr<ov::Model>& m
     return rewritten;
 }
 
+bool ov::pass::ConstantFolding::replace_with_folded(const std::shared_ptr<Node>& node,
+                                                    const OutputVector& replacements) {
+    OPENVINO_ASSERT(!constant_folding_is_disabled(node),
+                    "Node folded but constant folding disabled. Check constant_fold implementation for ",
+                    node);
+    OPENVINO_ASSERT(replacements.size() == node->get_output_size(),
+                    "constant_fold_default returned incorrect number of replacements for ",
+                    node);
+
+    bool rewritten = false;
+    for (size_t i = 0; i < replacements.size(); ++i) {
+        auto node_output = node->output(i);
+        auto replacement = replacements.at(i);
+        if (replacement.get_node_shared_ptr() && (node_output != replacement)) {
+            replacement.get_node()->set_friendly_name(friendly_name_from(*node, replacements.size(), i));
+
+            node_output.replace(replacement);
+            // Copy runtime info from source nodes
+            // when it was not propogated during pre-calculation
+            copy_runtime_info_from_input_values(node);
+            // Propagate runtime info attributes to replacement
+            copy_runtime_info(node, replacement.get_node_shared_ptr());
+
+            rewritten = true;
+        }
+    }
+    return rewritten;
+}
+
+bool ov::pass::ConstantFolding::parallel_folding(const std::shared_ptr<ov::Model>& model, bool revalidate) {
+    auto ops = model->get_ordered_ops();
+    std::unordered_map<const Node*, size_t> order;
+    std::vector<char> scheduled(ops.size(), 0);
+    std::vector<size_t> wave;
+    for (size_t i = 0; i < ops.size(); ++i) {
+        order.emplace(ops[i].get(), i);
+        if (is_parallel_folding_candidate(ops[i])) {
+            wave.push_back(i);
+            scheduled[i] = 1;
+        }
+    }
+
+    bool rewritten = false;
+    while (!wave.empty()) {
+        if (revalidate) {
+            for (const auto idx : wave) {
+                ops[idx]->validate_and_infer_types();
+            }
+        }
+
+        // the nodes of a wave depend on the Constants only, so they are evaluated independently and the model is
+        // modified afterwards in the topological order, exactly as the sequential folding does it
+        std::vector<OutputVector> replacements(wave.size());
+        std::vector<char> folded(wave.size(), 0);
+        std::vector<std::exception_ptr> errors(wave.size());
+        ov::parallel_for(wave.size(), [&](size_t i) {
+            const auto& node = ops[wave[i]];
+            replacements[i].resize(node->get_output_size());
+            try {
+                folded[i] = node->constant_fold(replacements[i], node->input_values());
+            } catch (...) {
+                errors[i] = std::current_exception();
+            }
+        });
+
+        std::vector<size_t> next_wave;
+        for (size_t i = 0; i < wave.size(); ++i) {
+            if (errors[i]) {
+                std::rethrow_exception(errors[i]);
+            }
+            if (!folded[i]) {
+                continue;
+            }
+            auto& node = ops[wave[i]];
+            if (!replace_with_folded(node, replacements[i])) {
+                continue;
+            }
+            rewritten = true;
+            for (const auto& replacement : replacements[i]) {
+                for (const auto& input : replacement.get_target_inputs()) {
+                    const auto it = order.find(input.get_node());
+                    if (it == order.end() || scheduled[it->second] || !is_parallel_folding_candidate(ops[it->second])) {
+                        continue;
+                    }
+                    next_wave.push_back(it->second);
+                    scheduled[it->second] = 1;
+                }
+            }
+            // the node is out of the model now, releasing it frees the inputs which are not used anymore,
+            // so large intermediate constants do not live until the end of the pass
+            order.erase(node.get());
+            node.reset();
+        }
+        replacements.clear();
+
+        std::sort(next_wave.begin(), next_wave.end());
+        wave = std::move(next_wave);
+        // the inputs of the next wave were replaced, so their output types have to be refreshed before folding
+        revalidate = true;
+    }
+    return rewritten;
+}
+
 void ov::pass::ConstantFolding::copy_runtime_info_from_input_values(const std::shared_ptr<Node>& node) {
     if (is_type<op::util::ShapeOfBase>(node)) {
         // Don't propogate names of ShapeOf source node since it is not fused itself
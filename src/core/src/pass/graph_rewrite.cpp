@@ -5,6 +5,7 @@
 #include "openvino/pass/graph_rewrite.hpp"
 
 #include <algorithm>
+#include <chrono>
 #include <deque>
 #include <iostream>
 #include <regex>
@@ -14,6 +15,7 @@
 
 #include "openvino/cc/pass/itt.hpp"
 #include "openvino/op/util/multi_subgraph_base.hpp"
+#include "openvino/pass/pass_profiler.hpp"
 #include "openvino/pass/pattern/op/wrap_type.hpp"
 #include "openvino/util/log.hpp"
 #include "perf_counters.hpp"
@@ -134,10 +136,15 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
         // including ones triggered by parent type info.
     }
 
+    // per matcher statistics, they are collected only if the profiling is enabled
+    auto profiler = PassProfiler::get_active();
+    std::vector<PassProfile> matcher_profiles(profiler ? m_matchers.size() : 0);
+
     // This lambda preforms execution of particular MatcherPass on given node.
     // It automatically handles nodes registered by MatcherPass during transformation and set
     // transformation callback.
-    auto run_matcher_pass = [&](std::shared_ptr<MatcherPass> m_pass, std::shared_ptr<Node> node) -> bool {
+    auto run_matcher_pass = [&](size_t matcher_index, std::shared_ptr<Node> node) -> bool {
+        const auto& m_pass = m_matchers[matcher_index];
         // Keep this property check for backward compatibility. In future transformation property
         // will be deprecated and removed.
         if (m_pass->get_property(PassProperty::REQUIRE_STATIC_SHAPE) && f->is_dynamic()) {
@@ -150,7 +157,18 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
 
         // Apply MatcherPass. In case if it returns true no other MatcherPasses will apply
         // to this node
-        bool status = m_pass->apply(node);
+        bool status = false;
+        if (profiler) {
+            const auto start = std::chrono::steady_clock::now();
+            status = m_pass->apply(node);
+            auto& profile = matcher_profiles[matcher_index];
+            profile.time_ms +=
+                std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+            profile.runs++;
+            profile.applied += status ? 1 : 0;
+        } else {
+            status = m_pass->apply(node);
+        }
 
         // In case if MatcherPass registered nodes they will be added to the beginning of execution
         // queue
@@ -215,7 +233,7 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
             // fast processing at the next time when node with the same type will be processed
 
             for (size_t matcher_index : matcher_passes_to_run) {
-                if (run_matcher_pass(m_matchers[matcher_index], node)) {
+                if (run_matcher_pass(matcher_index, node)) {
                     rewritten = true;
                     break;
                 }
@@ -223,18 +241,26 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
         }
         // Otherwise we use default algorithm that iterates over all registered matcher passes
         else {
-            for (auto& m_pass : m_matchers) {
+            for (size_t matcher_index = 0; matcher_index < m_matchers.size(); ++matcher_index) {
                 // Skip passes that are disabled
-                if (pass_config->is_disabled(m_pass->get_type_info()))
+                if (pass_config->is_disabled(m_matchers[matcher_index]->get_type_info()))
                     continue;
 
-                if (run_matcher_pass(m_pass, node)) {
+                if (run_matcher_pass(matcher_index, node)) {
                     rewritten = true;
                     break;
                 }
             }
         }
     }
+
+    for (size_t matcher_index = 0; matcher_index < matcher_profiles.size(); ++matcher_index) {
+        auto& profile = matcher_profiles[matcher_index];
+        if (profile.runs != 0) {
+            profile.name = m_matchers[matcher_index]->get_name();
+            profiler->add_matcher_profile(profile);
+        }
+    }
     return rewritten;
 }
 
@@ -15,6 +15,7 @@
 #include "ngraph/pass/pass.hpp"
 #include "ngraph/util.hpp"
 #include "openvino/pass/graph_rewrite.hpp"
+#include "openvino/pass/pass_profiler.hpp"
 #include "openvino/pass/visualize_tree.hpp"
 #include "openvino/util/env_util.hpp"
 #include "openvino/util/log.hpp"
@@ -42,6 +43,37 @@ bool getenv_visualize_tracing() {
     return ov::util::getenv_bool("NGRAPH_ENABLE_VISUALIZE_TRACING") ||
            ov::util::getenv_bool("OV_ENABLE_VISUALIZE_TRACING");
 }
+
+// Reports the pass execution to the active PassProfiler of the thread, if any
+class PassProfileScope {
+public:
+    PassProfileScope(const std::string& name, const std::shared_ptr<ov::Model>& model)
+        : m_profiler(ov::pass::PassProfiler::get_active()),
+          m_model(model) {
+        if (m_profiler)
+            m_profiler->begin_pass(name, m_model);
+    }
+
+    ~PassProfileScope() {
+        if (m_profiler)
+            m_profiler->end_pass(m_model, m_applied, m_discard);
+    }
+
+    void set_applied(bool applied) {
+        m_applied = applied;
+    }
+
+    // the pass was not executed
+    void discard() {
+        m_discard = true;
+    }
+
+private:
+    ov::pass::PassProfiler* m_profiler;
+    std::shared_ptr<ov::Model> m_model;
+    bool m_applied = false;
+    bool m_discard = false;
+};
 }  // namespace
 
 ov::pass::Manager::Manager() : m_pass_config(std::make_shared<PassConfig>()), m_visualize(getenv_visualize_tracing()) {}
@@ -77,6 +109,7 @@ bool ov::pass::Manager::run_passes(shared_ptr<ov::Model> func) {
         }
 
         OV_ITT_SCOPE(FIRST_INFERENCE, ov::itt::domains::ov_pass, ov::pass::perf_counters()[pass->get_type_info()]);
+        PassProfileScope profile_scope(pass->get_name(), func);
 
         pass_timer.start();
 
@@ -86,6 +119,7 @@ bool ov::pass::Manager::run_passes(shared_ptr<ov::Model> func) {
             if (matcher_pass->get_property(PassProperty::REQUIRE_STATIC_SHAPE) && func->is_dynamic()) {
                 OPENVINO_DEBUG << "Pass " << pass->get_name() << " requires static shape but the "
                                << "model is dynamic. Skipping this transformation";
+                profile_scope.discard();
                 continue;
             }
             // GraphRewrite is a temporary container for MatcherPass to make execution
@@ -97,6 +131,7 @@ bool ov::pass::Manager::run_passes(shared_ptr<ov::Model> func) {
             if (function_pass->get_property(PassProperty::REQUIRE_STATIC_SHAPE) && func->is_dynamic()) {
                 OPENVINO_DEBUG << "Pass " << pass->get_name() << " requires static shape but the "
                                << "model is dynamic. Skipping this transformation";
+                profile_scope.discard();
                 continue;
             }
 
@@ -104,6 +139,8 @@ bool ov::pass::Manager::run_passes(shared_ptr<ov::Model> func) {
                 if (needs_validate) {
                     function_pass->run_on_model(func);
                     needs_validate = false;
+                } else {
+                    profile_scope.discard();
                 }
             } else {
                 pass_applied = function_pass->run_on_model(func);
@@ -112,6 +149,7 @@ bool ov::pass::Manager::run_passes(shared_ptr<ov::Model> func) {
             if (node_pass->get_property(PassProperty::REQUIRE_STATIC_SHAPE) && func->is_dynamic()) {
                 OPENVINO_DEBUG << "Pass " << pass->get_name() << " requires static shape but the "
                                << "model is dynamic. Skipping this transformation";
+                profile_scope.discard();
                 continue;
             }
             for (const shared_ptr<Node>& n : func->get_ops()) {
@@ -138,6 +176,7 @@ bool ov::pass::Manager::run_passes(shared_ptr<ov::Model> func) {
             cout << setw(7) << pass_timer.get_milliseconds() << "ms" << (pass_applied ? " + " : "   ")
                  << pass->get_name() << "\n";
         }
+        profile_scope.set_applied(pass_applied);
         function_changed = function_changed || pass_applied;
         needs_validate = pass_applied;
     }
@@ -0,0 +1,155 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/pass/pass_profiler.hpp"
+
+#include <algorithm>
+#include <iomanip>
+
+#include "openvino/core/except.hpp"
+
+#ifdef _WIN32
+#    ifndef NOMINMAX
+#        define NOMINMAX
+#    endif
+#    include <windows.h>
+// clang-format off
+#    include <psapi.h>
+// clang-format on
+#else
+#    include <sys/resource.h>
+#endif
+
+namespace {
+using Clock = std::chrono::steady_clock;
+
+thread_local ov::pass::PassProfiler* active_profiler = nullptr;
+
+// high-water mark of the process resident memory, zero if it is not available
+size_t get_peak_memory_kb() {
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS counters;
+    if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+        return 0;
+    return counters.PeakWorkingSetSize / 1024;
+#else
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0)
+        return 0;
+#    ifdef __APPLE__
+    return static_cast<size_t>(usage.ru_maxrss) / 1024;  // bytes on macOS
+#    else
+    return static_cast<size_t>(usage.ru_maxrss);
+#    endif
+#endif
+}
+
+int64_t get_node_count(const std::shared_ptr<const ov::Model>& model) {
+    return model ? static_cast<int64_t>(model->get_ordered_ops().size()) : 0;
+}
+
+void accumulate(ov::pass::PassProfile& to, const ov::pass::PassProfile& from) {
+    to.runs += from.runs;
+    to.applied += from.applied;
+    to.time_ms += from.time_ms;
+    to.node_count_delta += from.node_count_delta;
+    to.peak_memory_kb = std::max(to.peak_memory_kb, from.peak_memory_kb);
+    to.peak_memory_delta_kb += from.peak_memory_delta_kb;
+}
+
+void print(std::ostream& os, const ov::pass::PassProfile& profile, size_t depth) {
+    os << std::string(depth * 2, ' ') << (profile.name.empty() ? "<total>" : profile.name) << ": " << std::fixed
+       << std::setprecision(3) << profile.time_ms << " ms, runs " << profile.runs << ", applied " << profile.applied
+       << ", nodes " << std::showpos << profile.node_count_delta << std::noshowpos << ", peak memory "
+       << profile.peak_memory_kb << " KB (+" << profile.peak_memory_delta_kb << " KB)\n";
+    for (const auto& child : profile.children) {
+        print(os, child, depth + 1);
+    }
+}
+}  // namespace
+
+std::ostream& ov::pass::operator<<(std::ostream& os, const PassProfile& profile) {
+    const auto flags = os.flags();
+    const auto precision = os.precision();
+    print(os, profile, 0);
+    os.flags(flags);
+    os.precision(precision);
+    return os;
+}
+
+ov::pass::PassProfiler::PassProfiler() : m_previous(active_profiler) {
+    m_root.peak_memory_kb = get_peak_memory_kb();
+    active_profiler = this;
+}
+
+ov::pass::PassProfiler::~PassProfiler() {
+    active_profiler = m_previous;
+}
+
+ov::pass::PassProfiler* ov::pass::PassProfiler::get_active() {
+    return active_profiler;
+}
+
+ov::pass::PassProfile& ov::pass::PassProfiler::current() {
+    return m_open_passes.empty() ? m_root : m_open_passes.back().profile;
+}
+
+void ov::pass::PassProfiler::begin_pass(const std::string& name, const std::shared_ptr<const Model>& model) {
+    const auto overhead_start = Clock::now();
+    OpenPass pass;
+    pass.profile.name = name;
+    pass.profile.runs = 1;
+    pass.profile.peak_memory_kb = get_peak_memory_kb();
+    pass.node_count = get_node_count(model);
+    pass.start = Clock::now();
+    m_overhead += pass.start - overhead_start;
+    pass.overhead_at_start = m_overhead;
+    m_open_passes.push_back(std::move(pass));
+}
+
+void ov::pass::PassProfiler::end_pass(const std::shared_ptr<const Model>& model, bool applied, bool discard) {
+    const auto end = Clock::now();
+    OPENVINO_ASSERT(!m_open_passes.empty(), "PassProfiler: end_pass() is called without begin_pass()");
+    OpenPass pass = std::move(m_open_passes.back());
+    m_open_passes.pop_back();
+    if (discard) {
+        m_overhead += Clock::now() - end;
+        return;
+    }
+
+    auto& profile = pass.profile;
+    const auto duration = (end - pass.start) - (m_overhead - pass.overhead_at_start);
+    profile.time_ms = std::chrono::duration<double, std::milli>(duration).count();
+    profile.applied = applied ? 1 : 0;
+    // some passes change the model without reporting it, so the nodes are counted regardless of the applied flag
+    profile.node_count_delta = get_node_count(model) - pass.node_count;
+    const auto peak_memory_kb = get_peak_memory_kb();
+    profile.peak_memory_delta_kb = peak_memory_kb > profile.peak_memory_kb ? peak_memory_kb - profile.peak_memory_kb : 0;
+    profile.peak_memory_kb = peak_memory_kb;
+
+    auto& parent = current();
+    if (m_open_passes.empty()) {
+        // the root holds the totals of the top level passes
+        m_root.runs += 1;
+        m_root.applied += profile.applied;
+        m_root.time_ms += profile.time_ms;
+        m_root.node_count_delta += profile.node_count_delta;
+        m_root.peak_memory_delta_kb += profile.peak_memory_delta_kb;
+        m_root.peak_memory_kb = peak_memory_kb;
+    }
+    parent.children.push_back(std::move(profile));
+    m_overhead += Clock::now() - end;
+}
+
+void ov::pass::PassProfiler::add_matcher_profile(const PassProfile& profile) {
+    auto& children = current().children;
+    auto it = std::find_if(children.begin(), children.end(), [&](const PassProfile& child) {
+        return child.name == profile.name;
+    });
+    if (it == children.end()) {
+        children.push_back(profile);
+    } else {
+        accumulate(*it, profile);
+    }
+}
@@ -4,10 +4,13 @@
 
 #include "openvino/pass/serialize.hpp"
 
+#include <algorithm>
 #include <array>
 #include <cassert>
 #include <cstdint>
+#include <cstring>
 #include <fstream>
+#include <map>
 #include <openvino/cc/pass/itt.hpp>
 #include <unordered_map>
 #include <unordered_set>
@@ -16,6 +19,7 @@
 #include "openvino/core/except.hpp"
 #include "openvino/core/meta_data.hpp"
 #include "openvino/core/model.hpp"
+#include "openvino/core/parallel.hpp"
 #include "openvino/core/type/float16.hpp"
 #include "openvino/op/util/framework_node.hpp"
 #include "openvino/opsets/opset1.hpp"
@@ -81,16 +85,22 @@ size_t hash_combine(const void* v, int64_t size) {
     return seed;
 }
 
+// (data pointer, size) -> hash of the constant payload
+using ConstantsDataHashes = std::map<std::pair<const void*, size_t>, uint64_t>;
+
 class ConstantWriter {
 public:
     using FilePosition = int64_t;
     using HashValue = size_t;
     using ConstWritePositions = std::unordered_map<HashValue, std::pair<FilePosition, void const*>>;
 
-    ConstantWriter(std::ostream& bin_data, bool enable_compression = true)
+    ConstantWriter(std::ostream& bin_data,
+                   bool enable_compression = true,
+                   const ConstantsDataHashes* data_hashes = nullptr)
         : m_binary_output(bin_data),
           m_enable_compression(enable_compression),
-          m_blob_offset(bin_data.tellp()) {}
+          m_blob_offset(bin_data.tellp()),
+          m_data_hashes(data_hashes) {}
 
     FilePosition write(const char* ptr,
                        size_t size,
@@ -101,6 +111,15 @@ public:
         const auto offset = write_pos - m_blob_offset;
         *new_size = size;
 
+        // the payload hash is precomputed, so only the hash is written instead of the data
+        if (m_data_hashes) {
+            const auto found = m_data_hashes->find({static_cast<const void*>(ptr), size});
+            if (found != m_data_hashes->end()) {
+                m_binary_output.write(reinterpret_cast<const char*>(&found->second), sizeof(found->second));
+                return offset;
+            }
+        }
+
         if (!m_enable_compression || compress_to_fp16) {
             write_with_optional_fp16_compression(ptr, size, new_size, compress_to_fp16, src_type);
             return offset;
@@ -187,6 +206,7 @@ private:
     std::ostream& m_binary_output;
     bool m_enable_compression;
     FilePosition m_blob_offset;  // blob offset inside output stream
+    const ConstantsDataHashes* m_data_hashes;
 };
 
 void ngfunction_2_ir(pugi::xml_node& node,
@@ -1154,7 +1174,8 @@ void serializeFunc(std::ostream& xml_file,
                    std::shared_ptr<ov::Model> model,
                    ov::pass::Serialize::Version ver,
                    const std::map<std::string, ngraph::OpSet>& custom_opsets,
-                   bool deterministic = false) {
+                   bool deterministic = false,
+                   const ConstantsDataHashes* data_hashes = nullptr) {
     auto version = static_cast<int64_t>(ver);
 
     auto& rt_info = model->get_rt_info();
@@ -1175,7 +1196,7 @@ void serializeFunc(std::ostream& xml_file,
     std::string name = "net";
     pugi::xml_document xml_doc;
     pugi::xml_node net_node = xml_doc.append_child(name.c_str());
-    ConstantWriter constant_write_handler(bin_file);
+    ConstantWriter constant_write_handler(bin_file, true, data_hashes);
     XmlSerializer visitor(net_node, name, custom_opsets, constant_write_handler, version, deterministic);
     visitor.on_attribute(name, model);
 
@@ -1372,6 +1393,95 @@ public:
         return n;
     }
 };
+
+inline uint64_t rotl64(uint64_t x, int r) {
+    return (x << r) | (x >> (64 - r));
+}
+
+inline uint64_t fmix64(uint64_t k) {
+    k ^= k >> 33;
+    k *= 0xff51afd7ed558ccdull;
+    k ^= k >> 33;
+    k *= 0xc4ceb9fe1a85ec53ull;
+    k ^= k >> 33;
+    return k;
+}
+
+// Fast non-cryptographic 64-bit hash (MurmurHash3 mixing) of the data chunk.
+// Unlike the sum used for the serialized stream it depends on the position of every word.
+uint64_t hash_data(const char* data, size_t size, uint64_t seed) {
+    constexpr uint64_t c1 = 0x87c37b91114253d5ull;
+    constexpr uint64_t c2 = 0x4cf5ad432745937full;
+    uint64_t h = seed ^ (static_cast<uint64_t>(size) * c1);
+    const size_t words = size / sizeof(uint64_t);
+    for (size_t i = 0; i < words; ++i) {
+        uint64_t k;
+        std::memcpy(&k, data + i * sizeof(uint64_t), sizeof(uint64_t));
+        k *= c1;
+        k = rotl64(k, 31);
+        k *= c2;
+        h ^= k;
+        h = rotl64(h, 27) * 5 + 0x52dce729;
+    }
+    uint64_t tail = 0;
+    std::memcpy(&tail, data + words * sizeof(uint64_t), size % sizeof(uint64_t));
+    h ^= rotl64(tail * c1, 31) * c2;
+    return fmix64(h);
+}
+
+void collect_constants(const std::shared_ptr<ov::Model>& model,
+                       std::vector<std::shared_ptr<ov::op::v0::Constant>>& constants) {
+    for (const auto& op : model->get_ordered_ops()) {
+        if (const auto& constant = std::dynamic_pointer_cast<ov::op::v0::Constant>(op)) {
+            constants.push_back(constant);
+        } else if (const auto& multi_subgraph_op = std::dynamic_pointer_cast<ov::op::util::MultiSubGraphOp>(op)) {
+            for (const auto& body : multi_subgraph_op->get_functions()) {
+                collect_constants(body, constants);
+            }
+        }
+    }
+}
+
+// Computes the hashes of all the constants payloads. The payloads are split into chunks hashed in parallel,
+// then the chunks hashes are combined in order, so the result does not depend on the number of threads.
+ConstantsDataHashes hash_constants_data(const std::shared_ptr<ov::Model>& model) {
+    constexpr size_t chunk_size = 1 << 20;
+    std::vector<std::shared_ptr<ov::op::v0::Constant>> constants;
+    collect_constants(model, constants);
+
+    struct Chunk {
+        size_t constant_idx;
+        size_t offset;
+        size_t size;
+    };
+    std::vector<Chunk> chunks;
+    std::vector<size_t> first_chunk(constants.size() + 1, 0);
+    for (size_t i = 0; i < constants.size(); ++i) {
+        first_chunk[i] = chunks.size();
+        const size_t size = constants[i]->get_byte_size();
+        for (size_t offset = 0; offset < size; offset += chunk_size) {
+            chunks.push_back({i, offset, std::min(chunk_size, size - offset)});
+        }
+    }
+    first_chunk[constants.size()] = chunks.size();
+
+    std::vector<uint64_t> chunk_hashes(chunks.size());
+    ov::parallel_for(chunks.size(), [&](size_t i) {
+        const auto& chunk = chunks[i];
+        const auto data = static_cast<const char*>(constants[chunk.constant_idx]->get_data_ptr());
+        chunk_hashes[i] = hash_data(data + chunk.offset, chunk.size, chunk.offset);
+    });
+
+    ConstantsDataHashes result;
+    for (size_t i = 0; i < constants.size(); ++i) {
+        uint64_t hash = constants[i]->get_byte_size();
+        for (size_t c = first_chunk[i]; c < first_chunk[i + 1]; ++c) {
+            hash = hash_combine(hash, chunk_hashes[c]);
+        }
+        result[{constants[i]->get_data_ptr(), constants[i]->get_byte_size()}] = hash;
+    }
+    return result;
+}
 }  // namespace
 
 bool pass::Hash::run_on_model(const std::shared_ptr<ov::Model>& model) {
@@ -1381,8 +1491,11 @@ bool pass::Hash::run_on_model(const std::shared_ptr<ov::Model>& model) {
     std::ostream xml(&xmlHash);
     std::ostream bin(&binHash);
 
+    // The constants payloads are hashed in parallel and only their hashes get to the serialized weights stream
+    const auto data_hashes = hash_constants_data(model);
+
     // Determinism is important for hash calculation
-    serializeFunc(xml, bin, model, Serialize::Version::UNSPECIFIED, {}, true);
+    serializeFunc(xml, bin, model, Serialize::Version::UNSPECIFIED, {}, true, &data_hashes);
 
     uint64_t seed = 0;
     seed = hash_combine(seed, xmlHash.getResult());
@@ -3930,3 +3930,43 @@ TEST(constant_folding, parameter_with_unspecified_type_from_host_tensor) {
     auto model = std::make_shared<ov::Model>(ov::ResultVector{res}, ov::ParameterVector{param});
     EXPECT_NO_THROW(run_constant_folding(model));
 }
+
+TEST(constant_folding, independent_branches_with_intermediate_results) {
+    constexpr size_t branches = 8;
+    auto two = make_shared<op::v0::Constant>(element::f32, Shape{}, vector<float>{2});
+    auto one = make_shared<op::v0::Constant>(element::f32, Shape{}, vector<float>{1});
+    NodeVector adds;
+    std::vector<std::weak_ptr<Node>> intermediates;
+    vector<float> expected;
+    for (size_t i = 0; i < branches; ++i) {
+        const auto value = static_cast<float>(i);
+        auto constant = make_shared<op::v0::Constant>(element::f32, Shape{1, 2}, vector<float>{value, -value});
+        auto mul = make_shared<op::v1::Multiply>(constant, two);
+        auto add = make_shared<op::v1::Add>(mul, one);
+        add->set_friendly_name("add_" + std::to_string(i));
+        intermediates.push_back(mul);
+        adds.push_back(add);
+        expected.push_back(value * 2 + 1);
+        expected.push_back(-value * 2 + 1);
+    }
+    auto concat = make_shared<op::v0::Concat>(adds, 0);
+    concat->set_friendly_name("test");
+    auto m = make_shared<Model>(concat, ParameterVector{});
+    adds.clear();
+
+    run_constant_folding(m);
+
+    EXPECT_EQ(count_ops_of_type<op::v1::Multiply>(m), 0);
+    EXPECT_EQ(count_ops_of_type<op::v1::Add>(m), 0);
+    EXPECT_EQ(count_ops_of_type<op::v0::Concat>(m), 0);
+    EXPECT_EQ(count_ops_of_type<op::v0::Constant>(m), 1);
+
+    auto new_const = get_result_constant(m);
+    ASSERT_TRUE(new_const);
+    ASSERT_EQ(new_const->get_friendly_name(), "test");
+    ASSERT_EQ(new_const->get_output_shape(0), (Shape{branches, 2}));
+    EXPECT_EQ(new_const->get_vector<float>(), expected);
+    for (const auto& intermediate : intermediates) {
+        EXPECT_TRUE(intermediate.expired());
+    }
+}
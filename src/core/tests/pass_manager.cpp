@@ -16,8 +16,11 @@
 #include "openvino/op/matmul.hpp"
 #include "openvino/op/multiply.hpp"
 #include "openvino/op/parameter.hpp"
+#include "openvino/pass/graph_rewrite.hpp"
 #include "openvino/pass/manager.hpp"
 #include "openvino/pass/pass.hpp"
+#include "openvino/pass/pass_profiler.hpp"
+#include "openvino/pass/pattern/op/wrap_type.hpp"
 
 using namespace ov;
 using namespace std;
@@ -75,6 +78,31 @@ bool validate_list(const std::vector<std::shared_ptr<ov::Node>>& nodes) {
     return rc;
 }
 
+class ReplaceMultiplyWithAdd : public ov::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("ReplaceMultiplyWithAdd");
+    ReplaceMultiplyWithAdd() {
+        auto multiply = ov::pass::pattern::wrap_type<ov::op::v1::Multiply>();
+        auto callback = [](ov::pass::pattern::Matcher& m) {
+            auto node = m.get_match_root();
+            ov::replace_node(node, std::make_shared<ov::op::v1::Add>(node->input_value(0), node->input_value(1)));
+            return true;
+        };
+        register_matcher(std::make_shared<ov::pass::pattern::Matcher>(multiply, "ReplaceMultiplyWithAdd"), callback);
+    }
+};
+
+class NestedPipeline : public ov::pass::ModelPass {
+public:
+    OPENVINO_RTTI("NestedPipeline");
+    bool run_on_model(const std::shared_ptr<ov::Model>& model) override {
+        ov::pass::Manager manager;
+        manager.set_per_pass_validation(false);
+        manager.register_pass<ReplaceMultiplyWithAdd>();
+        return manager.run_passes(model);
+    }
+};
+
 }  // namespace
 
 TEST(pass_manager, add) {
@@ -90,3 +118,44 @@ TEST(pass_manager, add) {
     EXPECT_EQ(node_count, sorted.size());
     EXPECT_TRUE(validate_list(sorted));
 }
+
+TEST(pass_manager, profiler_collects_nested_passes) {
+    auto graph = make_test_graph();
+    {
+        ov::pass::PassProfiler profiler;
+        ASSERT_EQ(ov::pass::PassProfiler::get_active(), &profiler);
+
+        pass::Manager pass_manager;
+        pass_manager.set_per_pass_validation(false);
+        pass_manager.register_pass<NestedPipeline>();
+        pass_manager.run_passes(graph);
+
+        const auto& profile = profiler.get_profile();
+        EXPECT_EQ(profile.runs, 1);
+        EXPECT_EQ(profile.applied, 1);
+        ASSERT_EQ(profile.children.size(), 1);
+
+        const auto& pipeline = profile.children[0];
+        EXPECT_EQ(pipeline.name, "NestedPipeline");
+        EXPECT_EQ(pipeline.applied, 1);
+        EXPECT_EQ(pipeline.node_count_delta, 0);
+        EXPECT_GE(pipeline.time_ms, 0.0);
+        ASSERT_EQ(pipeline.children.size(), 1);
+
+        const auto& matcher_pass = pipeline.children[0];
+        EXPECT_EQ(matcher_pass.name, "ReplaceMultiplyWithAdd");
+        EXPECT_LE(matcher_pass.time_ms, pipeline.time_ms);
+        ASSERT_EQ(matcher_pass.children.size(), 1);
+
+        // the matcher is applied to the only Multiply node of the graph
+        const auto& matcher = matcher_pass.children[0];
+        EXPECT_EQ(matcher.name, "ReplaceMultiplyWithAdd");
+        EXPECT_EQ(matcher.runs, 1);
+        EXPECT_EQ(matcher.applied, 1);
+
+        std::stringstream ss;
+        ss << profile;
+        EXPECT_NE(ss.str().find("NestedPipeline"), std::string::npos);
+    }
+    EXPECT_EQ(ov::pass::PassProfiler::get_active(), nullptr);
+}
@@ -16,6 +16,7 @@
 #include "openvino/op/util/variable.hpp"
 #include "openvino/opsets/opset.hpp"
 #include "openvino/util/common_util.hpp"
+#include "openvino/util/log.hpp"
 #include "utils.hpp"
 
 OPENVINO_SUPPRESS_DEPRECATED_START
@@ -206,6 +207,7 @@ class InputModel::InputModelIRImpl {
     std::unordered_map<std::string, ov::OpSet> m_opsets;
     pugi::xml_node m_root;
     pugi::xml_document m_xml_doc;
+    std::shared_ptr<ov::ReadingTimings> m_timings = std::make_shared<ov::ReadingTimings>();
 
 public:
     InputModelIRImpl(std::istream& stream,
@@ -213,6 +215,7 @@ public:
                      const std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr>& extensions)
         : m_weights(weights),
           m_extensions(extensions) {
+        ov::ReadingTimings::Scope xml_parse_scope(m_timings, &ov::ReadingTimings::xml_parse);
         pugi::xml_parse_result res = m_xml_doc.load(stream);
         if (res.status != pugi::status_ok) {
             OPENVINO_THROW(res.description(), " at offset ", res.offset);
@@ -242,11 +245,12 @@ std::shared_ptr<ov::Model> InputModel::InputModelIRImpl::convert() {
 
     // Load default opsets
     size_t version = static_cast<size_t>(pugixml::utils::get_uint64_attr(m_root, "version", 0));
-    ov::XmlDeserializer visitor(m_root, m_weights, m_opsets, m_extensions, variables, version);
+    ov::XmlDeserializer visitor(m_root, m_weights, m_opsets, m_extensions, variables, version, m_timings);
     std::shared_ptr<ov::Model> model;
     visitor.on_attribute("net", model);
     model->get_rt_info()["version"] = int64_t(version);
     parse_pre_process(m_root, m_weights, model);
+    OPENVINO_DEBUG << "IR frontend: " << model->get_friendly_name() << " is read, " << m_timings->to_string();
 
     return model;
 }
@@ -4,12 +4,14 @@
 
 #include "ir_deserializer.hpp"
 
+#include <iomanip>
 #include <pugixml.hpp>
 #include <regex>
 
 #include "ngraph/runtime/shared_buffer.hpp"
 #include "openvino/core/except.hpp"
 #include "openvino/core/meta_data.hpp"
+#include "openvino/core/parallel.hpp"
 #include "openvino/core/type/element_type.hpp"
 #include "openvino/op/constant.hpp"
 #include "openvino/op/loop.hpp"
@@ -24,6 +26,15 @@
 #include "transformations/rt_info/attributes.hpp"
 #include "utils.hpp"
 
+std::string ov::ReadingTimings::to_string() const {
+    std::stringstream ss;
+    ss << std::fixed << std::setprecision(3) << "xml parse: " << xml_parse / 1e6
+       << " ms, constants: " << constants / 1e6
+       << " ms, node creation (including rt_info and validation): " << node_creation / 1e6
+       << " ms, rt_info: " << rt_info / 1e6 << " ms, validation: " << validation / 1e6 << " ms";
+    return ss.str();
+}
+
 ov::XmlDeserializer::IoMap ov::XmlDeserializer::updated_io_map(const pugi::xml_node& node,
                                                                const pugi::xml_node& body_node) {
     if (body_node.empty()) {
@@ -482,6 +493,34 @@ std::shared_ptr<ov::Model> ov::XmlDeserializer::parse_function(
     std::map<size_t, std::shared_ptr<ov::Node>> id_to_node;
     std::map<std::string, std::shared_ptr<ov::Node>> variable_id_to_read_value;
 
+    // Constants have no inputs, so they are created (attributes decoded, weights validated and runtime info read)
+    // in parallel before the rest of the graph. The weights of the large models are the majority of the layers.
+    if (can_create_constants_in_parallel()) {
+        ReadingTimings::Scope constants_scope(m_timings, &ReadingTimings::constants);
+        std::vector<size_t> constant_ids;
+        for (const auto& layer_id : order) {
+            if (params[layer_id].params.type == "Const" && edges[layer_id].empty())
+                constant_ids.push_back(layer_id);
+        }
+        std::vector<std::shared_ptr<ov::Node>> constants(constant_ids.size());
+        std::vector<std::exception_ptr> exceptions(constant_ids.size());
+        ov::parallel_for(constant_ids.size(), [&](size_t i) {
+            try {
+                const auto& p = params.at(constant_ids[i]);
+                constants[i] = create_node({}, p.xml, weights, p.params);
+            } catch (...) {
+                exceptions[i] = std::current_exception();
+            }
+        });
+        for (const auto& exception : exceptions) {
+            if (exception)
+                std::rethrow_exception(exception);
+        }
+        for (size_t i = 0; i < constant_ids.size(); i++) {
+            id_to_node[constant_ids[i]] = constants[i];
+        }
+    }
+
     //  Following topological order create OpenVINO operations
     for (auto& layer_id : order) {
         auto& p = params[layer_id];
@@ -506,7 +545,9 @@ std::shared_ptr<ov::Model> ov::XmlDeserializer::parse_function(
             inputs[realInputPortId] = input_node->output(p_output.get_real_output_port_id(e.fromPortId));
         }
 
-        auto node = create_node(inputs, p.xml, weights, p.params);
+        auto created_it = id_to_node.find(layer_id);
+        auto node =
+            created_it != id_to_node.end() ? created_it->second : create_node(inputs, p.xml, weights, p.params);
         id_to_node[layer_id] = node;
 
         if (const auto& parameter_node = std::dynamic_pointer_cast<ov::op::v0::Parameter>(node)) {
@@ -669,6 +710,14 @@ void ov::XmlDeserializer::read_legacy_meta_data(const std::shared_ptr<ov::Model>
         read_meta(model, it, root_section.child(it.c_str()));
 }
 
+bool ov::XmlDeserializer::can_create_constants_in_parallel() const {
+    // the extensions are not required to be thread safe
+    using ExtensionItem = std::pair<const ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr>;
+    return std::none_of(m_extensions.begin(), m_extensions.end(), [](const ExtensionItem& ext) {
+        return std::string(ext.first.name) == "Constant";
+    });
+}
+
 ov::GenericLayerParams ov::XmlDeserializer::parse_generic_params(const pugi::xml_node& node) {
     const auto parsePort = [](const pugi::xml_node& parentNode,
                               const GenericLayerParams& params,
@@ -757,6 +806,7 @@ std::shared_ptr<ov::Node> ov::XmlDeserializer::create_node(
     const pugi::xml_node& node,
     const std::shared_ptr<ngraph::runtime::AlignedBuffer>& weights,
     const GenericLayerParams& params) {
+    ReadingTimings::Scope creation_scope(m_timings, &ReadingTimings::node_creation);
     // Check that inputs are correctly defined
     for (size_t i = 0; i < inputs.size(); i++) {
         if (!inputs[i].get_node())
@@ -841,10 +891,12 @@ std::shared_ptr<ov::Node> ov::XmlDeserializer::create_node(
         XmlDeserializer visitor(node, weights, m_opsets, m_extensions, m_variables, m_version);
 
         if (ovNode->visit_attributes(visitor)) {
+            ReadingTimings::Scope validation_scope(m_timings, &ReadingTimings::validation);
             ovNode->constructor_validate_and_infer_types();
         }
 
         // To be sure that all default values will be initialized:
+        ReadingTimings::Scope validation_scope(m_timings, &ReadingTimings::validation);
         ovNode = ovNode->clone_with_new_inputs(ovNode->input_values());
     }
     if (!ovNode && m_extensions.count(ov::op::util::FrameworkNode::get_type_info_static())) {
@@ -933,6 +985,7 @@ std::shared_ptr<ov::Node> ov::XmlDeserializer::create_node(
 
     // read runtime info only for IR v11+
     if (m_version > 10) {
+        ReadingTimings::Scope rt_info_scope(m_timings, &ReadingTimings::rt_info);
         // set node runtime info attributes
         set_runtime_info(ovNode->get_rt_info(), node.child("rt_info"));
 
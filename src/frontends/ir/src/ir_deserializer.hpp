@@ -4,7 +4,9 @@
 
 #pragma once
 
+#include <atomic>
 #include <cctype>
+#include <chrono>
 #include <istream>
 #include <memory>
 #include <pugixml.hpp>
@@ -56,6 +58,41 @@ struct GenericLayerParams {
     }
 };
 
+/// \brief Accumulated durations of the IR reading phases in nanoseconds.
+/// The phases of the nodes created in parallel are summed over the threads.
+struct ReadingTimings {
+    std::atomic<int64_t> xml_parse{0};
+    std::atomic<int64_t> constants{0};  // wall time of the parallel constants creation
+    std::atomic<int64_t> node_creation{0};
+    std::atomic<int64_t> rt_info{0};
+    std::atomic<int64_t> validation{0};
+
+    std::string to_string() const;
+
+    /// \brief Adds the time elapsed since the object creation to the phase counter on destruction
+    class Scope {
+    public:
+        Scope(const std::shared_ptr<ReadingTimings>& timings, std::atomic<int64_t> ReadingTimings::*phase)
+            : m_timings(timings),
+              m_phase(phase),
+              m_start(std::chrono::steady_clock::now()) {}
+        ~Scope() {
+            if (m_timings) {
+                m_timings.get()->*m_phase += elapsed();
+            }
+        }
+        int64_t elapsed() const {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_start)
+                .count();
+        }
+
+    private:
+        const std::shared_ptr<ReadingTimings>& m_timings;
+        std::atomic<int64_t> ReadingTimings::*m_phase;
+        std::chrono::steady_clock::time_point m_start;
+    };
+};
+
 class XmlDeserializer : public ov::AttributeVisitor {
 public:
     OPENVINO_SUPPRESS_DEPRECATED_START
@@ -64,13 +101,15 @@ public:
                              const std::unordered_map<std::string, ov::OpSet>& opsets,
                              const std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr>& extensions,
                              std::unordered_map<std::string, std::shared_ptr<ov::op::util::Variable>>& variables,
-                             size_t version)
+                             size_t version,
+                             const std::shared_ptr<ReadingTimings>& timings = nullptr)
         : m_node(node),
           m_weights(weights),
           m_opsets(opsets),
           m_extensions(extensions),
           m_variables(variables),
-          m_version(version) {}
+          m_version(version),
+          m_timings(timings) {}
     OPENVINO_SUPPRESS_DEPRECATED_END
 
     void on_adapter(const std::string& name, ov::ValueAccessor<std::string>& value) override {
@@ -179,6 +218,9 @@ private:
 
     GenericLayerParams parse_generic_params(const pugi::xml_node& node);
 
+    /// \brief Returns true if the constants of the model may be created concurrently
+    bool can_create_constants_in_parallel() const;
+
     OPENVINO_SUPPRESS_DEPRECATED_START
     std::shared_ptr<ov::Node> create_node(const ov::OutputVector& inputs,
                                           const pugi::xml_node& node,
@@ -208,5 +250,8 @@ private:
     IoMap io_map;
 
     int64_t m_version;
+
+    /// phases durations, the nodes of the nested bodies are accounted as the creation of the outer node
+    std::shared_ptr<ReadingTimings> m_timings;
 };
 }  // namespace ov
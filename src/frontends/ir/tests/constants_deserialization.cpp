@@ -0,0 +1,188 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstring>
+#include <map>
+#include <regex>
+
+#include "frontend_test.hpp"
+#include "openvino/op/constant.hpp"
+
+class IRFrontendConstantsTests : public ::testing::TestWithParam<bool>, public IRFrontendTestsImpl {
+protected:
+    // the weights of the constants are repeated and shifted in the bin file
+    static constexpr size_t constants_num = 64;
+    static constexpr size_t weights_num = 4;
+    static constexpr size_t constant_size = 4;
+
+    static std::string substitute(std::string text, const std::map<std::string, size_t>& values) {
+        for (const auto& value : values) {
+            for (auto pos = text.find(value.first); pos != std::string::npos; pos = text.find(value.first))
+                text.replace(pos, value.first.size(), std::to_string(value.second));
+        }
+        return text;
+    }
+
+    void SetUp() override {
+        const std::string constant_layer = R"V0G0N(
+        <layer id="CONST_ID" name="const_INDEX" type="Const" version="opset1">
+            <data element_type="f32" shape="4" offset="OFFSET" size="16"/>
+            <output>
+                <port id="0" precision="FP32">
+                    <dim>4</dim>
+                </port>
+            </output>
+            <rt_info>
+                <attribute name="fused_names" version="0" value="const_INDEX"/>
+            </rt_info>
+        </layer>
+        <layer id="ADD_ID" name="add_INDEX" type="Add" version="opset1">
+            <data auto_broadcast="numpy"/>
+            <input>
+                <port id="0" precision="FP32">
+                    <dim>4</dim>
+                </port>
+                <port id="1" precision="FP32">
+                    <dim>4</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2" precision="FP32">
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>)V0G0N";
+        const std::string constant_edges = R"V0G0N(
+        <edge from-layer="PREV_ID" from-port="PREV_PORT" to-layer="ADD_ID" to-port="0"/>
+        <edge from-layer="CONST_ID" from-port="0" to-layer="ADD_ID" to-port="1"/>)V0G0N";
+
+        std::string layers, edges;
+        size_t prev_id = 0, prev_port = 0;
+        for (size_t i = 0; i < constants_num; i++) {
+            const std::map<std::string, size_t> values = {{"CONST_ID", 1 + 2 * i},
+                                                          {"ADD_ID", 2 + 2 * i},
+                                                          {"PREV_ID", prev_id},
+                                                          {"PREV_PORT", prev_port},
+                                                          {"INDEX", i},
+                                                          {"OFFSET", (i % weights_num) * constant_size * sizeof(float)}};
+            layers += substitute(constant_layer, values);
+            edges += substitute(constant_edges, values);
+            prev_id = 2 + 2 * i;
+            prev_port = 2;
+        }
+
+        const std::string xml_model = R"V0G0N(<?xml version="1.0" ?>
+<net name="Network" version="11">
+    <layers>
+        <layer id="0" name="input" type="Parameter" version="opset1">
+            <data element_type="f32" shape="4"/>
+            <output>
+                <port id="0" precision="FP32">
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>LAYERS
+        <layer id="RESULT_ID" name="output" type="Result" version="opset1">
+            <input>
+                <port id="0" precision="FP32">
+                    <dim>4</dim>
+                </port>
+            </input>
+        </layer>
+    </layers>
+    <edges>EDGES
+        <edge from-layer="PREV_ID" from-port="2" to-layer="RESULT_ID" to-port="0"/>
+    </edges>
+</net>
+)V0G0N";
+
+        std::vector<float> weights(weights_num * constant_size);
+        for (size_t i = 0; i < weights.size(); i++)
+            weights[i] = static_cast<float>(i) - 8.f;
+        std::vector<unsigned char> buffer(weights.size() * sizeof(float));
+        std::memcpy(buffer.data(), weights.data(), buffer.size());
+
+        auto model = substitute(xml_model, {{"RESULT_ID", 2 * constants_num + 1}, {"PREV_ID", prev_id}});
+        model.replace(model.find("LAYERS"), std::string("LAYERS").size(), layers);
+        model.replace(model.find("EDGES"), std::string("EDGES").size(), edges);
+        createTemporalModelFile(model, buffer);
+    }
+
+    void TearDown() override {
+        RemoveTemporalFiles();
+    }
+
+    std::shared_ptr<ov::Model> read_model(bool sequential) {
+        ov::Core new_core;
+        new_core.set_property(ov::enable_mmap(GetParam()));
+        // the extensions overriding Constant aren't required to be thread safe, so the constants are created
+        // sequentially in the topological order with the rest of the nodes
+        if (sequential)
+            new_core.add_extension(std::make_shared<ov::OpExtension<ov::op::v0::Constant>>());
+        return new_core.read_model(xmlFileName, binFileName);
+    }
+
+    static std::vector<std::shared_ptr<ov::op::v0::Constant>> get_constants(const std::shared_ptr<ov::Model>& model) {
+        std::vector<std::shared_ptr<ov::op::v0::Constant>> constants(constants_num);
+        for (const auto& op : model->get_ordered_ops()) {
+            if (auto constant = std::dynamic_pointer_cast<ov::op::v0::Constant>(op)) {
+                const auto index = std::stoul(constant->get_friendly_name().substr(std::string("const_").size()));
+                constants.at(index) = constant;
+            }
+        }
+        return constants;
+    }
+};
+
+TEST_P(IRFrontendConstantsTests, parallel_constants_reading_is_the_same_as_sequential) {
+    std::shared_ptr<ov::Model> model, model_ref;
+    ASSERT_NO_THROW(model = read_model(false));
+    ASSERT_NO_THROW(model_ref = read_model(true));
+    ASSERT_TRUE(!!model);
+    ASSERT_TRUE(!!model_ref);
+
+    const auto fc = FunctionsComparator::with_default()
+                        .enable(FunctionsComparator::ATTRIBUTES)
+                        .enable(FunctionsComparator::PRECISIONS)
+                        .enable(FunctionsComparator::RUNTIME_KEYS)
+                        .enable(FunctionsComparator::NAMES)
+                        .enable(FunctionsComparator::CONST_VALUES);
+    const auto res = fc.compare(model, model_ref);
+    EXPECT_TRUE(res.valid) << res.message;
+
+    for (const auto& m : {model, model_ref}) {
+        const auto constants = get_constants(m);
+        for (size_t i = 0; i < constants_num; i++)
+            ASSERT_TRUE(!!constants[i]) << "const_" << i;
+        const auto base = constants[0]->get_data_ptr<float>();
+        for (size_t i = 0; i < constants_num; i++) {
+            // the constants share the weights at their offsets
+            const auto offset = (i % weights_num) * constant_size;
+            EXPECT_EQ(constants[i]->get_data_ptr<float>(), base + offset) << "const_" << i;
+            EXPECT_EQ(constants[i]->cast_vector<float>()[0], static_cast<float>(offset) - 8.f) << "const_" << i;
+            const auto& rt_info = constants[i]->get_rt_info();
+            EXPECT_NE(rt_info.find("fused_names_0"), rt_info.end()) << "const_" << i;
+        }
+    }
+}
+
+#ifdef ENABLE_OPENVINO_DEBUG
+TEST_P(IRFrontendConstantsTests, reading_timings_are_reported) {
+    testing::internal::CaptureStdout();
+    std::shared_ptr<ov::Model> model;
+    ASSERT_NO_THROW(model = read_model(false));
+    const auto output = testing::internal::GetCapturedStdout();
+
+    std::smatch match;
+    const std::regex report("IR frontend: Network is read, xml parse: ([0-9.]+) ms, constants: ([0-9.]+) ms, "
+                            "node creation \\(including rt_info and validation\\): ([0-9.]+) ms, "
+                            "rt_info: ([0-9.]+) ms, validation: ([0-9.]+) ms");
+    ASSERT_TRUE(std::regex_search(output, match, report)) << output;
+    // all the phases are measured while the model with the weights, rt_info and validation of each node is read
+    for (size_t phase = 1; phase < match.size(); phase++)
+        EXPECT_GT(std::stod(match[phase].str()), 0.0) << match[0].str();
+}
+#endif
+
+INSTANTIATE_TEST_SUITE_P(EnableMMapPropery, IRFrontendConstantsTests, ::testing::Bool());
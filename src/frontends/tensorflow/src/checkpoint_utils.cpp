@@ -267,7 +267,7 @@ const char* decode_entry(const char* p,
             return nullptr;
     }
 
-    if (static_cast<uint32_t>(limit - p) < (non_shared + value_length)) {
+    if (static_cast<uint64_t>(limit - p) < static_cast<uint64_t>(non_shared) + value_length) {
         return nullptr;
     }
     return p;
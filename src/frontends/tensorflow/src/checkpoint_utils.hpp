@@ -6,6 +6,7 @@
 
 #include <stdint.h>
 
+#include <algorithm>
 #include <fstream>
 #include <vector>
 
@@ -65,10 +66,25 @@ struct VIFooter {
         FRONT_END_GENERAL_CHECK(size >= VARIABLES_INDEX_FOOTER_SIZE,
                                 "Wrong index file, file size is less than minimal expected");
 
-        char footerData[VARIABLES_INDEX_FOOTER_SIZE] = {}, *ptr = &footerData[0];
+        char footerData[VARIABLES_INDEX_FOOTER_SIZE] = {};
         fs.seekg(size - sizeof(footerData));
-        fs.read(ptr, sizeof(footerData));
+        fs.read(&footerData[0], sizeof(footerData));
+        read_footer(footerData);
+    }
+
+    /// \brief Reads the footer of a file loaded into memory (e.g. mapped)
+    void read(const char* data, size_t size) {
+        FRONT_END_GENERAL_CHECK(size >= VARIABLES_INDEX_FOOTER_SIZE,
+                                "Wrong index file, file size is less than minimal expected");
+
+        char footerData[VARIABLES_INDEX_FOOTER_SIZE] = {};
+        std::copy(data + size - sizeof(footerData), data + size, &footerData[0]);
+        read_footer(footerData);
+    }
 
+private:
+    void read_footer(char (&footerData)[VARIABLES_INDEX_FOOTER_SIZE]) {
+        char* ptr = &footerData[0];
         // https://github.com/tensorflow/tensorflow/blob/9659b7bdca80a8ef8240eb021d4da089034eeb00/tensorflow/tsl/lib/io/format.cc#L59
         ptr += sizeof(footerData) - 8;
         uint32_t magic_lo = *reinterpret_cast<const uint32_t*>(ptr);
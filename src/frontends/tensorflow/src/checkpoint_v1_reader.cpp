@@ -5,6 +5,7 @@
 #include "checkpoint_v1_reader.hpp"
 
 #include "checkpoint_utils.hpp"
+#include "openvino/core/parallel.hpp"
 #include "openvino/frontend/exception.hpp"
 #include "openvino/util/file_util.hpp"
 #include "saved_tensor_slice.pb.h"
@@ -51,38 +52,99 @@ void CheckpointV1Reader::initialize() {
     }
 
     m_variables_info_map.clear();
+    m_shards.clear();
+    m_shard_names.clear();
+    m_entries.clear();
+    m_uncompressed_blocks.clear();
 
-    for (auto checkpoint_path : checkpoints_paths) {
-        // create ifstream for each shard
-        std::shared_ptr<std::ifstream> shard_stream =
-            std::make_shared<std::ifstream>(checkpoint_path, std::ifstream::in | std::ifstream::binary);
+    // map each shard and collect handles of its data blocks from the index block
+    std::vector<std::pair<size_t, VIBlock>> data_blocks;
+    for (const auto& checkpoint_path : checkpoints_paths) {
+        std::shared_ptr<ov::MappedMemory> shard;
+        try {
+            shard = ov::load_mmap_object(checkpoint_path);
+        } catch (const std::exception&) {
+            // the error is reported below
+        }
         FRONT_END_GENERAL_CHECK(
-            shard_stream && shard_stream->is_open(),
-            "[TensorFlow Frontend] incorrect model: checkpoint file " + checkpoint_path + "does not exist");
-        const int32_t shard_ind = static_cast<int32_t>(m_shards.size());
-        m_shards.push_back(shard_stream);
+            shard && shard->size() > 0,
+            "[TensorFlow Frontend] incorrect model: checkpoint file " + checkpoint_path + " cannot be mapped");
+        const size_t shard_id = m_shards.size();
+        m_shards.push_back(shard);
         m_shard_names.push_back(checkpoint_path);
-        std::string value;
-        find_entry(shard_stream, checkpoint_path, SAVED_TENSOR_SLICES_KEY, value);
+
+        VIFooter footer;
+        footer.read(shard->data(), shard->size());
+        std::unique_ptr<std::string> uncompressed_index_block;
+        const auto index_block =
+            init_block(shard_id, footer.m_index.m_offset, footer.m_index.m_size, uncompressed_index_block);
+        std::vector<std::pair<std::string, CheckpointEntry>> index_entries;
+        parse_block(shard_id, index_block, index_entries);
+        for (const auto& index_entry : index_entries) {
+            // each entry of the index block contains offset and size of the data block
+            std::string block_handle(index_entry.second.data, index_entry.second.size);
+            VIBlock data_block;
+            FRONT_END_GENERAL_CHECK(
+                get_varint64(block_handle, &data_block.m_offset) && get_varint64(block_handle, &data_block.m_size),
+                "[TensorFlow Frontend] incorrect input model: bad block handle in checkpoint file " + checkpoint_path);
+            data_blocks.emplace_back(shard_id, data_block);
+        }
+    }
+
+    // the data blocks are independent, so they are decompressed and parsed in parallel
+    std::vector<std::vector<std::pair<std::string, CheckpointEntry>>> block_entries(data_blocks.size());
+    std::vector<std::unique_ptr<std::string>> uncompressed_blocks(data_blocks.size());
+    std::vector<std::exception_ptr> exceptions(data_blocks.size());
+    ov::parallel_for(data_blocks.size(), [&](size_t i) {
+        try {
+            const auto shard_id = data_blocks[i].first;
+            const auto& handle = data_blocks[i].second;
+            parse_block(shard_id,
+                        init_block(shard_id, handle.m_offset, handle.m_size, uncompressed_blocks[i]),
+                        block_entries[i]);
+        } catch (...) {
+            exceptions[i] = std::current_exception();
+        }
+    });
+    for (const auto& exception : exceptions) {
+        if (exception)
+            std::rethrow_exception(exception);
+    }
+
+    m_entries.resize(m_shards.size());
+    for (size_t i = 0; i < data_blocks.size(); ++i) {
+        auto& shard_entries = m_entries[data_blocks[i].first];
+        for (auto& entry : block_entries[i]) {
+            shard_entries.emplace(std::move(entry.first), entry.second);
+        }
+        if (uncompressed_blocks[i]) {
+            m_uncompressed_blocks.push_back(std::move(uncompressed_blocks[i]));
+        }
+    }
+
+    for (size_t shard_id = 0; shard_id < m_shards.size(); ++shard_id) {
+        auto value = m_entries[shard_id].find(SAVED_TENSOR_SLICES_KEY);
+        FRONT_END_GENERAL_CHECK(value != m_entries[shard_id].end(),
+                                "[TensorFlow Frontend] incorrect input model: checkpoint file " +
+                                    m_shard_names[shard_id] + " does not contain SavedTensorSlices entry");
 
         // parse empty index block
         // This is only present at the first item of each checkpoint file and serves
         // as a table of contents, listing all the tensor slices saved in this file.
         ::tensorflow::SavedTensorSlices sts;
-        FRONT_END_GENERAL_CHECK(sts.ParseFromArray(value.data(), static_cast<int>(value.size())),
+        FRONT_END_GENERAL_CHECK(sts.ParseFromArray(value->second.data, static_cast<int>(value->second.size)),
                                 "[TensorFlow Frontend] incorrect input checkpoint file or internal error: cannot parse "
                                 "SavedTensorSlices entry");
         for (const auto& saved_slice_meta : sts.meta().tensor()) {
             // parse shapes and types for variables
             VariableInfo var_info;
-            var_info.shard_id = shard_ind;
+            var_info.shard_id = static_cast<int32_t>(shard_id);
             auto variable_name = saved_slice_meta.name();  // original variable name (not encoded)
             var_info.variable_shape = saved_slice_meta.shape();
             var_info.variable_type = saved_slice_meta.type();
 
             // save starts and lenghts of slices for variable name encoding
             for (const auto& slice : saved_slice_meta.slice()) {
-                // var_info.starts.push_back(slice.extent())
                 for (const auto& extent : slice.extent()) {
                     var_info.starts.push_back(extent.start());
                     if (extent.has_length()) {
@@ -97,165 +159,112 @@ void CheckpointV1Reader::initialize() {
     }
 }
 
-void CheckpointV1Reader::seek_block(const std::string& shard_name,
-                                    const std::string& target_key,
-                                    const char* block_ptr,
-                                    const uint32_t restarts,
-                                    std::string& value) const {
-    // parsing the next key starts at the end of value, so set value accordingly
-    const char* curr_value_pos = block_ptr;
-    const char* limit = block_ptr + restarts;  // restarts come right after data
-    std::string key = "";
-
-    bool is_found = false;
-    while (true) {
-        FRONT_END_GENERAL_CHECK(
-            curr_value_pos < limit,
-            "[TensorFlow Frontend] incorrect model: no more entries to return, invalid checkpoint file " + shard_name);
-
-        // decode next entry
-        // each entry looks as follows:
-        // | shared (1 byte) | non-shared (1 byte) | value_length (1 byte) | key (non-shared bytes) |
-        // | value (value_length bytes) |
-        uint32_t shared, non_shared, value_length;
-        curr_value_pos = decode_entry(curr_value_pos, limit, shared, non_shared, value_length);
-        FRONT_END_GENERAL_CHECK(
-            curr_value_pos && key.size() >= shared,
-            "[TensorFlow Frontend] incorrect model: corruption error in checkpoint file " + shard_name);
-
-        key.resize(shared);
-        key.append(curr_value_pos, non_shared);
-        value = std::string(curr_value_pos + non_shared, value_length);
-        curr_value_pos += (non_shared + value_length);
-
-        if (key.compare(target_key) >= 0) {
-            is_found = true;
-            break;
-        }
-    }
-    FRONT_END_GENERAL_CHECK(
-        is_found,
-        "[TensorFlow Frontend] incorrect input model: checkpoint file " + shard_name + " can be incorrect");
-}
-
-void CheckpointV1Reader::init_block(const std::shared_ptr<std::ifstream>& shard,
-                                    const std::string& shard_name,
-                                    uint64_t offset,
-                                    uint64_t size,
-                                    std::string& block,
-                                    uint64_t& restart_offset) const {
+CheckpointEntry CheckpointV1Reader::init_block(size_t shard_id,
+                                               uint64_t offset,
+                                               uint64_t size,
+                                               std::unique_ptr<std::string>& uncompressed_block) const {
     // check a size of the shard
-    FRONT_END_GENERAL_CHECK(shard,
-                            "[TensorFlow Frontend] internal error: nullptr pointer to checkpoint file " + shard_name);
-    shard->seekg(0, shard->end);
-    uint64_t shard_size = static_cast<uint64_t>(shard->tellg());
+    const auto& shard = m_shards[shard_id];
+    const auto& shard_name = m_shard_names[shard_id];
+    const uint64_t shard_size = static_cast<uint64_t>(shard->size());
     FRONT_END_GENERAL_CHECK(offset < shard_size,
                             "[TensorFlow Frontend] internal error or inconsistent checkpoint file: block offset is "
                             "out-of-range for checkpoint file " +
                                 shard_name);
-    auto n = size + BLOCK_TRAILER_SIZE;
-    FRONT_END_GENERAL_CHECK(n < (shard_size - offset),
+    // the sum of the size and the trailer may wrap around for a corrupted size
+    FRONT_END_GENERAL_CHECK(size <= shard_size - offset && BLOCK_TRAILER_SIZE <= shard_size - offset - size,
                             "[TensorFlow Frontend] internal error or inconsistent checkpoint file: block size is "
                             "out-of-range for checkpoint file " +
                                 shard_name);
 
-    // read a block and decompress if needed
-    std::vector<char> buf(n);
-    shard->seekg(offset);
-    shard->read(buf.data(), n);
+    // an uncompressed block is used right from the mapped shard
+    const char* data = shard->data() + offset;
+    CheckpointEntry block{data, static_cast<size_t>(size)};
 #ifndef ENABLE_SNAPPY_COMPRESSION
-    FRONT_END_GENERAL_CHECK(buf[size] == 0,
+    FRONT_END_GENERAL_CHECK(data[size] == 0,
                             "[TensorFlow Frontend] internal error: compression method for given block is not supported "
                             "for checkpoint file " +
                                 shard_name);
-    block = std::string(buf.data(), size);
 #else
-    FRONT_END_GENERAL_CHECK(buf[size] == 0 || buf[size] == 1,
+    FRONT_END_GENERAL_CHECK(data[size] == 0 || data[size] == 1,
                             "[TensorFlow Frontend] internal error: compression method for given block is not supported "
                             "for checkpoint file " +
                                 shard_name);
-    if (buf[size] == 1) {
-        size_t uncompressed_length = 0;
+    if (data[size] == 1) {
+        // validate the whole compressed stream before allocating the length claimed by its header
         FRONT_END_GENERAL_CHECK(
-            snappy::GetUncompressedLength(buf.data(), n, &uncompressed_length),
-            "[TensorFlow Frontend] internal error: cannot retrieve uncompressed block length for checkpoint file " +
-                shard_name);
-        std::string uncompressed_string;
-        block.clear();
-        block.reserve(uncompressed_length);
-        snappy::Uncompress(buf.data(), n, &block);
-    } else {
-        block = std::string(buf.data(), size);
+            snappy::IsValidCompressedBuffer(data, block.size),
+            "[TensorFlow Frontend] incorrect input model: corrupted compressed block in checkpoint file " + shard_name);
+        uncompressed_block.reset(new std::string());
+        FRONT_END_GENERAL_CHECK(
+            snappy::Uncompress(data, block.size, uncompressed_block.get()),
+            "[TensorFlow Frontend] internal error: cannot uncompress block for checkpoint file " + shard_name);
+        block = {uncompressed_block->data(), uncompressed_block->size()};
     }
 #endif
-    const char* data = block.data();
-    size = block.size();
 
     // find block characteristics: max_restarts_allowed, num_restarts and restart_offset
     FRONT_END_GENERAL_CHECK(
-        size >= sizeof(uint32_t),
+        block.size >= sizeof(uint32_t),
         "[TensorFlow Frontend] internal error: block size must be not less than 4 bytes in checkpoint file " +
             shard_name);
-    size_t max_restarts_allowed = (size - sizeof(uint32_t)) / sizeof(uint32_t);
-    uint32_t num_restarts = decode_fixed32(data + size - sizeof(uint32_t));
+    size_t max_restarts_allowed = (block.size - sizeof(uint32_t)) / sizeof(uint32_t);
+    uint32_t num_restarts = decode_fixed32(block.data + block.size - sizeof(uint32_t));
     FRONT_END_GENERAL_CHECK(
         num_restarts <= max_restarts_allowed,
         "[TensorFlow Frontend] internal error: num_restarts is greater than max_restarts_allowed in checkpoint file " +
             shard_name);
-    restart_offset = size - (1 + num_restarts) * sizeof(uint32_t);
+    // restarts come right after the entries
+    block.size -= (1 + num_restarts) * sizeof(uint32_t);
+    return block;
 }
 
-void CheckpointV1Reader::find_entry(const std::shared_ptr<std::ifstream>& shard,
-                                    const std::string& shard_name,
-                                    const std::string& entry_key,
-                                    std::string& entry_value) {
-    // read footer of the shard file to get offset and size of index block
-    VIFooter footer;
-    footer.read(*shard);
-    uint64_t block_offset = footer.m_index.m_offset;
-    uint64_t block_size = footer.m_index.m_size;
-    std::string block;
-
-    // initialize index block
-    uint64_t restart_offset = 0;
-    init_block(shard, shard_name, block_offset, block_size, block, restart_offset);
-
-    // seek entry in the index block
-    // this entry contains offset and size of the data block
-    seek_block(shard_name, entry_key, block.data(), static_cast<uint32_t>(restart_offset), entry_value);
+void CheckpointV1Reader::parse_block(size_t shard_id,
+                                     const CheckpointEntry& block,
+                                     std::vector<std::pair<std::string, CheckpointEntry>>& entries) const {
+    const char* curr_value_pos = block.data;
+    const char* limit = block.data + block.size;
+    std::string key = "";
 
-    // initialize the data block
-    FRONT_END_GENERAL_CHECK(
-        get_varint64(entry_value, &block_offset) && get_varint64(entry_value, &block_size),
-        "[TensorFlow Frontend] incorrect input model: bad block handle in checkpoint file " + shard_name);
-    init_block(shard, shard_name, block_offset, block_size, block, restart_offset);
+    while (curr_value_pos < limit) {
+        // decode next entry
+        // each entry looks as follows:
+        // | shared (1 byte) | non-shared (1 byte) | value_length (1 byte) | key (non-shared bytes) |
+        // | value (value_length bytes) |
+        uint32_t shared, non_shared, value_length;
+        curr_value_pos = decode_entry(curr_value_pos, limit, shared, non_shared, value_length);
+        FRONT_END_GENERAL_CHECK(
+            curr_value_pos && key.size() >= shared,
+            "[TensorFlow Frontend] incorrect model: corruption error in checkpoint file " + m_shard_names[shard_id]);
 
-    // seek the final entry in the data block
-    seek_block(shard_name, entry_key, block.data(), static_cast<uint32_t>(restart_offset), entry_value);
+        key.resize(shared);
+        key.append(curr_value_pos, non_shared);
+        entries.emplace_back(key, CheckpointEntry{curr_value_pos + non_shared, value_length});
+        curr_value_pos += (non_shared + value_length);
+    }
 }
 
-void CheckpointV1Reader::read_variable(const std::string& variable_name, ov::Any& data) {
-    FRONT_END_GENERAL_CHECK(m_variables_info_map.count(variable_name) > 0,
+void CheckpointV1Reader::read_variable(const std::string& variable_name, ov::Any& data) const {
+    auto var_info_it = m_variables_info_map.find(variable_name);
+    FRONT_END_GENERAL_CHECK(var_info_it != m_variables_info_map.end(),
                             "[TensorFlow Frontend] incorrect input model: checkpoint files does not contain data for "
                             "the required variable " +
                                 variable_name);
-    auto var_info = m_variables_info_map[variable_name];
-    auto shard_id = m_variables_info_map[variable_name].shard_id;
-    FRONT_END_GENERAL_CHECK(shard_id < static_cast<int32_t>(m_shards.size()),
+    const auto& var_info = var_info_it->second;
+    auto shard_id = var_info.shard_id;
+    FRONT_END_GENERAL_CHECK(shard_id < static_cast<int32_t>(m_entries.size()),
                             "[TensorFlow Frontend] internal error: shard_id is greater than a number of shards");
-    FRONT_END_GENERAL_CHECK(
-        m_shards.size() == m_shard_names.size(),
-        "[TensorFlow Frontend] internal error: number of shards does not match a number of their names");
-    auto shard_ptr = m_shards[shard_id];
-    auto shard_name = m_shard_names[shard_id];
+    const auto& shard_entries = m_entries[shard_id];
     auto encoded_name = encode_tensor_name_slice(variable_name, var_info.starts, var_info.lenghts);
-    std::string raw_data;
-    find_entry(shard_ptr, shard_name, encoded_name, raw_data);
+    auto entry = shard_entries.find(encoded_name);
+    FRONT_END_GENERAL_CHECK(entry != shard_entries.end(),
+                            "[TensorFlow Frontend] incorrect input model: checkpoint file " + m_shard_names[shard_id] +
+                                " does not contain data for the variable " + variable_name);
 
     // This is only present at the first item of each checkpoint file and serves
     // as a table of contents, listing all the tensor slices saved in this file.
     ::tensorflow::SavedTensorSlices sts;
-    FRONT_END_GENERAL_CHECK(sts.ParseFromArray(raw_data.data(), static_cast<int>(raw_data.size())),
+    FRONT_END_GENERAL_CHECK(sts.ParseFromArray(entry->second.data, static_cast<int>(entry->second.size)),
                             "[TensorFlow Frontend] incorrect input checkpoint file or internal error: cannot parse "
                             "SavedTensorSlices entry");
     data = unpack_tensor_proto(sts.data().data(), var_info.variable_shape, var_info.variable_type);
@@ -6,12 +6,14 @@
 
 #include <sys/stat.h>
 
+#include <memory>
 #include <unordered_map>
 #include <vector>
 
 #include "checkpoint_utils.hpp"
 #include "openvino/core/any.hpp"
 #include "openvino/frontend/exception.hpp"
+#include "openvino/util/mmap_object.hpp"
 #include "saved_tensor_slice.pb.h"
 #include "tensor_shape.pb.h"
 #include "types.pb.h"
@@ -30,16 +32,28 @@ struct VariableInfo {
     std::vector<int64_t> lenghts;
 };
 
+// a serialized value of the checkpoint table entry, it points either into the mapped shard
+// or into the decompressed copy of its block
+struct CheckpointEntry {
+    const char* data;
+    size_t size;
+};
+
 // reads checkpoints of v1 version
 // it parses value, shape and type for Variable nodes
 class CheckpointV1Reader {
     const std::string m_checkpoints;
     // a map from Variable name to its informations
     std::unordered_map<std::string, VariableInfo> m_variables_info_map;
-    // a vector of streams for shards, where shard is one checkpoint file
-    std::vector<std::shared_ptr<std::ifstream>> m_shards;
+    // a vector of mapped shards, where shard is one checkpoint file
+    std::vector<std::shared_ptr<ov::MappedMemory>> m_shards;
     // a vector of shard names
     std::vector<std::string> m_shard_names;
+    // a vector of tables (one per shard) from an encoded tensor slice name to its serialized value,
+    // the shards are parsed once so reading a variable is a lookup without any I/O
+    std::vector<std::unordered_map<std::string, CheckpointEntry>> m_entries;
+    // decompressed data blocks referenced by the entries
+    std::vector<std::unique_ptr<std::string>> m_uncompressed_blocks;
 
 public:
     /// \brief constructs CheckpointV1Reader for a given directory of checkpoint files
@@ -51,29 +65,23 @@ public:
 
     /// \brief Produces ov::Any object that wraps ov::Tensor for the requested variable
     /// it can also wraps string tensor
+    /// The method is thread safe, so independent variables can be read in parallel
     /// \param variable_name the requested variable name
     /// \param a reference to the result
-    void read_variable(const std::string& variable_name, ov::Any& data);
+    void read_variable(const std::string& variable_name, ov::Any& data) const;
 
 private:
-    /// \brief finds non-master key entry that uses already cached offset and sizes of data blocks
-    void find_entry(const std::shared_ptr<std::ifstream>& shard,
-                    const std::string& shard_name,
-                    const std::string& entry_key,
-                    std::string& value);
-
-    void seek_block(const std::string& shard_name,
-                    const std::string& target,
-                    const char* shard_data,
-                    const uint32_t restarts,
-                    std::string& value) const;
+    /// \brief returns the entries of the block (without restarts and trailer), a decompressed block
+    /// is stored in uncompressed_block
+    CheckpointEntry init_block(size_t shard_id,
+                               uint64_t offset,
+                               uint64_t size,
+                               std::unique_ptr<std::string>& uncompressed_block) const;
 
-    void init_block(const std::shared_ptr<std::ifstream>& shard,
-                    const std::string& shard_name,
-                    uint64_t offset,
-                    uint64_t size,
-                    std::string& block,
-                    uint64_t& restart_offset) const;
+    /// \brief decodes all key-value entries of the block
+    void parse_block(size_t shard_id,
+                     const CheckpointEntry& block,
+                     std::vector<std::pair<std::string, CheckpointEntry>>& entries) const;
 };
 
 }  // namespace tensorflow
@@ -82,7 +82,8 @@ void VariablesIndex::read_variables_index_pair(char*& ptr,
     ptr = value + val_length;
 }
 
-void VariablesIndex::read_variables_index(std::ifstream& fs, std::map<std::string, std::vector<char>>& varIndex) {
+void VariablesIndex::read_variables_index(std::ifstream& fs,
+                                          std::unordered_map<std::string, std::vector<char>>& varIndex) {
     fs.seekg(0, std::ios::end);
     m_variables_index_size = fs.tellg();
 
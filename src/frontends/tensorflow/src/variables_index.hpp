@@ -5,6 +5,7 @@
 #pragma once
 
 #include <map>
+#include <unordered_map>
 
 #include "graph_iterator_proto.hpp"
 #include "openvino/util/file_util.hpp"
@@ -29,7 +30,7 @@ class VariablesIndex {
     // Contains maximum amount of shards, used for creating corrext extension
     int32_t m_total_shards;
     // Contains BundleEntryProto variables list, readed from .index file
-    std::map<std::string, std::vector<char>> m_variables_index;
+    std::unordered_map<std::string, std::vector<char>> m_variables_index;
     // List of opened data files for using with BundleEntryProto
     std::map<int32_t, VariableStorage> m_data_files;
     // List of mapped variables which could be read using TrackableObjectGraph
@@ -168,7 +169,7 @@ private:
     /// \brief Reads .index file and stores key=value map in provided varIndex
     /// \param[in,out] fs Filestream should be parsed. Position in file will be updated
     /// \param[out] varIndex Variables indx (key=value) from given filestream
-    void read_variables_index(std::ifstream& fs, std::map<std::string, std::vector<char>>& varIndex);
+    void read_variables_index(std::ifstream& fs, std::unordered_map<std::string, std::vector<char>>& varIndex);
     /// \brief Reads bundle header if it is available. Checks version and saves info about amount of shards
     void read_bundle_header();
     /// \brief Reads key=value map from storef _CHECKPOINTABLE_OBJECT_GRAPH variable
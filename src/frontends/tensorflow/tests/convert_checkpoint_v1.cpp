@@ -0,0 +1,347 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <openvino/frontend/manager.hpp>
+#include <openvino/opsets/opset10.hpp>
+
+#include "common_test_utils/file_utils.hpp"
+#include "common_test_utils/test_common.hpp"
+#include "conversion_with_reference.hpp"
+#include "gtest/gtest.h"
+#include "tf_utils.hpp"
+#include "utils.hpp"
+
+#ifdef ENABLE_SNAPPY_COMPRESSION
+#    include "snappy.h"
+#endif
+
+using namespace std;
+using namespace ov;
+using namespace ov::opset10;
+using namespace ov::frontend;
+using namespace ov::frontend::tensorflow::tests;
+
+namespace {
+// the checkpoint is saved with one shard per device, each shard keeps one variable
+const vector<string> shard_names = {"model.ckpt-00000-of-00002", "model.ckpt-00001-of-00002"};
+constexpr size_t footer_size = 48;
+
+string get_model_path() {
+    return FrontEndTestUtils::make_model_path(string(TEST_TENSORFLOW_MODELS_DIRNAME) +
+                                              "checkpoint_v1_sharded/model.pbtxt");
+}
+
+string get_checkpoints_dir() {
+    return FrontEndTestUtils::make_model_path(string(TEST_TENSORFLOW_MODELS_DIRNAME) +
+                                              "checkpoint_v1_sharded/checkpoints");
+}
+
+shared_ptr<Model> convert_model_with_checkpoints(const string& checkpoints_dir) {
+    FrontEndManager fem;
+    auto front_end = fem.load_by_framework(TF_FE);
+    if (!front_end) {
+        throw "TensorFlow Frontend is not initialized";
+    }
+    auto input_model = front_end->load(vector<string>{get_model_path(), checkpoints_dir});
+    if (!input_model) {
+        throw "Input model is not read";
+    }
+    return front_end->convert(input_model);
+}
+
+string read_file(const string& path) {
+    ifstream stream(path, ios::binary);
+    return string(istreambuf_iterator<char>(stream), istreambuf_iterator<char>());
+}
+
+void write_file(const string& path, const string& content) {
+    ofstream stream(path, ios::binary);
+    stream.write(content.data(), content.size());
+}
+
+// helpers to read and write the table format of checkpoint shards:
+// https://github.com/google/leveldb/blob/main/doc/table_format.md
+uint64_t get_varint(const string& data, size_t& pos) {
+    uint64_t value = 0;
+    for (uint32_t shift = 0; pos < data.size(); shift += 7) {
+        auto byte = static_cast<uint8_t>(data[pos++]);
+        value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+        if (!(byte & 0x80))
+            break;
+    }
+    return value;
+}
+
+void put_varint(string& data, uint64_t value) {
+    for (; value >= 0x80; value >>= 7) {
+        data.push_back(static_cast<char>(value | 0x80));
+    }
+    data.push_back(static_cast<char>(value));
+}
+
+void put_fixed32(string& data, uint32_t value) {
+    for (size_t i = 0; i < sizeof(value); ++i) {
+        data.push_back(static_cast<char>(value >> (8 * i)));
+    }
+}
+
+// reads the key-value entries of an uncompressed block
+vector<pair<string, string>> read_block(const string& table, uint64_t offset, uint64_t size) {
+    const auto block = table.substr(offset, size);
+    uint32_t num_restarts = 0;
+    memcpy(&num_restarts, block.data() + block.size() - sizeof(num_restarts), sizeof(num_restarts));
+    const auto entries_size = block.size() - (1 + num_restarts) * sizeof(uint32_t);
+
+    vector<pair<string, string>> entries;
+    string key;
+    for (size_t pos = 0; pos < entries_size;) {
+        auto shared = get_varint(block, pos);
+        auto non_shared = get_varint(block, pos);
+        auto value_length = get_varint(block, pos);
+        key = key.substr(0, shared) + block.substr(pos, non_shared);
+        entries.emplace_back(key, block.substr(pos + non_shared, value_length));
+        pos += non_shared + value_length;
+    }
+    return entries;
+}
+
+// reads all entries of the data blocks of an uncompressed table
+vector<pair<string, string>> read_table(const string& table) {
+    size_t pos = table.size() - footer_size;
+    // skip the handle of the meta index block
+    get_varint(table, pos);
+    get_varint(table, pos);
+    auto index_offset = get_varint(table, pos);
+    auto index_size = get_varint(table, pos);
+
+    vector<pair<string, string>> entries;
+    for (const auto& index_entry : read_block(table, index_offset, index_size)) {
+        size_t handle_pos = 0;
+        auto data_offset = get_varint(index_entry.second, handle_pos);
+        auto data_size = get_varint(index_entry.second, handle_pos);
+        auto data_entries = read_block(table, data_offset, data_size);
+        entries.insert(entries.end(), data_entries.begin(), data_entries.end());
+    }
+    return entries;
+}
+
+// makes a block with a single restart point, so no key shares a prefix with the previous one
+string make_block(const vector<pair<string, string>>& entries) {
+    string block;
+    for (const auto& entry : entries) {
+        put_varint(block, 0);
+        put_varint(block, entry.first.size());
+        put_varint(block, entry.second.size());
+        block += entry.first + entry.second;
+    }
+    put_fixed32(block, 0);
+    put_fixed32(block, 1);
+    return block;
+}
+
+// makes a table with a data block for each given block contents,
+// the stored data blocks can be modified by `corrupt` after the compression
+string make_table(const vector<string>& data_blocks,
+                  bool compress,
+                  const function<void(string&)>& corrupt = nullptr) {
+    string table;
+    auto append_block = [&](const string& contents, bool is_data_block) {
+        string stored = contents;
+        char compression_type = 0;
+        if (compress) {
+#ifdef ENABLE_SNAPPY_COMPRESSION
+            stored.clear();
+            snappy::Compress(contents.data(), contents.size(), &stored);
+            compression_type = 1;
+#endif
+        }
+        if (is_data_block && corrupt) {
+            corrupt(stored);
+        }
+        string handle;
+        put_varint(handle, table.size());
+        put_varint(handle, stored.size());
+        // the checksum is not verified by the reader
+        table += stored;
+        table.push_back(compression_type);
+        put_fixed32(table, 0);
+        return handle;
+    };
+
+    vector<pair<string, string>> index_entries;
+    for (size_t i = 0; i < data_blocks.size(); ++i) {
+        index_entries.emplace_back(to_string(i), append_block(data_blocks[i], true));
+    }
+    auto meta_index_handle = append_block(make_block({}), false);
+    auto index_handle = append_block(make_block(index_entries), false);
+
+    string footer = meta_index_handle + index_handle;
+    footer.resize(footer_size - 8, 0);
+    put_fixed32(footer, 0x8b80fb57);
+    put_fixed32(footer, 0xdb477524);
+    return table + footer;
+}
+
+class CheckpointV1Test : virtual public ::testing::Test {
+protected:
+    void SetUp() override {
+        m_dir = ov::test::utils::generateTestFilePrefix() + "_checkpoint_v1";
+        ov::test::utils::createDirectory(m_dir);
+    }
+
+    void TearDown() override {
+        for (const auto& shard_name : shard_names) {
+            ov::test::utils::removeFile(ov::test::utils::makePath(m_dir, shard_name));
+        }
+        ov::test::utils::removeDir(m_dir);
+    }
+
+    void write_shard(size_t shard_id, const string& content) {
+        write_file(ov::test::utils::makePath(m_dir, shard_names[shard_id]), content);
+    }
+
+    string m_dir;
+};
+
+shared_ptr<Model> make_reference_model() {
+    auto x = make_shared<Parameter>(element::f32, Shape{2, 3});
+    auto w1 = make_shared<Constant>(element::f32, Shape{2, 3}, vector<float>{1, 2, 3, 4, 5, 6});
+    auto w2 = make_shared<Constant>(element::f32, Shape{2, 3}, vector<float>{2, 2, 2, 0.5, 0.5, 0.5});
+    auto add = make_shared<Add>(x, w1);
+    auto mul = make_shared<Multiply>(add, w2);
+    return make_shared<Model>(OutputVector{mul}, ParameterVector{x});
+}
+}  // namespace
+
+TEST_F(FrontEndConversionWithReferenceTestsF, CheckpointV1Sharded) {
+    for (const auto& shard_name : shard_names) {
+        ASSERT_TRUE(ov::test::utils::fileExists(ov::test::utils::makePath(get_checkpoints_dir(), shard_name)));
+    }
+    model = convert_model_with_checkpoints(get_checkpoints_dir());
+    model_ref = make_reference_model();
+}
+
+#ifdef ENABLE_SNAPPY_COMPRESSION
+class CheckpointV1CompressedTest : public FrontEndConversionWithReferenceTestsF, public CheckpointV1Test {
+protected:
+    void SetUp() override {
+        FrontEndConversionWithReferenceTestsF::SetUp();
+        CheckpointV1Test::SetUp();
+    }
+
+    void TearDown() override {
+        FrontEndConversionWithReferenceTestsF::TearDown();
+        CheckpointV1Test::TearDown();
+    }
+};
+
+TEST_F(CheckpointV1CompressedTest, SnappyCompressedBlocks) {
+    // rewrite each shard with a separate snappy compressed data block for each entry
+    for (size_t shard_id = 0; shard_id < shard_names.size(); ++shard_id) {
+        auto table = read_file(ov::test::utils::makePath(get_checkpoints_dir(), shard_names[shard_id]));
+        vector<string> data_blocks;
+        for (const auto& entry : read_table(table)) {
+            data_blocks.push_back(make_block({entry}));
+        }
+        ASSERT_GT(data_blocks.size(), 1);
+        write_shard(shard_id, make_table(data_blocks, true));
+    }
+    model = convert_model_with_checkpoints(m_dir);
+    model_ref = make_reference_model();
+}
+
+TEST_F(CheckpointV1Test, CorruptedCompressedBlock) {
+    auto table = read_file(ov::test::utils::makePath(get_checkpoints_dir(), shard_names[0]));
+    vector<string> data_blocks;
+    for (const auto& entry : read_table(table)) {
+        data_blocks.push_back(make_block({entry}));
+    }
+    // the compressed stream claims the uncompressed length of 4GB
+    write_shard(0, make_table(data_blocks, true, [](string& stored) {
+                    size_t pos = 0;
+                    get_varint(stored, pos);
+                    string header;
+                    put_varint(header, 0xffffffff);
+                    stored = header + stored.substr(pos);
+                }));
+    EXPECT_THROW(convert_model_with_checkpoints(m_dir), ov::Exception);
+
+    // the compressed stream is truncated
+    write_shard(0, make_table(data_blocks, true, [](string& stored) {
+                    stored.resize(stored.size() / 2);
+                }));
+    EXPECT_THROW(convert_model_with_checkpoints(m_dir), ov::Exception);
+}
+#endif
+
+TEST_F(CheckpointV1Test, TruncatedShard) {
+    auto table = read_file(ov::test::utils::makePath(get_checkpoints_dir(), shard_names[0]));
+
+    // the footer is lost
+    write_shard(0, table.substr(0, table.size() / 2));
+    EXPECT_THROW(convert_model_with_checkpoints(m_dir), ov::Exception);
+
+    // the blocks are lost, the footer refers to out-of-range blocks
+    write_shard(0, table.substr(table.size() - footer_size));
+    EXPECT_THROW(convert_model_with_checkpoints(m_dir), ov::Exception);
+
+    // the file is empty
+    write_shard(0, "");
+    EXPECT_THROW(convert_model_with_checkpoints(m_dir), ov::Exception);
+}
+
+TEST_F(CheckpointV1Test, CorruptedShard) {
+    auto table = read_file(ov::test::utils::makePath(get_checkpoints_dir(), shard_names[0]));
+    vector<string> data_blocks;
+    for (const auto& entry : read_table(table)) {
+        data_blocks.push_back(make_block({entry}));
+    }
+
+    // the size of the index block wraps around with the block trailer
+    {
+        auto corrupted = make_table(data_blocks, false);
+        string footer;
+        put_varint(footer, 0);
+        put_varint(footer, 0);
+        put_varint(footer, 0);
+        put_varint(footer, numeric_limits<uint64_t>::max() - 2);
+        footer.resize(footer_size - 8, 0);
+        copy(footer.begin(), footer.end(), corrupted.end() - footer_size);
+        write_shard(0, corrupted);
+        EXPECT_THROW(convert_model_with_checkpoints(m_dir), ov::Exception);
+    }
+
+    // the number of restart points exceeds the block size
+    {
+        auto block = make_block({{"key", "value"}});
+        block.resize(block.size() - sizeof(uint32_t));
+        put_fixed32(block, 0xffffffff);
+        write_shard(0, make_table({block}, false));
+        EXPECT_THROW(convert_model_with_checkpoints(m_dir), ov::Exception);
+    }
+
+    // the lengths of the entry key and value wrap around in 32 bits
+    {
+        string block;
+        put_varint(block, 0);
+        put_varint(block, 0x80000000);
+        put_varint(block, 0x80000000);
+        block += "key";
+        put_fixed32(block, 0);
+        put_fixed32(block, 1);
+        write_shard(0, make_table({block}, false));
+        EXPECT_THROW(convert_model_with_checkpoints(m_dir), ov::Exception);
+    }
+
+    // the data block is not the table of contents of the variables
+    {
+        write_shard(0, make_table({make_block({{"", "not a proto"}})}, false));
+        EXPECT_THROW(convert_model_with_checkpoints(m_dir), ov::Exception);
+    }
+}
@@ -0,0 +1,51 @@
+# Copyright (C) 2023 Intel Corporation
+# SPDX-License-Identifier: Apache-2.0
+
+import os
+import sys
+
+import tensorflow as tf
+
+w1_value = [[1., 2., 3.], [4., 5., 6.]]
+w2_value = [[2., 2., 2.], [0.5, 0.5, 0.5]]
+
+model_dir = os.path.join(sys.argv[1], "checkpoint_v1_sharded")
+checkpoints_dir = os.path.join(model_dir, "checkpoints")
+os.makedirs(checkpoints_dir)
+
+# save the variables into v1 checkpoint with one shard per device
+with tf.Graph().as_default():
+    with tf.device('/cpu:0'):
+        w1 = tf.compat.v1.Variable(w1_value, name='w1', use_resource=False)
+    with tf.device('/cpu:1'):
+        w2 = tf.compat.v1.Variable(w2_value, name='w2', use_resource=False)
+    saver = tf.compat.v1.train.Saver([w1, w2], sharded=True, write_version=tf.compat.v1.train.SaverDef.V1)
+    config = tf.compat.v1.ConfigProto(device_count={'CPU': 2})
+    with tf.compat.v1.Session(config=config) as sess:
+        sess.run(tf.compat.v1.global_variables_initializer())
+        saver.save(sess, os.path.join(checkpoints_dir, "model.ckpt"), write_meta_graph=False, write_state=False)
+
+
+# the model restores its variables from the checkpoint by legacy Variable operations
+def make_node(graph_def, name, op, inputs=[]):
+    node = graph_def.node.add()
+    node.name = name
+    node.op = op
+    node.input.extend(inputs)
+    return node
+
+
+graph_def = tf.compat.v1.GraphDef()
+x = make_node(graph_def, 'x', 'Placeholder')
+x.attr['dtype'].type = tf.float32.as_datatype_enum
+x.attr['shape'].shape.CopyFrom(tf.TensorShape([2, 3]).as_proto())
+for var_name in ['w1', 'w2']:
+    var = make_node(graph_def, var_name, 'Variable')
+    var.attr['dtype'].type = tf.float32.as_datatype_enum
+    var.attr['shape'].shape.CopyFrom(tf.TensorShape([2, 3]).as_proto())
+add = make_node(graph_def, 'add', 'Add', ['x', 'w1'])
+add.attr['T'].type = tf.float32.as_datatype_enum
+mul = make_node(graph_def, 'mul', 'Mul', ['add', 'w2'])
+mul.attr['T'].type = tf.float32.as_datatype_enum
+
+tf.io.write_graph(graph_def, model_dir, "model.pbtxt", as_text=True)
@@ -9,6 +9,7 @@
 #include "openvino/core/any.hpp"
 #include "openvino/frontend/exception.hpp"
 #include "openvino/util/file_util.hpp"
+#include "openvino/util/mmap_object.hpp"
 #include "schema_generated.h"
 
 namespace ov {
@@ -24,6 +25,8 @@ struct TensorInfo {
 class GraphIteratorFlatBuffer {
     size_t node_index = 0;
     std::vector<uint8_t> m_data;
+    // the constants of the model reference the mapped file directly, so it must live while they are in use
+    std::shared_ptr<ov::MappedMemory> m_mapped_memory;
     std::vector<ov::Any> m_nodes;
     const tflite::Model* m_model{};
     std::vector<const tflite::SubGraph*> m_subgraphs;
@@ -31,10 +34,10 @@ class GraphIteratorFlatBuffer {
 
 public:
     GraphIteratorFlatBuffer() = default;
-    explicit GraphIteratorFlatBuffer(const std::string& path);
+    explicit GraphIteratorFlatBuffer(const std::string& path, bool mmap_enabled = true);
 
 #ifdef OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
-    explicit GraphIteratorFlatBuffer(const std::wstring& path);
+    explicit GraphIteratorFlatBuffer(const std::wstring& path, bool mmap_enabled = true);
 #endif
 
     using Ptr = std::shared_ptr<GraphIteratorFlatBuffer>;
@@ -59,6 +62,11 @@ public:
         return node_index >= m_nodes.size();
     }
 
+    /// \brief Returns the memory mapping of the model file, nullptr if mmap is disabled
+    const std::shared_ptr<ov::MappedMemory>& get_mapped_memory() const {
+        return m_mapped_memory;
+    }
+
     /// Return Decoder for the current node that iterator points to
     std::shared_ptr<ov::frontend::tensorflow_lite::DecoderFlatBuffer> get_decoder() const;
 
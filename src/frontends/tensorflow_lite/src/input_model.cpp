@@ -7,6 +7,7 @@
 #include <iterator>
 #include <queue>
 
+#include "ngraph/runtime/shared_buffer.hpp"
 #include "openvino/frontend/exception.hpp"
 #include "openvino/opsets/opset10.hpp"
 #include "openvino/util/log.hpp"
@@ -64,6 +65,9 @@ public:
 private:
     void load_model();
     void clean_up();
+    std::shared_ptr<ov::op::v0::Constant> create_constant(const ov::element::Type& type,
+                                                          const ov::Shape& shape,
+                                                          const void* data) const;
 
     std::vector<std::shared_ptr<OpPlace>> m_op_places;
     std::map<std::string, std::shared_ptr<OpPlace>> m_op_places_map;
@@ -78,6 +82,29 @@ private:
     std::shared_ptr<TelemetryExtension> m_telemetry;
 };
 
+std::shared_ptr<ov::op::v0::Constant> InputModel::InputModelTFLiteImpl::create_constant(const ov::element::Type& type,
+                                                                                       const ov::Shape& shape,
+                                                                                       const void* data) const {
+    const auto& mapped_memory = m_graph_iterator->get_mapped_memory();
+    if (!mapped_memory)
+        return ov::op::v0::Constant::create(type, shape, data);
+
+    // the buffer is a part of the mapped model file, so the constant shares it instead of copying
+    const auto begin = static_cast<const char*>(data);
+    const auto size = ov::shape_size(shape) * type.size();
+    const auto mapped_end = mapped_memory->data() + mapped_memory->size();
+    FRONT_END_GENERAL_CHECK(begin >= mapped_memory->data() && begin + size <= mapped_end,
+                            "Constant data is out of bounds of the model file");
+    OPENVINO_SUPPRESS_DEPRECATED_START
+    return std::make_shared<ov::op::v0::Constant>(
+        type,
+        shape,
+        std::make_shared<ngraph::runtime::SharedBuffer<std::shared_ptr<ov::MappedMemory>>>(const_cast<char*>(begin),
+                                                                                           size,
+                                                                                           mapped_memory));
+    OPENVINO_SUPPRESS_DEPRECATED_END
+}
+
 void InputModel::InputModelTFLiteImpl::load_model() {
     std::map<std::string, uint64_t> op_statistics;  // for telemetry
 
@@ -110,9 +137,8 @@ void InputModel::InputModelTFLiteImpl::load_model() {
             if (m_tensor_places.count(name) == 0) {
                 m_tensor_places[name] = place;
                 if (auto data = place->get_data()) {
-                    auto constant = ov::op::v0::Constant::create(place->get_element_type(),
-                                                                 place->get_partial_shape().to_shape(),
-                                                                 data);
+                    auto constant =
+                        create_constant(place->get_element_type(), place->get_partial_shape().to_shape(), data);
                     constant->set_friendly_name(name);
                     m_tensor_values[name] = constant;
                 } else if (place->get_partial_shape() == PartialShape{0}) {  // empty constant
@@ -4,7 +4,9 @@
 
 #include "convert_model.hpp"
 
+#include "openvino/op/constant.hpp"
 #include "tf_utils.hpp"
+#include "utils.hpp"
 
 using namespace ov::frontend;
 
@@ -20,3 +22,36 @@ INSTANTIATE_TEST_SUITE_P(TFLiteConvertModelTest,
                                             ::testing::Values(std::string(TEST_TENSORFLOW_LITE_MODELS_DIRNAME)),
                                             ::testing::ValuesIn(models)),
                          FrontEndConvertModelTest::getTestCaseName);
+
+TEST(TFLiteConvertModelTest, mmap_and_read_constants_are_equal) {
+    FrontEndManager fem;
+    auto front_end = fem.load_by_framework(TF_LITE_FE);
+    ASSERT_NE(front_end, nullptr);
+    auto model_filename =
+        FrontEndTestUtils::make_model_path(std::string(TEST_TENSORFLOW_LITE_MODELS_DIRNAME) + "2in_2out/2in_2out.tflite");
+
+    std::shared_ptr<ov::Model> mmap_model, read_model;
+    ASSERT_NO_THROW(mmap_model = front_end->convert(front_end->load({model_filename, true})));
+    ASSERT_NO_THROW(read_model = front_end->convert(front_end->load({model_filename, false})));
+
+    auto get_constants = [](const std::shared_ptr<ov::Model>& model) {
+        std::vector<std::shared_ptr<ov::op::v0::Constant>> constants;
+        for (const auto& op : model->get_ordered_ops()) {
+            if (auto constant = ov::as_type_ptr<ov::op::v0::Constant>(op))
+                constants.push_back(constant);
+        }
+        return constants;
+    };
+    const auto mmap_constants = get_constants(mmap_model);
+    const auto read_constants = get_constants(read_model);
+    ASSERT_FALSE(mmap_constants.empty());
+    ASSERT_EQ(mmap_constants.size(), read_constants.size());
+    for (size_t i = 0; i < mmap_constants.size(); i++) {
+        ASSERT_EQ(mmap_constants[i]->get_element_type(), read_constants[i]->get_element_type());
+        ASSERT_EQ(mmap_constants[i]->get_shape(), read_constants[i]->get_shape());
+        ASSERT_EQ(0,
+                  memcmp(mmap_constants[i]->get_data_ptr(),
+                         read_constants[i]->get_data_ptr(),
+                         mmap_constants[i]->get_byte_size()));
+    }
+}
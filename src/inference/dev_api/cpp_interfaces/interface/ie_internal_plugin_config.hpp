@@ -88,6 +88,49 @@ INFERENCE_ENGINE_1_0_DEPRECATED DECLARE_CONFIG_KEY(SMALL_CORE_OFFSET);
  */
 INFERENCE_ENGINE_1_0_DEPRECATED DECLARE_CONFIG_KEY(CPU_RUNTIME_CACHE_CAPACITY);
 
+/**
+ * @brief Defines the scope of the CPU runtime parameters cache
+ *      @param PER_STREAM - default, each stream has its own cache
+ *      @param PER_MODEL - all the streams of a compiled model share one thread safe cache
+ *      @param PER_PLUGIN - all the compiled models of the plugin share one thread safe cache
+ *      Only the reentrant executors (oneDNN primitives) are shared, the rest of them are cached by each stream.
+ * @ingroup ie_dev_api_plugin_api
+ */
+INFERENCE_ENGINE_1_0_DEPRECATED DECLARE_CONFIG_KEY(CPU_RUNTIME_CACHE_SHARING);
+INFERENCE_ENGINE_1_0_DEPRECATED DECLARE_CONFIG_VALUE(PER_STREAM);
+INFERENCE_ENGINE_1_0_DEPRECATED DECLARE_CONFIG_VALUE(PER_MODEL);
+INFERENCE_ENGINE_1_0_DEPRECATED DECLARE_CONFIG_VALUE(PER_PLUGIN);
+
+/**
+ * @brief Enables persistence of the input shapes inferred by a CPU compiled model with dynamic shapes in the model cache
+ * directory. The next compilation of the same model prepares the nodes for all the stored shapes in advance.
+ * @ingroup ie_dev_api_plugin_api
+ */
+INFERENCE_ENGINE_1_0_DEPRECATED DECLARE_CONFIG_KEY(CPU_DYNAMIC_SHAPES_HISTORY);
+
+/**
+ * @brief Enables dataflow execution of static CPU graphs: independent nodes are dispatched to the worker threads
+ * of the stream as soon as all their dependencies are executed
+ * @ingroup ie_dev_api_plugin_api
+ */
+INFERENCE_ENGINE_1_0_DEPRECATED DECLARE_CONFIG_KEY(CPU_PARALLEL_GRAPH_EXECUTION);
+
+/**
+ * @brief Enables sharing of the memory arenas for the intermediate tensors between the streams of a CPU compiled model:
+ * an arena is leased from the compiled model pool for the time of the inference, so the memory consumption follows
+ * the number of the concurrently executed inferences rather than the number of the streams
+ * @ingroup ie_dev_api_plugin_api
+ */
+INFERENCE_ENGINE_1_0_DEPRECATED DECLARE_CONFIG_KEY(CPU_ACTIVATION_ARENA_SHARING);
+
+/**
+ * @brief Expected maximum length of the CPU variable states growing along the concatenation axis on each inference
+ * (e.g. the KV cache of an autoregressive model): the capacity for the whole length is reserved on the first
+ * append, so the state is never reallocated. Zero means the capacity grows as needed.
+ * @ingroup ie_dev_api_plugin_api
+ */
+INFERENCE_ENGINE_1_0_DEPRECATED DECLARE_CONFIG_KEY(CPU_STATE_MAX_LENGTH_HINT);
+
 /**
  * @brief Internal device id for particular device (like GPU.0, GPU.1 etc)
  */
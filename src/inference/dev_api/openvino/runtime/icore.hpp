@@ -9,7 +9,10 @@
 
 #pragma once
 
+#include <functional>
+#include <istream>
 #include <memory>
+#include <ostream>
 
 #include "openvino/runtime/icompiled_model.hpp"
 #include "openvino/runtime/properties.hpp"
@@ -231,6 +234,30 @@ public:
 
     virtual bool device_supports_model_caching(const std::string& device_name) const = 0;
 
+    /**
+     * @brief Writes an auxiliary entry to the model cache of the device, e.g. data a plugin collects about a compiled
+     * model at runtime to reuse it on the next compilation of the same model
+     * @param device_name Name of the device whose model cache is used
+     * @param id Id of the entry, it must not collide with the ids of the cached models (see
+     * ov::internal::cache_entry_id)
+     * @param writer Callback writing the entry content
+     * @return false if model caching is not enabled for the device
+     */
+    virtual bool write_cache_entry(const std::string& device_name,
+                                   const std::string& id,
+                                   const std::function<void(std::ostream&)>& writer) const;
+
+    /**
+     * @brief Reads an auxiliary entry written by write_cache_entry
+     * @param device_name Name of the device whose model cache is used
+     * @param id Id of the entry
+     * @param reader Callback reading the entry content, it is not called if the entry does not exist
+     * @return false if model caching is not enabled for the device
+     */
+    virtual bool read_cache_entry(const std::string& device_name,
+                                  const std::string& id,
+                                  const std::function<void(std::istream&)>& reader) const;
+
     /**
      * @brief Default virtual destructor
      */
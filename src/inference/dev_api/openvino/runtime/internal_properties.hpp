@@ -43,6 +43,14 @@ static constexpr Property<bool, PropertyMutability::RW> exclusive_async_requests
  */
 static constexpr Property<std::string, PropertyMutability::WO> config_device_id{"CONFIG_DEVICE_ID"};
 
+/**
+ * @brief Id of the model cache entry of the compiled or imported model. When model caching is enabled, the core passes
+ * it to the plugins which report it in ov::internal::supported_properties, so a plugin may keep its own data along with
+ * the entry via ov::ICore::write_cache_entry and ov::ICore::read_cache_entry
+ * @ingroup ov_dev_api_plugin_api
+ */
+static constexpr Property<std::string, PropertyMutability::WO> cache_entry_id{"CACHE_ENTRY_ID"};
+
 /**
  * @brief The name for setting CPU affinity per thread option.
  *
@@ -0,0 +1,37 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief Input stream over the memory mapped file
+ * @file openvino/runtime/mapped_memory_stream.hpp
+ */
+
+#pragma once
+
+#include <istream>
+#include <memory>
+
+#include "openvino/runtime/common.hpp"
+#include "openvino/util/mmap_object.hpp"
+
+namespace ov {
+
+/**
+ * @brief Creates a read-only input stream over the mapped memory. The stream keeps the mapping alive.
+ * @param memory Mapped memory
+ * @return Input stream reading the mapped memory
+ */
+OPENVINO_RUNTIME_API std::shared_ptr<std::istream> make_mapped_memory_stream(
+    const std::shared_ptr<ov::MappedMemory>& memory);
+
+/**
+ * @brief Returns the mapped memory the stream reads from, so the data can be referenced directly instead of being
+ * copied from the stream (e.g. the compiled model blob read from the model cache)
+ * @param stream Input stream
+ * @return The mapped memory or nullptr if the stream is not created by ov::make_mapped_memory_stream. The stream
+ * positions are the offsets in the mapped memory.
+ */
+OPENVINO_RUNTIME_API std::shared_ptr<ov::MappedMemory> get_mapped_memory(std::istream& stream);
+
+}  // namespace ov
@@ -8,8 +8,10 @@
 #include <atomic>
 #include <cstddef>
 #include <mutex>
+#include <memory>
 #include <queue>
 #include <type_traits>
+#include <utility>
 
 #include "openvino/core/parallel.hpp"
 
@@ -47,6 +49,101 @@ protected:
     std::queue<T> _queue;
     std::mutex _mutex;
 };
+
+/**
+ * @brief Bounded multi-producer multi-consumer lock-free queue.
+ * Every cell of the ring buffer carries a sequence number which tells producers and consumers whether the cell is
+ * free or occupied at the current lap, so push and pop only contend on a single atomic index each.
+ * @tparam T element type, must be default constructible and move assignable
+ */
+template <typename T>
+class LockFreeBoundedQueue {
+public:
+    /**
+     * @param capacity maximum number of elements, rounded up to the power of two
+     */
+    explicit LockFreeBoundedQueue(std::size_t capacity) {
+        std::size_t size = 2;
+        while (size < capacity) {
+            size <<= 1;
+        }
+        _mask = size - 1;
+        _cells.reset(new Cell[size]);
+        for (std::size_t i = 0; i < size; ++i) {
+            _cells[i]._sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+    LockFreeBoundedQueue(const LockFreeBoundedQueue&) = delete;
+    LockFreeBoundedQueue& operator=(const LockFreeBoundedQueue&) = delete;
+
+    /**
+     * @brief Pushes the value if the queue is not full
+     * @return false if the queue is full, the value is not moved from in that case
+     */
+    bool try_push(T&& value) {
+        std::size_t pos = _tail.load(std::memory_order_relaxed);
+        for (;;) {
+            Cell& cell = _cells[pos & _mask];
+            const std::size_t sequence = cell._sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(pos);
+            if (diff == 0) {
+                if (_tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    cell._value = std::move(value);
+                    cell._sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = _tail.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    bool try_pop(T& value) {
+        std::size_t pos = _head.load(std::memory_order_relaxed);
+        for (;;) {
+            Cell& cell = _cells[pos & _mask];
+            const std::size_t sequence = cell._sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(pos + 1);
+            if (diff == 0) {
+                if (_head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    value = std::move(cell._value);
+                    cell._value = T{};
+                    cell._sequence.store(pos + _mask + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = _head.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /**
+     * @brief Approximate check, the queue may be modified concurrently
+     */
+    bool empty() const {
+        return _head.load(std::memory_order_acquire) >= _tail.load(std::memory_order_acquire);
+    }
+
+private:
+    struct Cell {
+        std::atomic<std::size_t> _sequence{0};
+        T _value{};
+    };
+    // head and tail are modified by different threads, keep them in the different cache lines
+    struct PaddedIndex : public std::atomic<std::size_t> {
+        PaddedIndex() : std::atomic<std::size_t>{0} {}
+        char _padding[64 - sizeof(std::atomic<std::size_t>)];
+    };
+    PaddedIndex _head;
+    PaddedIndex _tail;
+    std::size_t _mask = 0;
+    std::unique_ptr<Cell[]> _cells;
+};
+
 #if ((OV_THREAD == OV_THREAD_TBB) || (OV_THREAD == OV_THREAD_TBB_AUTO))
 template <typename T>
 using ThreadSafeQueue = tbb::concurrent_queue<T>;
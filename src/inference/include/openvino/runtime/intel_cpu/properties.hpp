@@ -11,6 +11,7 @@
  */
 #pragma once
 
+#include "openvino/pass/pass_profiler.hpp"
 #include "openvino/runtime/properties.hpp"
 
 namespace ov {
@@ -63,5 +64,29 @@ static constexpr Property<bool> denormals_optimization{"CPU_DENORMALS_OPTIMIZATI
  */
 static constexpr Property<float> sparse_weights_decompression_rate{"CPU_SPARSE_WEIGHTS_DECOMPRESSION_RATE"};
 
+/**
+ * @brief This property enables collecting of the transformations statistics during the model compilation.
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * The wall time, the change of the model nodes number and the process peak memory are collected for each
+ * transformation pass executed by the plugin, the statistics of the nested passes and of the GraphRewrite matchers
+ * are kept as the children of the enclosing pass. The statistics are available via
+ * ov::intel_cpu::transformations_profile property of the compiled model.
+ *
+ * @code
+ * auto compiled_model = core.compile_model(model, "CPU", ov::intel_cpu::transformations_profiling(true));
+ * std::cout << compiled_model.get_property(ov::intel_cpu::transformations_profile);
+ * @endcode
+ */
+static constexpr Property<bool> transformations_profiling{"CPU_TRANSFORMATIONS_PROFILING"};
+
+/**
+ * @brief Read-only property of the compiled model to get the transformations statistics collected with
+ * ov::intel_cpu::transformations_profiling enabled. The profile is empty otherwise.
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ */
+static constexpr Property<ov::pass::PassProfile, PropertyMutability::RO> transformations_profile{
+    "CPU_TRANSFORMATIONS_PROFILE"};
+
 }  // namespace intel_cpu
 }  // namespace ov
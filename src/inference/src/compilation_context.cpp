@@ -93,11 +93,13 @@ std::string ModelCache::compute_hash(const std::shared_ptr<const ov::Model>& mod
     }
 
     // 3. Add runtime information which may not be serialized
+    std::stringstream strm;
     for (const auto& op : model->get_ordered_ops()) {
         const auto& rt = op->get_rt_info();
         for (const auto& rtMapData : rt) {
             seed = ov::hash_combine(seed, rtMapData.first);
-            std::stringstream strm;
+            strm.str(std::string());
+            strm.clear();
             rtMapData.second.print(strm);
             seed = ov::hash_combine(seed, strm.str());
         }
@@ -40,6 +40,18 @@
 
 ov::ICore::~ICore() = default;
 
+bool ov::ICore::write_cache_entry(const std::string&,
+                                  const std::string&,
+                                  const std::function<void(std::ostream&)>&) const {
+    return false;
+}
+
+bool ov::ICore::read_cache_entry(const std::string&,
+                                 const std::string&,
+                                 const std::function<void(std::istream&)>&) const {
+    return false;
+}
+
 namespace {
 
 #ifdef PROXY_PLUGIN_ENABLED
@@ -61,6 +73,17 @@ void allowNotImplemented(F&& f) {
     }
 }
 
+// Passes the id of the model cache entry to the plugins which keep their own data along with the entry
+ov::AnyMap add_cache_entry_id(const ov::Plugin& plugin, const ov::AnyMap& config, const std::string& blob_id) {
+    ov::AnyMap result = config;
+    allowNotImplemented([&]() {
+        if (ov::util::contains(plugin.get_property(ov::internal::supported_properties),
+                               ov::internal::cache_entry_id.name()))
+            result[ov::internal::cache_entry_id.name()] = blob_id;
+    });
+    return result;
+}
+
 void stripDeviceName(std::string& device, const std::string& substr) {
     auto pos = device.find(substr);
     if (pos == 0) {
@@ -1389,6 +1412,30 @@ bool ov::CoreImpl::device_supports_model_caching(const std::string& device_name)
     return device_supports_model_caching(get_plugin(parsed._deviceName));
 }
 
+bool ov::CoreImpl::write_cache_entry(const std::string& device_name,
+                                     const std::string& id,
+                                     const std::function<void(std::ostream&)>& writer) const {
+    ov::AnyMap empty_map;
+    auto plugin = get_plugin(parseDeviceNameIntoConfig(device_name)._deviceName);
+    auto cacheManager = coreConfig.get_cache_config_for_device(plugin, empty_map)._cacheManager;
+    if (!cacheManager)
+        return false;
+    cacheManager->write_cache_entry(id, writer);
+    return true;
+}
+
+bool ov::CoreImpl::read_cache_entry(const std::string& device_name,
+                                    const std::string& id,
+                                    const std::function<void(std::istream&)>& reader) const {
+    ov::AnyMap empty_map;
+    auto plugin = get_plugin(parseDeviceNameIntoConfig(device_name)._deviceName);
+    auto cacheManager = coreConfig.get_cache_config_for_device(plugin, empty_map)._cacheManager;
+    if (!cacheManager)
+        return false;
+    cacheManager->read_cache_entry(id, reader);
+    return true;
+}
+
 bool ov::CoreImpl::device_supports_property(const ov::Plugin& plugin, const ov::PropertyName& key) const {
     return util::contains(plugin.get_property(ov::supported_properties), key);
 }
@@ -1418,7 +1465,10 @@ ov::SoPtr<ov::ICompiledModel> ov::CoreImpl::compile_model_and_cache(const std::s
                                                                     const CacheContent& cacheContent) const {
     OV_ITT_SCOPED_TASK(ov::itt::domains::OV, "CoreImpl::compile_model_and_cache");
     ov::SoPtr<ov::ICompiledModel> execNetwork;
-    execNetwork = compile_model_with_preprocess(plugin, model, context, parsedConfig);
+    execNetwork = compile_model_with_preprocess(plugin,
+                                                model,
+                                                context,
+                                                add_cache_entry_id(plugin, parsedConfig, cacheContent.blobId));
     if (cacheContent.cacheManager && device_supports_model_caching(plugin)) {
         try {
             // need to export network for further import from "cache"
@@ -1466,8 +1516,9 @@ ov::SoPtr<ov::ICompiledModel> ov::CoreImpl::load_model_from_cache(
                 throw HeaderException();
             }
 
-            compiled_model = context ? plugin.import_model(networkStream, context, config)
-                                     : plugin.import_model(networkStream, config);
+            const auto import_config = add_cache_entry_id(plugin, config, cacheContent.blobId);
+            compiled_model = context ? plugin.import_model(networkStream, context, import_config)
+                                     : plugin.import_model(networkStream, import_config);
             if (auto wrapper = std::dynamic_pointer_cast<InferenceEngine::ICompiledModelWrapper>(compiled_model._ptr)) {
                 wrapper->get_executable_network()->loadedFromCache();
             }
@@ -357,6 +357,14 @@ public:
 
     bool device_supports_model_caching(const std::string& device_name) const override;
 
+    bool write_cache_entry(const std::string& device_name,
+                           const std::string& id,
+                           const std::function<void(std::ostream&)>& writer) const override;
+
+    bool read_cache_entry(const std::string& device_name,
+                          const std::string& id,
+                          const std::function<void(std::istream&)>& reader) const override;
+
     // ov::ICore
     std::shared_ptr<ov::Model> read_model(const std::string& model,
                                           const ov::Tensor& weights,
@@ -0,0 +1,92 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/runtime/mapped_memory_stream.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+#include "openvino/core/except.hpp"
+
+namespace ov {
+namespace {
+
+class MappedMemoryStreamBuf : public std::streambuf {
+public:
+    explicit MappedMemoryStreamBuf(std::shared_ptr<ov::MappedMemory> memory) : m_memory(std::move(memory)) {
+        char* begin = m_memory->size() ? m_memory->data() : nullptr;
+        setg(begin, begin, begin + m_memory->size());
+    }
+
+    const std::shared_ptr<ov::MappedMemory>& get_memory() const {
+        return m_memory;
+    }
+
+protected:
+    std::streamsize xsgetn(char* s, std::streamsize count) override {
+        const auto n = std::min(count, static_cast<std::streamsize>(egptr() - gptr()));
+        if (n > 0) {
+            std::memcpy(s, gptr(), static_cast<size_t>(n));
+            // gbump() takes int, so large reads move the get pointer explicitly
+            setg(eback(), gptr() + n, egptr());
+        }
+        return n;
+    }
+
+    pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which) override {
+        if (!(which & std::ios_base::in)) {
+            return pos_type(off_type(-1));
+        }
+        off_type pos = off;
+        if (dir == std::ios_base::cur) {
+            pos += gptr() - eback();
+        } else if (dir == std::ios_base::end) {
+            pos += egptr() - eback();
+        }
+        if (pos < 0 || pos > egptr() - eback()) {
+            return pos_type(off_type(-1));
+        }
+        setg(eback(), eback() + pos, egptr());
+        return pos_type(pos);
+    }
+
+    pos_type seekpos(pos_type pos, std::ios_base::openmode which) override {
+        return seekoff(off_type(pos), std::ios_base::beg, which);
+    }
+
+private:
+    std::shared_ptr<ov::MappedMemory> m_memory;
+};
+
+class MappedMemoryStream : public std::istream {
+public:
+    explicit MappedMemoryStream(const std::shared_ptr<ov::MappedMemory>& memory)
+        : std::istream(nullptr),
+          m_buffer(memory) {
+        rdbuf(&m_buffer);
+    }
+
+    const std::shared_ptr<ov::MappedMemory>& get_memory() const {
+        return m_buffer.get_memory();
+    }
+
+private:
+    MappedMemoryStreamBuf m_buffer;
+};
+
+}  // namespace
+
+std::shared_ptr<std::istream> make_mapped_memory_stream(const std::shared_ptr<ov::MappedMemory>& memory) {
+    OPENVINO_ASSERT(memory, "Mapped memory is not initialized");
+    return std::make_shared<MappedMemoryStream>(memory);
+}
+
+std::shared_ptr<ov::MappedMemory> get_mapped_memory(std::istream& stream) {
+    if (auto mapped_stream = dynamic_cast<MappedMemoryStream*>(&stream)) {
+        return mapped_stream->get_memory();
+    }
+    return nullptr;
+}
+
+}  // namespace ov
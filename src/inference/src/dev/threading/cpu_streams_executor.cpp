@@ -4,6 +4,7 @@
 
 #include "openvino/runtime/threading/cpu_streams_executor.hpp"
 
+#include <atomic>
 #include <condition_variable>
 #include <memory>
 #include <mutex>
@@ -19,6 +20,7 @@
 #include "openvino/runtime/threading/cpu_streams_executor_internal.hpp"
 #include "openvino/runtime/threading/executor_manager.hpp"
 #include "openvino/runtime/threading/thread_local.hpp"
+#include "openvino/runtime/threading/thread_safe_containers.hpp"
 
 namespace ov {
 namespace threading {
@@ -432,36 +434,82 @@ struct CPUStreamsExecutor::Impl {
             }
         }
 #endif
+        for (auto streamId = 0; streamId < _config._streams; ++streamId) {
+            _taskQueues.emplace_back(new TaskQueue{taskQueueCapacity});
+        }
         for (auto streamId = 0; streamId < _config._streams; ++streamId) {
             _threads.emplace_back([this, streamId] {
                 openvino::itt::threadName(_config._name + "_" + std::to_string(streamId));
-                for (bool stopped = false; !stopped;) {
-                    Task task;
-                    {
-                        std::unique_lock<std::mutex> lock(_mutex);
-                        _queueCondVar.wait(lock, [&] {
-                            return !_taskQueue.empty() || (stopped = _isStopped);
-                        });
-                        if (!_taskQueue.empty()) {
-                            task = std::move(_taskQueue.front());
-                            _taskQueue.pop();
-                        }
-                    }
-                    if (task) {
+                Task task;
+                for (;;) {
+                    if (Pop(streamId, task) || Spin(streamId, task)) {
                         Execute(task, *(_streams.local()));
+                        task = {};
+                        continue;
                     }
+                    if (_isStopped.load()) {
+                        break;
+                    }
+                    Park();
                 }
             });
         }
         _streams.set_thread_ids_map(_threads);
     }
 
+    // The stream thread takes tasks from its own queue first, then from the overflow queue
+    // and then steals from the queues of the other streams
+    bool Pop(const int streamId, Task& task) {
+        const auto queuesNum = _taskQueues.size();
+        for (size_t i = 0; i < queuesNum; ++i) {
+            if (_taskQueues[(static_cast<size_t>(streamId) + i) % queuesNum]->try_pop(task)) {
+                _pendingTasks.fetch_sub(1);
+                return true;
+            }
+            if (0 == i && _overflowQueue.try_pop(task)) {
+                _pendingTasks.fetch_sub(1);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Short busy waiting before parking, so a task enqueued right after the previous one is completed
+    // does not pay for the thread wake up
+    bool Spin(const int streamId, Task& task) {
+        for (int i = 0; i < spinIterations; ++i) {
+            if (_pendingTasks.load() > 0 && Pop(streamId, task)) {
+                return true;
+            }
+            if (_isStopped.load()) {
+                return false;
+            }
+            std::this_thread::yield();
+        }
+        return false;
+    }
+
+    void Park() {
+        std::unique_lock<std::mutex> lock(_mutex);
+        // the counter is incremented before the tasks check, while Enqueue() increments pending tasks before
+        // the parked threads check, so at least one of them observes the other and no wake up is lost
+        _parkedThreads.fetch_add(1);
+        _queueCondVar.wait(lock, [&] {
+            return _pendingTasks.load() > 0 || _isStopped.load();
+        });
+        _parkedThreads.fetch_sub(1);
+    }
+
     void Enqueue(Task task) {
-        {
+        const auto queueIdx = _nextQueue.fetch_add(1, std::memory_order_relaxed) % _taskQueues.size();
+        if (!_taskQueues[queueIdx]->try_push(std::move(task))) {
+            _overflowQueue.push(std::move(task));
+        }
+        _pendingTasks.fetch_add(1);
+        if (_parkedThreads.load() > 0) {
             std::lock_guard<std::mutex> lock(_mutex);
-            _taskQueue.emplace(std::move(task));
+            _queueCondVar.notify_one();
         }
-        _queueCondVar.notify_one();
     }
 
     void Execute(const Task& task, Stream& stream) {
@@ -498,10 +546,21 @@ struct CPUStreamsExecutor::Impl {
     int _streamId = 0;
     std::queue<int> _streamIdQueue;
     std::vector<std::thread> _threads;
+    // per stream lock-free task queues, the tasks are distributed in the round-robin manner and idle streams steal
+    // from the others, so there is no single lock on the task submission path
+    using TaskQueue = LockFreeBoundedQueue<Task>;
+    static constexpr std::size_t taskQueueCapacity = 1024;
+    static constexpr int spinIterations = 64;
+    std::vector<std::unique_ptr<TaskQueue>> _taskQueues;
+    // unbounded queue used only if the stream queue is full
+    ThreadSafeQueue<Task> _overflowQueue;
+    std::atomic<std::size_t> _nextQueue{0};
+    std::atomic<int> _pendingTasks{0};
+    std::atomic<int> _parkedThreads{0};
+    // the mutex and the condition variable are used only to park and wake up idle stream threads
     std::mutex _mutex;
     std::condition_variable _queueCondVar;
-    std::queue<Task> _taskQueue;
-    bool _isStopped = false;
+    std::atomic<bool> _isStopped{false};
     std::vector<int> _usedNumaNodes;
     CustomThreadLocal _streams;
 #if (OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO)
@@ -12,10 +12,19 @@
 #include <fstream>
 #include <functional>
 #include <memory>
+#include <random>
 #include <string>
 
+#ifdef _WIN32
+#    include <process.h>
+#else
+#    include <unistd.h>
+#endif
+
 #include "file_utils.h"
 #include "ie_api.h"
+#include "openvino/runtime/mapped_memory_stream.hpp"
+#include "openvino/util/mmap_object.hpp"
 
 namespace ov {
 
@@ -56,6 +65,8 @@ public:
      *
      * Client needs to call create std::istream object and call reader(istream)
      * Otherwise, network will not be read from cache and will be loaded as usual
+     * The stream may be created with ov::make_mapped_memory_stream(), then the readers can reference the data
+     * directly in the mapped memory (see ov::get_mapped_memory()) instead of copying it from the stream
      *
      * @param id Id of cache (hash of the network)
      * @param reader Lambda function to be called when input stream is created
@@ -100,15 +111,51 @@ public:
 
 private:
     void write_cache_entry(const std::string& id, StreamWriter writer) override {
-        std::ofstream stream(getBlobFile(id), std::ios_base::binary | std::ofstream::out);
-        writer(stream);
+        // The entry may be mapped by the compiled models imported earlier, so it is never rewritten in place:
+        // the new content is written to a temporary file which then replaces the entry. The temporary file name is
+        // unique, so concurrent writers of the same entry, including other processes, don't collide.
+        auto blobFileName = getBlobFile(id);
+        auto tmpFileName = blobFileName + "." + unique_suffix() + ".tmp";
+        {
+            std::ofstream stream(tmpFileName, std::ios_base::binary | std::ofstream::out);
+            writer(stream);
+        }
+        if (std::rename(tmpFileName.c_str(), blobFileName.c_str()) != 0) {
+            // rename does not replace the existing file on Windows
+            std::remove(blobFileName.c_str());
+            if (std::rename(tmpFileName.c_str(), blobFileName.c_str()) != 0)
+                std::remove(tmpFileName.c_str());
+        }
+    }
+
+    static std::string unique_suffix() {
+#ifdef _WIN32
+        const auto pid = _getpid();
+#else
+        const auto pid = getpid();
+#endif
+        std::random_device random;
+        return std::to_string(pid) + "_" + std::to_string(random());
     }
 
     void read_cache_entry(const std::string& id, StreamReader reader) override {
         auto blobFileName = getBlobFile(id);
         if (FileUtils::fileExist(blobFileName)) {
-            std::ifstream stream(blobFileName, std::ios_base::binary);
-            reader(stream);
+            // The entry is mapped, so the plugins may reference the compiled model data (e.g. weights) in place
+            // instead of reading all of it to the heap. Reading the file is the fallback if mapping fails.
+            std::shared_ptr<ov::MappedMemory> mapped;
+            try {
+                mapped = ov::load_mmap_object(blobFileName);
+            } catch (const std::runtime_error&) {
+            }
+            if (mapped && mapped->size() > 0) {
+                auto stream = ov::make_mapped_memory_stream(mapped);
+                mapped.reset();
+                reader(*stream);
+            } else {
+                std::ifstream stream(blobFileName, std::ios_base::binary);
+                reader(stream);
+            }
         }
     }
 
@@ -0,0 +1,179 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <iostream>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+#include "openvino/runtime/system_conf.hpp"
+#include "openvino/runtime/threading/cpu_streams_executor.hpp"
+#include "openvino/runtime/threading/thread_safe_containers.hpp"
+
+using namespace ov::threading;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// Reference executor which reproduces the former CPUStreamsExecutor task submission scheme:
+// a single task queue protected by a mutex and a condition variable shared by all the stream threads
+class MutexQueueExecutor : public ITaskExecutor {
+public:
+    explicit MutexQueueExecutor(int streams) {
+        for (int i = 0; i < streams; ++i) {
+            _threads.emplace_back([this] {
+                for (bool stopped = false; !stopped;) {
+                    Task task;
+                    {
+                        std::unique_lock<std::mutex> lock(_mutex);
+                        _queueCondVar.wait(lock, [&] {
+                            return !_taskQueue.empty() || (stopped = _isStopped);
+                        });
+                        if (!_taskQueue.empty()) {
+                            task = std::move(_taskQueue.front());
+                            _taskQueue.pop();
+                        }
+                    }
+                    if (task) {
+                        task();
+                    }
+                }
+            });
+        }
+    }
+
+    ~MutexQueueExecutor() override {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _isStopped = true;
+        }
+        _queueCondVar.notify_all();
+        for (auto& thread : _threads) {
+            thread.join();
+        }
+    }
+
+    void run(Task task) override {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _taskQueue.emplace(std::move(task));
+        }
+        _queueCondVar.notify_one();
+    }
+
+private:
+    std::vector<std::thread> _threads;
+    std::mutex _mutex;
+    std::condition_variable _queueCondVar;
+    std::queue<Task> _taskQueue;
+    bool _isStopped = false;
+};
+
+// Submits tasks from several producer threads and returns sorted enqueue-to-start latencies in nanoseconds
+std::vector<int64_t> measure_latencies(ITaskExecutor& executor, int producers, int tasksPerProducer) {
+    std::vector<int64_t> latencies(static_cast<size_t>(producers * tasksPerProducer));
+    std::atomic<int> completed{0};
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; ++p) {
+        threads.emplace_back([&, p] {
+            for (int i = 0; i < tasksPerProducer; ++i) {
+                auto& latency = latencies[static_cast<size_t>(p * tasksPerProducer + i)];
+                const auto enqueued = Clock::now();
+                executor.run([&latency, &completed, enqueued] {
+                    latency = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - enqueued).count();
+                    completed++;
+                });
+                // emulate the infer request rate, so the queue does not grow infinitely
+                std::this_thread::sleep_for(std::chrono::microseconds(20));
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    while (completed.load() != producers * tasksPerProducer) {
+        std::this_thread::yield();
+    }
+    std::sort(latencies.begin(), latencies.end());
+    return latencies;
+}
+
+void report(const std::string& name, const std::vector<int64_t>& latencies) {
+    auto percentile = [&](double p) {
+        return latencies[std::min(latencies.size() - 1, static_cast<size_t>(p * latencies.size()))];
+    };
+    std::cout << name << ": p50 " << percentile(0.5) << " ns, p90 " << percentile(0.9) << " ns, p99 "
+              << percentile(0.99) << " ns, max " << latencies.back() << " ns" << std::endl;
+}
+
+}  // namespace
+
+TEST(LockFreeBoundedQueueTests, canPushAndPopFromMultipleThreads) {
+    constexpr int threadsNum = 4;
+    constexpr int valuesPerThread = 10000;
+    LockFreeBoundedQueue<int> queue(64);
+    std::atomic<int64_t> sum{0};
+    std::atomic<int> popped{0};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threadsNum; ++t) {
+        threads.emplace_back([&] {
+            for (int i = 1; i <= valuesPerThread; ++i) {
+                int value = i;
+                while (!queue.try_push(std::move(value))) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+        threads.emplace_back([&] {
+            int value = 0;
+            while (popped.load() < threadsNum * valuesPerThread) {
+                if (queue.try_pop(value)) {
+                    sum += value;
+                    popped++;
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    ASSERT_TRUE(queue.empty());
+    ASSERT_EQ(static_cast<int64_t>(threadsNum) * valuesPerThread * (valuesPerThread + 1) / 2, sum.load());
+}
+
+TEST(LockFreeBoundedQueueTests, pushFailsWhenFull) {
+    LockFreeBoundedQueue<int> queue(2);
+    int value = 1;
+    ASSERT_TRUE(queue.try_push(std::move(value)));
+    value = 2;
+    ASSERT_TRUE(queue.try_push(std::move(value)));
+    value = 3;
+    ASSERT_FALSE(queue.try_push(std::move(value)));
+    ASSERT_EQ(3, value);
+    ASSERT_TRUE(queue.try_pop(value));
+    ASSERT_EQ(1, value);
+}
+
+// Microbenchmark, run it explicitly with --gtest_also_run_disabled_tests
+TEST(CPUStreamsExecutorLatency, DISABLED_compareWithMutexQueue) {
+    const int streams = std::max(1, ov::get_number_of_cpu_cores());
+    const int producers = std::max(1, streams / 2);
+    constexpr int tasksPerProducer = 5000;
+    {
+        CPUStreamsExecutor executor{IStreamsExecutor::Config{"LatencyCPUStreamsExecutor", streams, 1}};
+        report("CPUStreamsExecutor", measure_latencies(executor, producers, tasksPerProducer));
+    }
+    {
+        MutexQueueExecutor executor{streams};
+        report("MutexQueueExecutor", measure_latencies(executor, producers, tasksPerProducer));
+    }
+}
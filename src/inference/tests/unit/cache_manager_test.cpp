@@ -0,0 +1,66 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <iterator>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "common_test_utils/common_utils.hpp"
+#include "common_test_utils/file_utils.hpp"
+#include "ie_cache_manager.hpp"
+
+namespace {
+
+constexpr size_t entry_size = 1024 * 1024;
+constexpr size_t chunk_size = 4096;
+
+}  // namespace
+
+class FileStorageCacheManagerTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        m_dir = ov::test::utils::generateTestFilePrefix() + "_cache_manager";
+        ov::test::utils::createDirectory(m_dir);
+    }
+
+    void TearDown() override {
+        ov::test::utils::removeFilesWithExt(m_dir, "blob");
+        ov::test::utils::removeFilesWithExt(m_dir, "tmp");
+        ov::test::utils::removeDir(m_dir);
+    }
+
+    std::string m_dir;
+};
+
+// Every writer writes its own content, the entry must contain the content of one of them entirely
+TEST_F(FileStorageCacheManagerTest, ConcurrentWritersOfSameEntry) {
+    ov::FileStorageCacheManager manager(m_dir);
+    ov::ICacheManager& cache = manager;
+    std::vector<std::thread> writers;
+    for (char id = 'a'; id < 'a' + 8; id++) {
+        writers.emplace_back([&cache, id] {
+            cache.write_cache_entry("entry", [id](std::ostream& stream) {
+                const std::string chunk(chunk_size, id);
+                for (size_t i = 0; i < entry_size / chunk_size; i++) {
+                    stream.write(chunk.data(), chunk.size());
+                    stream.flush();
+                }
+            });
+        });
+    }
+    for (auto& writer : writers) {
+        writer.join();
+    }
+
+    std::string content;
+    cache.read_cache_entry("entry", [&content](std::istream& stream) {
+        content.assign(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+    });
+    ASSERT_EQ(entry_size, content.size());
+    ASSERT_EQ(std::string(entry_size, content.front()), content);
+    ASSERT_TRUE(ov::test::utils::listFilesWithExt(m_dir, "tmp").empty());
+}
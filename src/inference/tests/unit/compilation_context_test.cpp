@@ -300,6 +300,41 @@ TEST(NetworkContext, HashWithDifferentResults) {
     ASSERT_EQ(ModelCache::compute_hash(net2, {}), ModelCache::compute_hash(net3, {}));
 }
 
+static std::shared_ptr<ov::Model> create_model_with_large_constant(size_t size, int8_t last_value) {
+    std::vector<int8_t> values(size, 1);
+    values.back() = last_value;
+    auto data = std::make_shared<ov::op::v0::Parameter>(ov::element::i8, ov::Shape{size});
+    auto constant = ov::op::v0::Constant::create(ov::element::i8, ov::Shape{size}, values);
+    auto add = std::make_shared<ov::op::v1::Add>(data, constant);
+    auto res = std::make_shared<ov::op::v0::Result>(add);
+    return std::make_shared<ov::Model>(ov::ResultVector{res}, ov::ParameterVector{data});
+}
+
+// The constants larger than a single chunk are hashed in parallel, every chunk must affect the result
+TEST(NetworkContext, HashWithLargeConstants) {
+    const size_t size = 3 * 1024 * 1024 + 5;
+    auto net1 = create_model_with_large_constant(size, 1);
+    auto net2 = create_model_with_large_constant(size, 1);
+    auto net3 = create_model_with_large_constant(size, 2);
+    const auto hash1 = ModelCache::compute_hash(net1, {});
+    ASSERT_EQ(hash1, ModelCache::compute_hash(net2, {}));
+    ASSERT_NE(hash1, ModelCache::compute_hash(net3, {}));
+    ASSERT_EQ(hash1, ModelCache::compute_hash(net1, {}));
+}
+
+// The weights changed in place must change the hash of the same model object
+TEST(NetworkContext, HashWithConstantChangedInPlace) {
+    const size_t size = 2 * 1024 * 1024 + 3;
+    auto net = create_model_with_large_constant(size, 1);
+    const auto hash1 = ModelCache::compute_hash(net, {});
+    for (const auto& op : net->get_ops()) {
+        if (auto constant = std::dynamic_pointer_cast<ov::op::v0::Constant>(op)) {
+            const_cast<int8_t*>(constant->get_data_ptr<int8_t>())[size / 2] = 3;
+        }
+    }
+    ASSERT_NE(hash1, ModelCache::compute_hash(net, {}));
+}
+
 // Verify all internal hash calculations are thread-safe (like ov::Model serialization)
 TEST(NetworkContext, HashOfSameMultiThreading) {
     auto net1 = create_simple_model();
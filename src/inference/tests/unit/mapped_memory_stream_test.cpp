@@ -0,0 +1,71 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/runtime/mapped_memory_stream.hpp"
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <string>
+
+namespace {
+
+class StringMappedMemory : public ov::MappedMemory {
+public:
+    explicit StringMappedMemory(std::string data) : m_data(std::move(data)) {}
+
+    char* data() noexcept override {
+        return &m_data[0];
+    }
+
+    size_t size() const noexcept override {
+        return m_data.size();
+    }
+
+private:
+    std::string m_data;
+};
+
+}  // namespace
+
+TEST(MappedMemoryStreamTests, canReadAndSeek) {
+    auto memory = std::make_shared<StringMappedMemory>("header\nbinary data");
+    auto stream = ov::make_mapped_memory_stream(memory);
+
+    std::string line;
+    std::getline(*stream, line);
+    ASSERT_EQ("header", line);
+    ASSERT_EQ(7, stream->tellg());
+
+    std::string data(6, '\0');
+    stream->read(&data[0], data.size());
+    ASSERT_EQ("binary", data);
+
+    stream->seekg(0);
+    std::getline(*stream, line);
+    ASSERT_EQ("header", line);
+
+    stream->seekg(-4, std::ios_base::end);
+    data.resize(4);
+    stream->read(&data[0], data.size());
+    ASSERT_EQ("data", data);
+
+    stream->read(&data[0], 1);
+    ASSERT_TRUE(stream->eof());
+}
+
+TEST(MappedMemoryStreamTests, seekOutOfBoundsFails) {
+    auto stream = ov::make_mapped_memory_stream(std::make_shared<StringMappedMemory>("data"));
+    stream->seekg(5);
+    ASSERT_TRUE(stream->fail());
+}
+
+TEST(MappedMemoryStreamTests, exposesMappedMemory) {
+    auto memory = std::make_shared<StringMappedMemory>("data");
+    auto stream = ov::make_mapped_memory_stream(memory);
+    ASSERT_EQ(memory, ov::get_mapped_memory(*stream));
+
+    std::stringstream other("data");
+    ASSERT_EQ(nullptr, ov::get_mapped_memory(other));
+}
@@ -0,0 +1,76 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#include "adaptive_timeout.hpp"
+
+#include <algorithm>
+
+namespace ov {
+namespace autobatch_plugin {
+
+constexpr double AdaptiveTimeout::m_alpha;
+
+void AdaptiveTimeout::update(double& average, double sample) {
+    average = average < 0 ? sample : average + m_alpha * (sample - average);
+}
+
+void AdaptiveTimeout::on_arrival(Clock::time_point now) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_has_arrivals) {
+        double interval =
+            static_cast<double>(std::chrono::duration_cast<std::chrono::microseconds>(now - m_last_arrival).count());
+        // the idle periods longer than the timeout say nothing about whether the batch can be collected in time,
+        // so the interval is clamped to keep a single pause from dominating the average
+        if (m_timeout_us >= 0)
+            interval = std::min(interval, m_timeout_us);
+        update(m_inter_arrival_us, interval);
+    }
+    m_last_arrival = now;
+    m_has_arrivals = true;
+}
+
+void AdaptiveTimeout::on_batch_executed(Clock::duration duration) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    update(m_batch_exec_us,
+           static_cast<double>(std::chrono::duration_cast<std::chrono::microseconds>(duration).count()));
+}
+
+void AdaptiveTimeout::on_fallback_executed(int num_requests, Clock::duration duration) {
+    if (num_requests <= 0)
+        return;
+    std::lock_guard<std::mutex> lock(m_mutex);
+    update(m_fallback_exec_per_request_us,
+           static_cast<double>(std::chrono::duration_cast<std::chrono::microseconds>(duration).count()) /
+               num_requests);
+}
+
+std::chrono::milliseconds AdaptiveTimeout::get_wait_time(int collected,
+                                                         int batch_size,
+                                                         std::chrono::milliseconds timeout) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const double timeout_us =
+        static_cast<double>(std::chrono::duration_cast<std::chrono::microseconds>(timeout).count());
+    m_timeout_us = timeout_us;
+    if (collected <= 0 || m_inter_arrival_us < 0)
+        return timeout;
+    const double expected_fill_us = (batch_size - collected) * m_inter_arrival_us;
+    if (expected_fill_us <= timeout_us)
+        return timeout;  // the batch is expected to be full in time, the worker is notified as soon as it happens
+    // the batch is not going to be collected in time: wait just for the requests of the current burst
+    // (a couple of the average intervals) instead of the full timeout
+    const auto burst_wait = std::chrono::milliseconds(static_cast<int64_t>(2 * m_inter_arrival_us / 1000));
+    return std::min(timeout, std::max(std::chrono::milliseconds(1), burst_wait));
+}
+
+bool AdaptiveTimeout::prefer_partial_batch(int collected) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    // without the statistics on both execution flavors keep the batch1 fallback
+    if (m_batch_exec_us < 0 || m_fallback_exec_per_request_us < 0)
+        return false;
+    return m_batch_exec_us < collected * m_fallback_exec_per_request_us;
+}
+
+}  // namespace autobatch_plugin
+}  // namespace ov
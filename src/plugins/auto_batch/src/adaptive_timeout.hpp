@@ -0,0 +1,70 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <chrono>
+#include <mutex>
+
+#ifdef AUTOBATCH_UNITTEST
+#    define autobatch_plugin mock_autobatch_plugin
+#endif
+
+namespace ov {
+namespace autobatch_plugin {
+
+/**
+ * @brief Statistics based policy of the batch collection for a single worker (batched) infer request.
+ * It tracks the requests arrival rate and the execution time of the batched request and of the batch1 fallback, and
+ * - shortens the wait for the rest of the batch when the batch is unlikely to be collected within the timeout
+ * - decides whether the partially collected batch is cheaper to execute with the batched request (leaving the rest
+ *   of the slots idle) or with the individual batch1 requests
+ * The configured timeout always stays the upper bound of the wait.
+ */
+class AdaptiveTimeout {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    // called for every request submitted to the worker, thread safe
+    void on_arrival(Clock::time_point now);
+
+    void on_batch_executed(Clock::duration duration);
+
+    // wall time of executing num_requests requests in the batch1 mode
+    void on_fallback_executed(int num_requests, Clock::duration duration);
+
+    /**
+     * @brief Returns how long to wait for the rest of the batch
+     * @param collected number of the requests already collected for the batch
+     * @param batch_size size of the batch
+     * @param timeout configured timeout
+     */
+    std::chrono::milliseconds get_wait_time(int collected, int batch_size, std::chrono::milliseconds timeout);
+
+    /**
+     * @brief Returns true if the partially collected batch should be executed with the batched request
+     * @param collected number of the requests collected for the batch
+     */
+    bool prefer_partial_batch(int collected) const;
+
+private:
+    // weight of the new sample in the exponential moving averages
+    static constexpr double m_alpha = 0.25;
+
+    static void update(double& average, double sample);
+
+    mutable std::mutex m_mutex;
+    Clock::time_point m_last_arrival;
+    bool m_has_arrivals = false;
+    // the last timeout passed to get_wait_time(), in microseconds
+    double m_timeout_us = -1.0;
+    // moving averages in microseconds, negative means no samples yet
+    double m_inter_arrival_us = -1.0;
+    double m_batch_exec_us = -1.0;
+    double m_fallback_exec_per_request_us = -1.0;
+};
+
+}  // namespace autobatch_plugin
+}  // namespace ov
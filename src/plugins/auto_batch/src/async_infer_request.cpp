@@ -65,10 +65,12 @@ AsyncInferRequest::AsyncInferRequest(const std::shared_ptr<SyncInferRequest>& re
                 std::pair<AsyncInferRequest*, ov::threading::Task> t;
                 t.first = _this;
                 t.second = std::move(task);
+                workerInferRequest->_adaptive_timeout.on_arrival(AdaptiveTimeout::Clock::now());
                 workerInferRequest->_tasks.push(t);
                 // it is ok to call size() here as the queue only grows (and the bulk removal happens under the mutex)
                 const int sz = static_cast<int>(workerInferRequest->_tasks.size());
-                if (sz == workerInferRequest->_batch_size) {
+                // the first request of the batch also wakes up the worker, to start the adaptive wait for the rest
+                if (sz == workerInferRequest->_batch_size || sz == 1) {
                     workerInferRequest->_cond.notify_one();
                 }
             };
@@ -81,7 +83,8 @@ AsyncInferRequest::AsyncInferRequest(const std::shared_ptr<SyncInferRequest>& re
                  auto batchReq = this->m_sync_request->m_batched_request_wrapper;
                  if (batchReq->_exception_ptr)  // when the batchN execution failed
                      std::rethrow_exception(batchReq->_exception_ptr);
-                 // in the case of non-batched execution the tensors were set explicitly
+                 // in the case of non-batched execution the tensors were set explicitly,
+                 // the outputs of the partial batch are copied by the worker
                  if (SyncInferRequest::eExecutionFlavor::BATCH_EXECUTED ==
                      this->m_sync_request->m_batched_request_status) {
                      this->m_sync_request->copy_outputs_if_needed();
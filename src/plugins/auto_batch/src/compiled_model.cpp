@@ -68,6 +68,9 @@ CompiledModel::GetWorkerInferRequest() const {
             [workerRequestPtr](std::exception_ptr exceptionPtr) mutable {
                 if (exceptionPtr)
                     workerRequestPtr->_exception_ptr = exceptionPtr;
+                else
+                    workerRequestPtr->_adaptive_timeout.on_batch_executed(AdaptiveTimeout::Clock::now() -
+                                                                          workerRequestPtr->_batch_start);
                 OPENVINO_ASSERT(workerRequestPtr->_completion_tasks.size() == (size_t)workerRequestPtr->_batch_size);
                 // notify the individual requests on the completion
                 for (int c = 0; c < workerRequestPtr->_batch_size; c++) {
@@ -81,8 +84,14 @@ CompiledModel::GetWorkerInferRequest() const {
             while (1) {
                 std::cv_status status;
                 {
+                    // the deadline is adjusted to the observed requests arrival rate,
+                    // the worker is notified on the first request of the batch to re-evaluate it
+                    const auto wait_time = workerRequestPtr->_adaptive_timeout.get_wait_time(
+                        static_cast<int>(workerRequestPtr->_tasks.size()),
+                        workerRequestPtr->_batch_size,
+                        std::chrono::milliseconds(m_time_out));
                     std::unique_lock<std::mutex> lock(workerRequestPtr->_mutex);
-                    status = workerRequestPtr->_cond.wait_for(lock, std::chrono::milliseconds(m_time_out));
+                    status = workerRequestPtr->_cond.wait_for(lock, wait_time);
                 }
                 if (m_terminate) {
                     break;
@@ -90,7 +99,9 @@ CompiledModel::GetWorkerInferRequest() const {
                     // as we pop the tasks from the queue only here
                     // it is ok to call size() (as the _tasks can only grow in parallel)
                     const int sz = static_cast<int>(workerRequestPtr->_tasks.size());
-                    if (sz == workerRequestPtr->_batch_size) {
+                    const bool is_full = sz == workerRequestPtr->_batch_size;
+                    const bool is_timeout = (status == std::cv_status::timeout) && sz;
+                    if (is_full) {
                         std::pair<ov::autobatch_plugin::AsyncInferRequest*, ov::threading::Task> t;
                         for (int n = 0; n < sz; n++) {
                             OPENVINO_ASSERT(workerRequestPtr->_tasks.try_pop(t));
@@ -99,14 +110,51 @@ CompiledModel::GetWorkerInferRequest() const {
                             t.first->m_sync_request->m_batched_request_status =
                                 ov::autobatch_plugin::SyncInferRequest::eExecutionFlavor::BATCH_EXECUTED;
                         }
+                        workerRequestPtr->_batch_start = AdaptiveTimeout::Clock::now();
                         workerRequestPtr->_infer_request_batched->start_async();
-                    } else if ((status == std::cv_status::timeout) && sz) {
+                    } else if (is_timeout && workerRequestPtr->_adaptive_timeout.prefer_partial_batch(sz)) {
+                        // the partial batch is executed by the separate batched request, the requests copy their
+                        // inputs to it and get the outputs back before the completion, the slots of the requests
+                        // that have not arrived are left idle
+                        auto& partial_request = workerRequestPtr->_infer_request_partial;
+                        if (!partial_request) {
+                            partial_request._ptr = m_compiled_model_with_batch->create_infer_request();
+                            if (partial_request._so == nullptr)
+                                partial_request._so = m_compiled_model_with_batch._so;
+                        }
+                        std::vector<std::pair<ov::autobatch_plugin::AsyncInferRequest*, ov::threading::Task>> batch(sz);
+                        for (auto& t : batch) {
+                            OPENVINO_ASSERT(workerRequestPtr->_tasks.try_pop(t));
+                            t.first->m_sync_request->copy_inputs_if_needed(partial_request);
+                            t.first->m_sync_request->m_batched_request_status =
+                                ov::autobatch_plugin::SyncInferRequest::eExecutionFlavor::PARTIAL_BATCH_EXECUTED;
+                        }
+                        std::promise<void> completed;
+                        auto completed_future = completed.get_future();
+                        partial_request->set_callback(
+                            [&batch, &completed, &partial_request](std::exception_ptr exceptionPtr) {
+                                for (auto& t : batch) {
+                                    if (exceptionPtr)
+                                        t.first->m_sync_request->m_exception_ptr = exceptionPtr;
+                                    else
+                                        t.first->m_sync_request->copy_outputs_if_needed(partial_request);
+                                    t.second();
+                                }
+                                completed.set_value();
+                            });
+                        const auto partial_start = AdaptiveTimeout::Clock::now();
+                        partial_request->start_async();
+                        completed_future.get();
+                        workerRequestPtr->_adaptive_timeout.on_batch_executed(AdaptiveTimeout::Clock::now() -
+                                                                              partial_start);
+                    } else if (is_timeout) {
                         // timeout to collect the batch is over, have to execute the requests in the batch1 mode
                         std::pair<ov::autobatch_plugin::AsyncInferRequest*, ov::threading::Task> t;
                         // popping all tasks collected by the moment of the time-out and execute each with batch1
                         std::atomic<int> arrived = {0};
                         std::promise<void> all_completed;
                         auto all_completed_future = all_completed.get_future();
+                        const auto fallback_start = AdaptiveTimeout::Clock::now();
                         for (int n = 0; n < sz; n++) {
                             OPENVINO_ASSERT(workerRequestPtr->_tasks.try_pop(t));
                             t.first->m_request_without_batch->set_callback(
@@ -124,6 +172,9 @@ CompiledModel::GetWorkerInferRequest() const {
                             t.first->m_request_without_batch->start_async();
                         }
                         all_completed_future.get();
+                        workerRequestPtr->_adaptive_timeout.on_fallback_executed(
+                            sz,
+                            AdaptiveTimeout::Clock::now() - fallback_start);
                         // now when all the tasks for this batch are completed, start waiting for the timeout again
                     }
                 }
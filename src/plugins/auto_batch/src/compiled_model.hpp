@@ -8,6 +8,7 @@
 #include <condition_variable>
 #include <thread>
 
+#include "adaptive_timeout.hpp"
 #include "openvino/runtime/iasync_infer_request.hpp"
 #include "openvino/runtime/icompiled_model.hpp"
 #include "openvino/runtime/threading/thread_safe_containers.hpp"
@@ -30,6 +31,12 @@ public:
         std::condition_variable _cond;
         std::mutex _mutex;
         std::exception_ptr _exception_ptr;
+        AdaptiveTimeout _adaptive_timeout;
+        AdaptiveTimeout::Clock::time_point _batch_start;
+        // executes the partially collected batches, created on the first such batch; the tensors of the individual
+        // requests are the parts of the _infer_request_batched tensors, so the partial batch can't be executed by it
+        // without overwriting the outputs of the requests which are not in the batch
+        ov::SoPtr<ov::IAsyncInferRequest> _infer_request_partial;
     };
 
     CompiledModel(const std::shared_ptr<ov::Model>& model,
@@ -102,9 +102,13 @@ void SyncInferRequest::set_tensors_to_another_request(ov::SoPtr<ov::IAsyncInferR
 }
 
 void SyncInferRequest::copy_inputs_if_needed() {
+    copy_inputs_if_needed(m_batched_request_wrapper->_infer_request_batched);
+}
+
+void SyncInferRequest::copy_inputs_if_needed(const ov::SoPtr<ov::IAsyncInferRequest>& batched_request) {
     for (const auto& it : get_inputs()) {
         // this request is already in BUSY state, so using the internal functions safely
-        auto dst_tensor = m_batched_request_wrapper->_infer_request_batched->get_tensor(it);
+        auto dst_tensor = batched_request->get_tensor(it);
         copy_tensor_if_needed(get_tensor(it), dst_tensor, true);
     }
 }
@@ -132,10 +136,14 @@ void SyncInferRequest::copy_tensor_if_needed(const ov::SoPtr<ov::ITensor>& src,
 }
 
 void SyncInferRequest::copy_outputs_if_needed() {
+    copy_outputs_if_needed(m_batched_request_wrapper->_infer_request_batched);
+}
+
+void SyncInferRequest::copy_outputs_if_needed(const ov::SoPtr<ov::IAsyncInferRequest>& batched_request) {
     for (const auto& it : get_outputs()) {
         // this request is already in BUSY state, so using the internal functions safely
         auto dst_tensor = get_tensor(it);
-        copy_tensor_if_needed(m_batched_request_wrapper->_infer_request_batched->get_tensor(it), dst_tensor, false);
+        copy_tensor_if_needed(batched_request->get_tensor(it), dst_tensor, false);
     }
 }
 
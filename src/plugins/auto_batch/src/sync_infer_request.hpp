@@ -27,6 +27,11 @@ public:
 
     void copy_outputs_if_needed();
 
+    // copies the data of this request to/from its slot of the given batched request
+    void copy_inputs_if_needed(const ov::SoPtr<ov::IAsyncInferRequest>& batched_request);
+
+    void copy_outputs_if_needed(const ov::SoPtr<ov::IAsyncInferRequest>& batched_request);
+
     void infer() override;
 
     std::vector<ov::SoPtr<ov::IVariableState>> query_state() const override;
@@ -40,6 +45,7 @@ public:
     enum eExecutionFlavor : uint8_t {
         NOT_EXECUTED,
         BATCH_EXECUTED,
+        PARTIAL_BATCH_EXECUTED,
         TIMEOUT_EXECUTED
     } m_batched_request_status = eExecutionFlavor::NOT_EXECUTED;
 
@@ -0,0 +1,52 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "adaptive_timeout.hpp"
+
+using namespace ov::autobatch_plugin;
+using std::chrono::milliseconds;
+
+namespace {
+void arrive_with_interval(AdaptiveTimeout& policy, milliseconds interval, int count) {
+    auto now = AdaptiveTimeout::Clock::now();
+    for (int i = 0; i < count; i++) {
+        policy.on_arrival(now);
+        now += interval;
+    }
+}
+}  // namespace
+
+TEST(AdaptiveTimeoutTest, FullTimeoutWithoutStatistics) {
+    AdaptiveTimeout policy;
+    EXPECT_EQ(milliseconds(100), policy.get_wait_time(0, 8, milliseconds(100)));
+    EXPECT_EQ(milliseconds(100), policy.get_wait_time(3, 8, milliseconds(100)));
+    EXPECT_FALSE(policy.prefer_partial_batch(3));
+}
+
+TEST(AdaptiveTimeoutTest, FullTimeoutWhenBatchIsCollectedInTime) {
+    AdaptiveTimeout policy;
+    policy.get_wait_time(0, 8, milliseconds(100));
+    arrive_with_interval(policy, milliseconds(5), 16);
+    EXPECT_EQ(milliseconds(100), policy.get_wait_time(1, 8, milliseconds(100)));
+}
+
+TEST(AdaptiveTimeoutTest, ShortWaitWhenBatchIsNotCollectedInTime) {
+    AdaptiveTimeout policy;
+    policy.get_wait_time(0, 8, milliseconds(100));
+    arrive_with_interval(policy, milliseconds(40), 16);
+    const auto wait_time = policy.get_wait_time(1, 8, milliseconds(100));
+    EXPECT_LT(wait_time, milliseconds(100));
+    EXPECT_GE(wait_time, milliseconds(1));
+}
+
+TEST(AdaptiveTimeoutTest, PartialBatchIsPreferredWhenCheaper) {
+    AdaptiveTimeout policy;
+    policy.on_batch_executed(milliseconds(10));
+    policy.on_fallback_executed(2, milliseconds(8));
+    // 4ms per batch1 request vs 10ms for the whole batch
+    EXPECT_FALSE(policy.prefer_partial_batch(2));
+    EXPECT_TRUE(policy.prefer_partial_batch(3));
+}
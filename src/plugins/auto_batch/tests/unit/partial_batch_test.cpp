@@ -0,0 +1,165 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+
+#include "mock_common.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/relu.hpp"
+#include "openvino/op/result.hpp"
+#include "openvino/runtime/threading/immediate_executor.hpp"
+#include "transformations/utils/utils.hpp"
+#include "unit_test_utils/mocks/openvino/runtime/mock_icore.hpp"
+
+using ::testing::NiceMock;
+
+namespace {
+constexpr size_t batch_size = 4;
+constexpr size_t data_size = 8;
+}  // namespace
+
+// The hardware requests write 2 * input + the number of their executions to the outputs, so the output of a request
+// changes if its slot of the batched request is executed again.
+class AutoBatchPartialBatchTest : public ::testing::Test {
+public:
+    std::shared_ptr<ov::Model> m_model;
+    std::shared_ptr<NiceMock<ov::MockICore>> m_core;
+    std::shared_ptr<NiceMock<MockAutoBatchInferencePlugin>> m_auto_batch_plugin;
+    std::shared_ptr<NiceMock<MockIPlugin>> m_hardware_plugin;
+
+    std::shared_ptr<NiceMock<MockICompiledModel>> m_i_compile_model_without_batch;
+    std::shared_ptr<NiceMock<MockICompiledModel>> m_i_compile_model_with_batch;
+
+    std::shared_ptr<CompiledModel> m_auto_batch_compile_model;
+
+    void TearDown() override {
+        m_auto_batch_compile_model.reset();
+        m_i_compile_model_with_batch.reset();
+        m_i_compile_model_without_batch.reset();
+        m_hardware_plugin.reset();
+        m_auto_batch_plugin.reset();
+        m_core.reset();
+        m_model.reset();
+    }
+
+    void SetUp() override {
+        auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{1, data_size});
+        auto relu = std::make_shared<ov::op::v0::Relu>(param);
+        m_model = std::make_shared<ov::Model>(ov::OutputVector{relu}, ov::ParameterVector{param});
+        const std::set<std::string> batched_inputs = {ov::op::util::get_ie_output_name(param->output(0))};
+        const std::set<std::string> batched_outputs = {ov::op::util::get_ie_output_name(relu->output(0))};
+
+        m_core = std::shared_ptr<NiceMock<ov::MockICore>>(new NiceMock<ov::MockICore>());
+        m_auto_batch_plugin =
+            std::shared_ptr<NiceMock<MockAutoBatchInferencePlugin>>(new NiceMock<MockAutoBatchInferencePlugin>());
+        m_auto_batch_plugin->set_core(m_core);
+        m_hardware_plugin = std::shared_ptr<NiceMock<MockIPlugin>>(new NiceMock<MockIPlugin>());
+
+        auto batched_model = m_model->clone();
+        batched_model->reshape(ov::PartialShape{batch_size, data_size});
+        m_i_compile_model_without_batch = std::make_shared<NiceMock<MockICompiledModel>>(m_model, m_hardware_plugin);
+        m_i_compile_model_with_batch = std::make_shared<NiceMock<MockICompiledModel>>(batched_model, m_hardware_plugin);
+        // the batch1 requests are much slower than the batched one, so the partial batches are preferred
+        // as soon as both execution flavors are measured
+        ON_CALL(*m_i_compile_model_without_batch, create_infer_request()).WillByDefault([this]() {
+            return create_hardware_request(m_i_compile_model_without_batch, std::chrono::milliseconds(20));
+        });
+        ON_CALL(*m_i_compile_model_with_batch, create_infer_request()).WillByDefault([this]() {
+            return create_hardware_request(m_i_compile_model_with_batch, std::chrono::milliseconds(0));
+        });
+
+        ASSERT_NO_THROW(m_auto_batch_compile_model =
+                            std::make_shared<CompiledModel>(m_model->clone(),
+                                                            m_auto_batch_plugin,
+                                                            ov::AnyMap{{"AUTO_BATCH_TIMEOUT", "50"}},
+                                                            DeviceInformation{"CPU", {}, batch_size},
+                                                            batched_inputs,
+                                                            batched_outputs,
+                                                            ov::SoPtr<ov::ICompiledModel>{m_i_compile_model_with_batch, {}},
+                                                            ov::SoPtr<ov::ICompiledModel>{m_i_compile_model_without_batch, {}},
+                                                            ov::SoPtr<ov::IRemoteContext>{}));
+    }
+
+    static std::shared_ptr<ov::IAsyncInferRequest> create_hardware_request(
+        const std::shared_ptr<NiceMock<MockICompiledModel>>& compiled_model,
+        std::chrono::milliseconds latency) {
+        auto sync_request = std::make_shared<NiceMock<MockISyncInferRequest>>(compiled_model);
+        auto executions = std::make_shared<size_t>(0);
+        auto request = sync_request.get();
+        ON_CALL(*sync_request, infer()).WillByDefault([request, executions, latency]() {
+            std::this_thread::sleep_for(latency);
+            const auto input = request->get_tensor(request->get_inputs()[0]);
+            const auto output = request->get_tensor(request->get_outputs()[0]);
+            const auto in = input->data<float>();
+            const auto out = output->data<float>();
+            const float execution = static_cast<float>(++(*executions));
+            for (size_t i = 0; i < input->get_size(); i++)
+                out[i] = 2.f * in[i] + execution;
+        });
+        return std::make_shared<ov::IAsyncInferRequest>(sync_request,
+                                                        std::make_shared<ov::threading::ImmediateExecutor>(),
+                                                        nullptr);
+    }
+
+    static void set_input(const std::shared_ptr<ov::IAsyncInferRequest>& request, float value) {
+        auto input = request->get_tensor(request->get_inputs()[0]);
+        std::fill_n(input->data<float>(), data_size, value);
+    }
+
+    static std::vector<float> get_output(const std::shared_ptr<ov::IAsyncInferRequest>& request) {
+        auto output = request->get_tensor(request->get_outputs()[0]);
+        return std::vector<float>(output->data<float>(), output->data<float>() + data_size);
+    }
+};
+
+TEST_F(AutoBatchPartialBatchTest, PartialBatchKeepsOutputsOfOtherRequests) {
+    std::vector<std::shared_ptr<ov::IAsyncInferRequest>> requests;
+    for (size_t i = 0; i < batch_size; i++)
+        requests.push_back(m_auto_batch_compile_model->create_infer_request());
+
+    // the full batch is executed by the batched request
+    for (size_t i = 0; i < batch_size; i++) {
+        set_input(requests[i], static_cast<float>(i));
+        requests[i]->start_async();
+    }
+    for (size_t i = 0; i < batch_size; i++) {
+        requests[i]->wait();
+        EXPECT_EQ(get_output(requests[i]), std::vector<float>(data_size, 2.f * i + 1.f)) << "request " << i;
+    }
+
+    // the single request is executed in the batch1 mode, as there are no statistics on it yet
+    set_input(requests[0], 10.f);
+    requests[0]->start_async();
+    requests[0]->wait();
+    const std::vector<float> expected(data_size, 21.f);
+    ASSERT_EQ(get_output(requests[0]), expected);
+
+    // the first request is completed, the user keeps reading its output while the partial batch of the second
+    // request is executed
+    std::atomic<bool> stop{false};
+    std::atomic<bool> changed{false};
+    std::thread reader([&] {
+        while (!stop) {
+            if (get_output(requests[0]) != expected)
+                changed = true;
+        }
+    });
+    set_input(requests[1], 5.f);
+    requests[1]->start_async();
+    requests[1]->wait();
+    stop = true;
+    reader.join();
+
+    EXPECT_FALSE(changed);
+    EXPECT_EQ(get_output(requests[0]), expected);
+    // the partial batch is executed by its own batched request, which runs for the first time
+    EXPECT_EQ(get_output(requests[1]), std::vector<float>(data_size, 11.f));
+    // the slots of the other requests keep the results of the full batch
+    for (size_t i = 2; i < batch_size; i++)
+        EXPECT_EQ(get_output(requests[i]), std::vector<float>(data_size, 2.f * i + 1.f)) << "request " << i;
+}
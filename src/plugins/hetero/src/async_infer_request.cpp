@@ -23,10 +23,24 @@ struct RequestExecutor : ov::threading::ITaskExecutor {
 
 ov::hetero::AsyncInferRequest::AsyncInferRequest(const std::shared_ptr<ov::hetero::InferRequest>& request,
                                                  const std::shared_ptr<ov::threading::ITaskExecutor>& task_executor,
-                                                 const std::shared_ptr<ov::threading::ITaskExecutor>& callback_executor)
+                                                 const std::shared_ptr<ov::threading::ITaskExecutor>& callback_executor,
+                                                 const std::vector<std::shared_ptr<ov::threading::ITaskExecutor>>& stage_executors)
     : ov::IAsyncInferRequest(request, task_executor, callback_executor),
       m_infer_request(std::static_pointer_cast<ov::hetero::InferRequest>(request)) {
     m_pipeline.clear();
+    if (!stage_executors.empty()) {
+        OPENVINO_ASSERT(stage_executors.size() == m_infer_request->m_subrequests.size(),
+                        "Number of pipeline stages does not match the number of subrequests");
+        // pipelined mode: the stage executor thread is busy with the request until the submodel is inferred, then it
+        // hands the request over to the next stage and takes the next request from its queue
+        for (size_t i = 0; i < stage_executors.size(); i++) {
+            auto& subrequest = m_infer_request->m_subrequests[i];
+            m_pipeline.emplace_back(stage_executors[i], [&subrequest] {
+                subrequest->infer();
+            });
+        }
+        return;
+    }
     for (auto&& request : m_infer_request->m_subrequests) {
         auto request_executor = std::make_shared<RequestExecutor>(request);
         m_pipeline.emplace_back(request_executor, [request_executor] {
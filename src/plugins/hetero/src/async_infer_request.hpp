@@ -5,6 +5,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 #include "openvino/runtime/iasync_infer_request.hpp"
 #include "sync_infer_request.hpp"
@@ -16,7 +17,8 @@ class AsyncInferRequest : public ov::IAsyncInferRequest {
 public:
     AsyncInferRequest(const std::shared_ptr<InferRequest>& request,
                       const std::shared_ptr<ov::threading::ITaskExecutor>& task_executor,
-                      const std::shared_ptr<ov::threading::ITaskExecutor>& callback_executor);
+                      const std::shared_ptr<ov::threading::ITaskExecutor>& callback_executor,
+                      const std::vector<std::shared_ptr<ov::threading::ITaskExecutor>>& stage_executors = {});
 
     ~AsyncInferRequest();
 
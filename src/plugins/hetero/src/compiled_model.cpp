@@ -190,8 +190,9 @@ void ov::hetero::CompiledModel::compile_model(const std::shared_ptr<ov::Model>&
         // disable caching for subgraphs, because the whole HETERO model is cached
         auto device_config = meta_devices[m_compiled_submodels[id].device];
         device_config[ov::cache_dir.name()] = "";
-        // set exclusive_async_requests in case when model is split
-        if (ordered_subgraphs.size() > 1) {
+        // set exclusive_async_requests in case when model is split, the pipelined execution runs the stages
+        // concurrently by design, so the device executors are not serialized
+        if (ordered_subgraphs.size() > 1 && !m_cfg.pipelined_execution) {
             auto supported_internal_properties =
                 get_hetero_plugin()->get_core()->get_property(m_compiled_submodels[id].device,
                                                               ov::internal::supported_properties);
@@ -210,6 +211,7 @@ void ov::hetero::CompiledModel::compile_model(const std::shared_ptr<ov::Model>&
     }
 
     set_inputs_and_outputs();
+    create_stage_executors();
 }
 
 ov::hetero::CompiledModel::CompiledModel(std::istream& model,
@@ -302,6 +304,7 @@ ov::hetero::CompiledModel::CompiledModel(std::istream& model,
     }
     // clang-format on
     set_inputs_and_outputs();
+    create_stage_executors();
 }
 
 std::shared_ptr<ov::ISyncInferRequest> ov::hetero::CompiledModel::create_sync_infer_request() const {
@@ -314,7 +317,8 @@ std::shared_ptr<ov::IAsyncInferRequest> ov::hetero::CompiledModel::create_infer_
     auto async_infer_request = std::make_shared<ov::hetero::AsyncInferRequest>(
         std::static_pointer_cast<ov::hetero::InferRequest>(internal_request),
         get_task_executor(),
-        get_callback_executor());
+        get_callback_executor(),
+        m_stage_executors);
 
     return async_infer_request;
 }
@@ -496,6 +500,8 @@ ov::Any ov::hetero::CompiledModel::get_property(const std::string& name) const {
                              comp_model_desc.compiled_model->get_property(ov::optimal_number_of_infer_requests.name())
                                  .as<unsigned int>());
         }
+        // every stage of the pipeline needs its own request to be busy
+        value = std::max(value, static_cast<unsigned int>(m_stage_executors.size()));
         return decltype(ov::optimal_number_of_infer_requests)::value_type{value};
     } else if (ov::execution_devices == name) {
         std::vector<std::string> device_names;
@@ -522,6 +528,18 @@ const std::vector<ov::Output<const ov::Node>>& ov::hetero::CompiledModel::output
     return m_compiled_outputs;
 }
 
+void ov::hetero::CompiledModel::create_stage_executors() {
+    if (!m_cfg.pipelined_execution || m_compiled_submodels.size() < 2)
+        return;
+    // the executors are shared by all the infer requests of the model, so each stage processes one request at a time
+    // in the submission order while the other stages work on the neighbouring requests
+    m_stage_executors.reserve(m_compiled_submodels.size());
+    for (size_t i = 0; i < m_compiled_submodels.size(); i++) {
+        m_stage_executors.push_back(get_plugin()->get_executor_manager()->get_idle_cpu_streams_executor(
+            {"HeteroStage" + std::to_string(i) + "_" + m_compiled_submodels[i].device}));
+    }
+}
+
 void ov::hetero::CompiledModel::set_inputs_and_outputs() {
     // Restore inputs/outputs from compiled submodels
     m_compiled_inputs.reserve(m_inputs_to_submodels_inputs.size());
@@ -47,6 +47,8 @@ private:
 
     void set_inputs_and_outputs();
 
+    void create_stage_executors();
+
     Configuration m_cfg;
     std::string m_name;
     const bool m_loaded_from_cache;
@@ -64,6 +66,8 @@ private:
         ov::SoPtr<ov::ICompiledModel> compiled_model;
     };
     std::vector<CompiledModelDesc> m_compiled_submodels;
+    // one executor per submodel in the pipelined execution mode, empty otherwise
+    std::vector<std::shared_ptr<ov::threading::ITaskExecutor>> m_stage_executors;
 };
 }  // namespace hetero
 }  // namespace ov
\ No newline at end of file
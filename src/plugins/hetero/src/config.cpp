@@ -7,10 +7,11 @@
 #include "ie/ie_plugin_config.hpp"
 #include "openvino/runtime/internal_properties.hpp"
 #include "openvino/runtime/properties.hpp"
+#include "properties.hpp"
 
 using namespace ov::hetero;
 
-Configuration::Configuration() : dump_graph(false) {}
+Configuration::Configuration() : dump_graph(false), pipelined_execution(false) {}
 
 Configuration::Configuration(const ov::AnyMap& config, const Configuration& defaultCfg, bool throwOnUnsupported) {
     OPENVINO_SUPPRESS_DEPRECATED_START
@@ -22,6 +23,8 @@ Configuration::Configuration(const ov::AnyMap& config, const Configuration& defa
 
         if (HETERO_CONFIG_KEY(DUMP_GRAPH_DOT) == key) {
             dump_graph = value.as<bool>();
+        } else if (ov::hetero::pipelined_execution == key) {
+            pipelined_execution = value.as<bool>();
         } else if ("TARGET_FALLBACK" == key || ov::device::priorities == key) {
             device_priorities = value.as<std::string>();
         } else {
@@ -37,6 +40,8 @@ ov::Any Configuration::get(const std::string& name) const {
     OPENVINO_SUPPRESS_DEPRECATED_START
     if (name == HETERO_CONFIG_KEY(DUMP_GRAPH_DOT)) {
         return {dump_graph};
+    } else if (name == ov::hetero::pipelined_execution) {
+        return {pipelined_execution};
     } else if (name == "TARGET_FALLBACK" || name == ov::device::priorities) {
         return {device_priorities};
     } else {
@@ -49,7 +54,8 @@ std::vector<ov::PropertyName> Configuration::get_supported() const {
     OPENVINO_SUPPRESS_DEPRECATED_START
     static const std::vector<ov::PropertyName> names = {HETERO_CONFIG_KEY(DUMP_GRAPH_DOT),
                                                         "TARGET_FALLBACK",
-                                                        ov::device::priorities};
+                                                        ov::device::priorities,
+                                                        ov::hetero::pipelined_execution};
     return names;
     OPENVINO_SUPPRESS_DEPRECATED_END
 }
@@ -58,7 +64,8 @@ ov::AnyMap Configuration::get_hetero_properties() const {
     OPENVINO_SUPPRESS_DEPRECATED_START
     return {{HETERO_CONFIG_KEY(DUMP_GRAPH_DOT), dump_graph},
             {"TARGET_FALLBACK", device_priorities},
-            {ov::device::priorities.name(), device_priorities}};
+            {ov::device::priorities.name(), device_priorities},
+            {ov::hetero::pipelined_execution.name(), pipelined_execution}};
     OPENVINO_SUPPRESS_DEPRECATED_END
 }
 
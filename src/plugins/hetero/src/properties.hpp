@@ -18,5 +18,12 @@ static constexpr Property<std::string, PropertyMutability::RO> caching_device_pr
  */
 static constexpr Property<size_t, PropertyMutability::RO> number_of_submodels{"HETERO_NUMBER_OF_SUBMODELS"};
 
+/**
+ * @brief Enables pipelined execution of asynchronous infer requests: each submodel is a stage with its own executor
+ * and queue, so the stages of different requests overlap and the throughput is limited by the slowest stage instead
+ * of the sum of all stages. Disabled by default.
+ */
+static constexpr Property<bool, PropertyMutability::RW> pipelined_execution{"HETERO_PIPELINED_EXECUTION"};
+
 }  // namespace hetero
 }  // namespace ov
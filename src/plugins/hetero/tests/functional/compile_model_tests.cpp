@@ -122,4 +122,29 @@ TEST_F(HeteroTests, get_runtime_model) {
         ASSERT_TRUE(info.count(ov::exec_model_info::OUTPUT_PRECISIONS));
     }
     EXPECT_EQ(0, original_names.size());
-}
\ No newline at end of file
+}
+
+TEST_F(HeteroTests, infer_pipelined_execution) {
+    auto model = create_model_with_subtract();
+    ov::AnyMap config = {ov::device::priorities("MOCK0,MOCK1"), {"HETERO_PIPELINED_EXECUTION", true}};
+    auto compiled_model = core.compile_model(model, "HETERO", config);
+    EXPECT_TRUE(compiled_model.get_property("HETERO_PIPELINED_EXECUTION").as<bool>());
+    std::vector<ov::InferRequest> infer_requests;
+    std::vector<ov::Tensor> input_tensors;
+    for (size_t i = 0; i < 4; i++) {
+        infer_requests.push_back(compiled_model.create_infer_request());
+        input_tensors.push_back(
+            create_and_fill_tensor(compiled_model.input().get_element_type(), compiled_model.input().get_shape()));
+        infer_requests.back().set_input_tensor(input_tensors.back());
+    }
+    for (size_t iteration = 0; iteration < 3; iteration++) {
+        for (auto& infer_request : infer_requests)
+            infer_request.start_async();
+        for (size_t i = 0; i < infer_requests.size(); i++) {
+            infer_requests[i].wait();
+            auto output_tensor = infer_requests[i].get_output_tensor();
+            EXPECT_EQ(input_tensors[i].get_shape(), output_tensor.get_shape());
+            EXPECT_EQ(0, memcmp(input_tensors[i].data(), output_tensor.data(), input_tensors[i].get_byte_size()));
+        }
+    }
+}
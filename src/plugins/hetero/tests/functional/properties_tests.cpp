@@ -40,7 +40,8 @@ TEST_F(HeteroTests, get_property_supported_metrics) {
 TEST_F(HeteroTests, get_property_supported_configs) {
     const std::vector<std::string> supported_configs = {"HETERO_DUMP_GRAPH_DOT",
                                                         "TARGET_FALLBACK",
-                                                        ov::device::priorities.name()};
+                                                        ov::device::priorities.name(),
+                                                        "HETERO_PIPELINED_EXECUTION"};
     auto actual_supported_configs =
         core.get_property("HETERO", METRIC_KEY(SUPPORTED_CONFIG_KEYS)).as<std::vector<std::string>>();
     EXPECT_EQ(supported_configs.size(), actual_supported_configs.size());
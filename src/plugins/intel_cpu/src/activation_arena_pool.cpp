@@ -0,0 +1,90 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "activation_arena_pool.h"
+
+#include <utility>
+
+namespace ov {
+namespace intel_cpu {
+
+ActivationArenaPool::Lease::Lease(Lease&& other) noexcept : pool(other.pool), arenaIdx(other.arenaIdx) {
+    other.pool = nullptr;
+}
+
+ActivationArenaPool::Lease& ActivationArenaPool::Lease::operator=(Lease&& other) noexcept {
+    if (this != &other) {
+        release();
+        pool = other.pool;
+        arenaIdx = other.arenaIdx;
+        other.pool = nullptr;
+    }
+    return *this;
+}
+
+ActivationArenaPool::Lease::~Lease() {
+    release();
+}
+
+void* ActivationArenaPool::Lease::getData() const {
+    if (!pool)
+        return nullptr;
+    std::lock_guard<std::mutex> lock(pool->mutex);
+    return pool->arenas[arenaIdx].mngr->getRawPtr();
+}
+
+void ActivationArenaPool::Lease::release() {
+    if (pool) {
+        pool->release(arenaIdx);
+        pool = nullptr;
+    }
+}
+
+ActivationArenaPool::Lease ActivationArenaPool::acquire(size_t size, const void* preferred) {
+    std::lock_guard<std::mutex> lock(mutex);
+    size_t found = arenas.size();
+    for (size_t i = 0; i < arenas.size(); i++) {
+        const auto& arena = arenas[i];
+        if (arena.leased)
+            continue;
+        if (preferred && arena.mngr->getRawPtr() == preferred && arena.size >= size) {
+            found = i;
+            break;
+        }
+        // otherwise take the free arena which needs the least reallocation
+        if (found == arenas.size() || (arenas[found].size < size && arena.size > arenas[found].size))
+            found = i;
+    }
+    if (found == arenas.size()) {
+        arenas.push_back({std::unique_ptr<MemoryMngrWithReuse>(new MemoryMngrWithReuse()), 0, false});
+    }
+    auto& arena = arenas[found];
+    if (arena.size < size) {
+        arena.mngr->resize(size);
+        arena.size = size;
+    }
+    arena.leased = true;
+    return Lease(this, found);
+}
+
+void ActivationArenaPool::release(size_t arenaIdx) {
+    std::lock_guard<std::mutex> lock(mutex);
+    arenas[arenaIdx].leased = false;
+}
+
+size_t ActivationArenaPool::getArenasNum() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return arenas.size();
+}
+
+size_t ActivationArenaPool::getTotalSize() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    size_t result = 0;
+    for (const auto& arena : arenas)
+        result += arena.size;
+    return result;
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
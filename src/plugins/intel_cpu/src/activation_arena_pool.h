@@ -0,0 +1,75 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "cpu_memory.h"
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Thread safe pool of the memory arenas for the intermediate tensors of the graphs of a compiled model.
+ * A graph leases an arena only for the time of the inference, so the number of allocated arenas follows the number
+ * of the inferences executed at the same time rather than the number of the graphs (streams) of the compiled model.
+ */
+class ActivationArenaPool {
+public:
+    typedef std::shared_ptr<ActivationArenaPool> Ptr;
+
+    /**
+     * @brief RAII holder of the leased arena, the arena is returned to the pool on destruction
+     */
+    class Lease {
+    public:
+        Lease() = default;
+        Lease(Lease&& other) noexcept;
+        Lease& operator=(Lease&& other) noexcept;
+        Lease(const Lease&) = delete;
+        Lease& operator=(const Lease&) = delete;
+        ~Lease();
+
+        void* getData() const;
+        void release();
+
+    private:
+        friend class ActivationArenaPool;
+        Lease(ActivationArenaPool* pool, size_t arenaIdx) : pool(pool), arenaIdx(arenaIdx) {}
+
+        ActivationArenaPool* pool = nullptr;
+        size_t arenaIdx = 0;
+    };
+
+    /**
+     * @brief Leases a free arena of at least the given size, a new arena is allocated if there is no free one
+     * @param size required size in bytes
+     * @param preferred data pointer of the arena leased by the caller last time, this arena is returned if it is free
+     *        and large enough, so the caller does not need to rebind its tensors
+     */
+    Lease acquire(size_t size, const void* preferred);
+
+    size_t getArenasNum() const;
+
+    // total size of the allocated arenas in bytes
+    size_t getTotalSize() const;
+
+private:
+    void release(size_t arenaIdx);
+
+    struct Arena {
+        std::unique_ptr<MemoryMngrWithReuse> mngr;
+        size_t size;
+        bool leased;
+    };
+
+    mutable std::mutex mutex;
+    std::vector<Arena> arenas;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
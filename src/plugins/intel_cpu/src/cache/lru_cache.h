@@ -74,6 +74,7 @@ public:
         for (size_t i = 0; i < n && !_lruList.empty(); ++i) {
             _cacheMapper.erase(_lruList.back().first);
             _lruList.pop_back();
+            ++_evictionsCount;
         }
     }
 
@@ -85,6 +86,22 @@ public:
          return _capacity;
      }
 
+    /**
+     * @brief Returns the number of records currently stored in the cache
+     * @return the number of records
+     */
+    size_t size() const noexcept {
+        return _cacheMapper.size();
+    }
+
+    /**
+     * @brief Returns the total number of records evicted from the cache since its creation
+     * @return the number of evicted records
+     */
+    size_t getEvictionsCount() const noexcept {
+        return _evictionsCount;
+    }
+
 private:
     struct key_hasher {
         std::size_t operator()(const Key &k) const {
@@ -102,6 +119,7 @@ private:
     lru_list_type _lruList;
     std::unordered_map<Key, cache_map_value_type, key_hasher> _cacheMapper;
     size_t _capacity;
+    size_t _evictionsCount = 0;
 };
 
 }   // namespace intel_cpu
@@ -7,21 +7,40 @@
 #include <functional>
 #include <unordered_map>
 #include <atomic>
+#include <mutex>
+#include <type_traits>
 #include "cache_entry.h"
 
 namespace ov {
 namespace intel_cpu {
 
+/**
+ * @brief Tells whether the values of the type may be used by several streams at once, so they can be stored in the cache
+ *        shared between the streams. The specializations are placed next to the reentrant types.
+ */
+template<typename ValueType>
+struct is_shareable_cache_value : std::false_type {};
+
 /**
  * @brief Class that represent a preemptive cache for different key/value pair types.
  *
- * @attention This implementation IS NOT THREAD SAFE!
+ * @attention The cache of a single stream IS NOT THREAD SAFE!
+ * @note The cache created with the shards number is thread safe, so it may be shared between the streams of a compiled
+ *       model (or between compiled models). Each entry is split into shardsNum independently locked shards to reduce
+ *       the contention between the concurrent lookups. The cache of the stream refers to the shared one and passes
+ *       the lookups of the shareable values to it (see is_shareable_cache_value), the rest of the values are kept
+ *       by the stream.
  */
 
+class MultiCache;
+using MultiCachePtr = std::shared_ptr<MultiCache>;
+
 class MultiCache {
 public:
     template<typename KeyType, typename ValueType>
     using EntryTypeT = CacheEntry<KeyType, ValueType>;
+    template<typename KeyType, typename ValueType>
+    using SharedEntryTypeT = CacheEntry<KeyType, ValueType, ShardedLruCache<KeyType, ValueType>>;
     using EntryBasePtr = std::shared_ptr<CacheEntryBase>;
     template<typename KeyType, typename ValueType>
     using EntryPtr = std::shared_ptr<EntryTypeT<KeyType, ValueType>>;
@@ -33,6 +52,26 @@ public:
     */
     explicit MultiCache(size_t capacity) : _capacity(capacity) {}
 
+    /**
+    * @brief Creates the cache of the stream which passes the lookups of the shareable values to the shared cache
+    * @param capacity maximum records limit for each entry of the values kept by the stream
+    * @param sharedCache the thread safe cache shared between the streams
+    */
+    MultiCache(size_t capacity, MultiCachePtr sharedCache) : _capacity(capacity), _sharedCache(std::move(sharedCache)) {}
+
+    /**
+    * @brief Creates the thread safe cache
+    * @param capacity maximum records limit for each entry
+    * @param shardsNum number of the independently locked shards of each entry
+    */
+    MultiCache(size_t capacity, size_t shardsNum) : _capacity(capacity), _shardsNum(shardsNum), _threadSafe(true) {}
+
+    MultiCache(const MultiCache& other)
+        : _capacity(other._capacity), _shardsNum(other._shardsNum), _threadSafe(other._threadSafe), _sharedCache(other._sharedCache) {
+        std::lock_guard<std::mutex> lock(other._mutex);
+        _storage = other._storage;
+    }
+
     /**
     * @brief Searches a value of ValueType in the cache using the provided key or creates a new ValueType instance (if nothing was found)
     *       using the key and the builder functor and adds the new record to the cache
@@ -45,19 +84,42 @@ public:
     template<typename KeyType, typename BuilderType, typename ValueType = typename std::result_of<BuilderType&(const KeyType&)>::type>
     typename CacheEntry<KeyType, ValueType>::ResultType
     getOrCreate(const KeyType& key, BuilderType builder) {
-        auto entry = getEntry<KeyType, ValueType>();
-        return entry->getOrCreate(key, std::move(builder));
+        if (_sharedCache && is_shareable_cache_value<ValueType>::value)
+            return _sharedCache->getOrCreate(key, std::move(builder));
+        if (_threadSafe)
+            return getEntry<SharedEntryTypeT<KeyType, ValueType>>(_capacity, _shardsNum)->getOrCreate(key, std::move(builder));
+        return getEntry<EntryTypeT<KeyType, ValueType>>(_capacity)->getOrCreate(key, std::move(builder));
+    }
+
+    /**
+    * @brief Collects the hit/miss/eviction counters of all the entries kept by this cache (the shared cache has its own ones)
+    * @return the accumulated statistics
+    */
+    CacheStatistics getStatistics() const {
+        CacheStatistics result;
+        std::unique_lock<std::mutex> lock(_mutex, std::defer_lock);
+        if (_threadSafe)
+            lock.lock();
+        for (const auto& item : _storage) {
+            result += item.second->getStatistics();
+        }
+        return result;
     }
 
 private:
     template<typename T>
     size_t getTypeId();
-    template<typename KeyType, typename ValueType>
-    EntryPtr<KeyType, ValueType> getEntry();
+    template<typename EntryType, typename... Args>
+    std::shared_ptr<EntryType> getEntry(Args... args);
 
 private:
     static std::atomic_size_t _typeIdCounter;
     size_t _capacity;
+    size_t _shardsNum = 1;
+    // the entries map is locked only if the cache is shared, the cache of the stream is used by one thread at a time
+    bool _threadSafe = false;
+    MultiCachePtr _sharedCache;
+    mutable std::mutex _mutex;
     std::unordered_map<size_t, EntryBasePtr> _storage;
 };
 
@@ -67,13 +129,15 @@ size_t MultiCache::getTypeId() {
     return id;
 }
 
-template<typename KeyType, typename ValueType>
-MultiCache::EntryPtr<KeyType, ValueType> MultiCache::getEntry() {
-    using EntryType = EntryTypeT<KeyType, ValueType>;
+template<typename EntryType, typename... Args>
+std::shared_ptr<EntryType> MultiCache::getEntry(Args... args) {
     size_t id = getTypeId<EntryType>();
+    std::unique_lock<std::mutex> lock(_mutex, std::defer_lock);
+    if (_threadSafe)
+        lock.lock();
     auto itr = _storage.find(id);
     if (itr == _storage.end()) {
-        auto result = _storage.insert({id, std::make_shared<EntryType>(_capacity)});
+        auto result = _storage.insert({id, std::make_shared<EntryType>(args...)});
         itr = result.first;
     }
     return std::static_pointer_cast<EntryType>(itr->second);
@@ -81,7 +145,6 @@ MultiCache::EntryPtr<KeyType, ValueType> MultiCache::getEntry() {
 
 using MultiCacheWeakPtr = std::weak_ptr<MultiCache>;
 using MultiCacheWeakCPtr = std::weak_ptr<const MultiCache>;
-using MultiCachePtr = std::shared_ptr<MultiCache>;
 using MultiCacheCPtr = std::shared_ptr<const MultiCache>;
 
 }   // namespace intel_cpu
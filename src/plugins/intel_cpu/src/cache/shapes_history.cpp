@@ -0,0 +1,169 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shapes_history.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+
+namespace ov {
+namespace intel_cpu {
+
+namespace {
+constexpr uint32_t historyMagic = 0x53555043;  // "CPUS"
+constexpr uint32_t historyVersion = 1;
+// sanity limits to reject corrupted entries
+constexpr uint32_t maxNameSize = 1 << 16;
+constexpr uint32_t maxRank = 64;
+
+template <typename T>
+void write(std::ostream& stream, const T& value) {
+    stream.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+template <typename T>
+bool read(std::istream& stream, T& value) {
+    stream.read(reinterpret_cast<char*>(&value), sizeof(value));
+    return stream.good();
+}
+
+template <typename T>
+size_t hash_combine(size_t seed, const T& value) {
+    return seed ^ (std::hash<T>()(value) + 0x9e3779b9 + (seed << 6) + (seed >> 2));
+}
+}  // namespace
+
+ShapesHistory::ShapesHistory(size_t capacity) : _capacity(capacity) {
+    // the load factor of the table never exceeds 1/2, so the probe sequences stay short
+    size_t slots = 2;
+    while (slots < 2 * capacity)
+        slots *= 2;
+    _slots = std::vector<std::atomic<Entry*>>(slots);
+    for (auto& slot : _slots)
+        slot.store(nullptr, std::memory_order_relaxed);
+}
+
+ShapesHistory::~ShapesHistory() {
+    for (auto& slot : _slots)
+        delete slot.load(std::memory_order_relaxed);
+}
+
+bool ShapesHistory::insert(const Signature& signature) {
+    // the fast path for the full history, the capacity is enforced by the slot reservation below
+    if (_size.load(std::memory_order_relaxed) >= _capacity)
+        return false;
+
+    size_t hash = 0;
+    for (const auto& input : signature) {
+        hash = hash_combine(hash, input.first);
+        for (const auto dim : input.second)
+            hash = hash_combine(hash, dim);
+    }
+
+    const size_t mask = _slots.size() - 1;
+    std::unique_ptr<Entry> created;
+    // a new entry takes a place in the history before it is published, so the concurrent insertions can't exceed
+    // the capacity, the place is given back if the signature turns out to be inserted by another thread
+    bool reserved = false;
+    for (size_t i = hash & mask, probe = 0; probe < _slots.size(); i = (i + 1) & mask, probe++) {
+        Entry* entry = _slots[i].load(std::memory_order_acquire);
+        if (!entry) {
+            if (!reserved) {
+                if (_size.fetch_add(1, std::memory_order_relaxed) >= _capacity) {
+                    _size.fetch_sub(1, std::memory_order_relaxed);
+                    return false;
+                }
+                reserved = true;
+            }
+            if (!created)
+                created.reset(new Entry{hash, signature});
+            if (_slots[i].compare_exchange_strong(entry, created.get(), std::memory_order_acq_rel, std::memory_order_acquire)) {
+                created.release();
+                return true;
+            }
+            // another thread has taken the slot, the entry now points to its signature
+        }
+        if (entry->hash == hash && entry->signature == signature)
+            break;
+    }
+    if (reserved)
+        _size.fetch_sub(1, std::memory_order_relaxed);
+    return false;
+}
+
+bool ShapesHistory::record(const Signature& signature) {
+    if (!insert(signature))
+        return false;
+    _modified.store(true, std::memory_order_relaxed);
+    return true;
+}
+
+std::vector<ShapesHistory::Signature> ShapesHistory::getSignatures() const {
+    std::vector<Signature> signatures;
+    for (const auto& slot : _slots) {
+        if (const auto entry = slot.load(std::memory_order_acquire))
+            signatures.push_back(entry->signature);
+    }
+    std::sort(signatures.begin(), signatures.end());
+    return signatures;
+}
+
+void ShapesHistory::load(std::istream& stream) {
+    uint32_t magic = 0, version = 0, signaturesNum = 0;
+    if (!read(stream, magic) || magic != historyMagic || !read(stream, version) || version != historyVersion ||
+        !read(stream, signaturesNum))
+        return;
+
+    std::vector<Signature> signatures;
+    for (uint32_t i = 0; i < signaturesNum && signatures.size() < _capacity; i++) {
+        uint32_t inputsNum = 0;
+        if (!read(stream, inputsNum))
+            return;
+        Signature signature;
+        for (uint32_t j = 0; j < inputsNum; j++) {
+            uint32_t nameSize = 0, rank = 0;
+            if (!read(stream, nameSize) || nameSize > maxNameSize)
+                return;
+            std::string name(nameSize, '\0');
+            stream.read(&name[0], nameSize);
+            if (!read(stream, rank) || rank > maxRank)
+                return;
+            VectorDims dims(rank);
+            for (auto& dim : dims) {
+                uint64_t value = 0;
+                if (!read(stream, value))
+                    return;
+                dim = static_cast<Dim>(value);
+            }
+            signature.emplace(std::move(name), std::move(dims));
+        }
+        signatures.push_back(std::move(signature));
+    }
+
+    // the restored signatures are already stored, so they don't modify the history
+    for (const auto& signature : signatures)
+        insert(signature);
+}
+
+void ShapesHistory::save(std::ostream& stream) {
+    _modified.store(false, std::memory_order_relaxed);
+    const auto signatures = getSignatures();
+    write(stream, historyMagic);
+    write(stream, historyVersion);
+    write(stream, static_cast<uint32_t>(signatures.size()));
+    for (const auto& signature : signatures) {
+        write(stream, static_cast<uint32_t>(signature.size()));
+        for (const auto& input : signature) {
+            write(stream, static_cast<uint32_t>(input.first.size()));
+            stream.write(input.first.data(), input.first.size());
+            write(stream, static_cast<uint32_t>(input.second.size()));
+            for (const auto dim : input.second)
+                write(stream, static_cast<uint64_t>(dim));
+        }
+    }
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,82 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <istream>
+#include <map>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "cpu_types.h"
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Thread safe collection of the input shapes signatures (input name -> static dims) inferred by a compiled model with dynamic shapes.
+ * The history may be stored to the model cache and restored by the next compilation of the same model in order to prepare the nodes
+ * (and populate the runtime parameters cache) for all the previously seen shapes before the first inference request.
+ */
+class ShapesHistory {
+public:
+    using Signature = std::map<std::string, VectorDims>;
+
+    /**
+     * @param capacity maximum number of stored signatures, new signatures are ignored when the history is full
+     */
+    explicit ShapesHistory(size_t capacity);
+    ~ShapesHistory();
+
+    ShapesHistory(const ShapesHistory&) = delete;
+    ShapesHistory& operator=(const ShapesHistory&) = delete;
+
+    /**
+     * @brief Adds the signature to the history. The signatures are kept in a lock-free open addressing hash table,
+     *        so the method may be called by the infer requests concurrently
+     * @return true if the signature has not been recorded yet
+     */
+    bool record(const Signature& signature);
+
+    /**
+     * @return the recorded signatures in the ascending order
+     */
+    std::vector<Signature> getSignatures() const;
+
+    bool isModified() const {
+        return _modified.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Loads the signatures from the stream, a corrupted content is ignored
+     */
+    void load(std::istream& stream);
+
+    /**
+     * @brief Stores the signatures to the stream and resets the modification flag
+     */
+    void save(std::ostream& stream);
+
+private:
+    struct Entry {
+        size_t hash;
+        Signature signature;
+    };
+
+    bool insert(const Signature& signature);
+
+    size_t _capacity;
+    std::atomic<size_t> _size{0};
+    std::atomic<bool> _modified{false};
+    // the entries are never removed, so a published entry stays valid until the destruction
+    std::vector<std::atomic<Entry*>> _slots;
+};
+
+using ShapesHistoryPtr = std::shared_ptr<ShapesHistory>;
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,137 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "lru_cache.h"
+
+/**
+ * @brief Thread safe preemptive cache with LRU eviction policy.
+ * The key space is split into shards, each shard is an independent LruCache protected by its own mutex, so concurrent
+ * lookups of different keys rarely contend on the same lock.
+ * @tparam Key is a key type that must define hash() const method with return type convertible to size_t and define comparison operator.
+ * @tparam Value is a type that must meet all the requirements to the std::unordered_map mapped type
+ *
+ * @note The LRU policy is applied per shard, so with more than one shard the eviction order is only approximately LRU.
+ */
+
+namespace ov {
+namespace intel_cpu {
+
+template<typename Key, typename Value>
+class ShardedLruCache {
+public:
+    /**
+     * @param capacity maximum number of records stored in the cache
+     * @param shardsNum number of shards, it is reduced to the capacity if the capacity is smaller
+     */
+    explicit ShardedLruCache(size_t capacity, size_t shardsNum = 1) : _capacity(capacity) {
+        shardsNum = std::max<size_t>(1, std::min(shardsNum, capacity));
+        const size_t shardCapacity = (capacity + shardsNum - 1) / shardsNum;
+        _shards.reserve(shardsNum);
+        for (size_t i = 0; i < shardsNum; ++i) {
+            _shards.emplace_back(new Shard(shardCapacity));
+        }
+    }
+
+    /**
+     * @brief Puts the value associated with the key into the cache.
+     * @param key
+     * @param value
+     */
+    void put(const Key &key, const Value &val) {
+        if (0 == _capacity) {
+            return;
+        }
+        auto& shard = getShard(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        shard.cache.put(key, val);
+    }
+
+    /**
+     * @brief Searches a value associated with the key.
+     * @param key
+     * @return Value associated with the key or default constructed instance of the Value type.
+     */
+    Value get(const Key &key) {
+        auto& shard = getShard(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        return shard.cache.get(key);
+    }
+
+    /**
+     * @brief Evicts n least recently used cache records from each shard
+     * @param n number of records to be evicted, can be greater than capacity
+     */
+    void evict(size_t n) {
+        for (auto& shard : _shards) {
+            std::lock_guard<std::mutex> lock(shard->mutex);
+            shard->cache.evict(n);
+        }
+    }
+
+    /**
+     * @brief Returns the current capacity value
+     * @return the current capacity value
+     */
+    size_t getCapacity() const noexcept {
+        return _capacity;
+    }
+
+    /**
+     * @brief Returns the number of records currently stored in all the shards
+     * @return the number of records
+     */
+    size_t size() const {
+        size_t result = 0;
+        for (auto& shard : _shards) {
+            std::lock_guard<std::mutex> lock(shard->mutex);
+            result += shard->cache.size();
+        }
+        return result;
+    }
+
+    /**
+     * @brief Returns the total number of records evicted from all the shards since the cache creation
+     * @return the number of evicted records
+     */
+    size_t getEvictionsCount() const {
+        size_t result = 0;
+        for (auto& shard : _shards) {
+            std::lock_guard<std::mutex> lock(shard->mutex);
+            result += shard->cache.getEvictionsCount();
+        }
+        return result;
+    }
+
+private:
+    struct Shard {
+        explicit Shard(size_t capacity) : cache(capacity) {}
+        mutable std::mutex mutex;
+        LruCache<Key, Value> cache;
+    };
+
+    Shard& getShard(const Key& key) {
+        if (1 == _shards.size()) {
+            return *_shards.front();
+        }
+        // mix the high bits in, since the low bits of the hash are also used for the bucket selection inside the shard
+        uint64_t hash = static_cast<uint64_t>(key.hash());
+        hash ^= hash >> 17;
+        hash *= 0x9E3779B97F4A7C15ull;
+        return *_shards[static_cast<size_t>(hash >> 32) % _shards.size()];
+    }
+
+    size_t _capacity;
+    std::vector<std::unique_ptr<Shard>> _shards;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -16,7 +16,9 @@
 
 #include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
 #include "openvino/core/type/element_type_traits.hpp"
+#include "openvino/runtime/internal_properties.hpp"
 #include "openvino/runtime/properties.hpp"
+#include "openvino/runtime/intel_cpu/properties.hpp"
 #include "utils/debug_capabilities.h"
 #include "cpu/x64/cpu_isa_traits.hpp"
 
@@ -217,6 +219,54 @@ void Config::readProperties(const std::map<std::string, std::string> &prop, cons
             // any negative value will be treated
             // as zero that means disabling the cache
             rtCacheCapacity = std::max(val_i, 0);
+        } else if (PluginConfigInternalParams::KEY_CPU_RUNTIME_CACHE_SHARING == key) {
+            if (val == PluginConfigInternalParams::PER_STREAM)
+                rtCacheSharing = RuntimeCacheSharing::PerStream;
+            else if (val == PluginConfigInternalParams::PER_MODEL)
+                rtCacheSharing = RuntimeCacheSharing::PerModel;
+            else if (val == PluginConfigInternalParams::PER_PLUGIN)
+                rtCacheSharing = RuntimeCacheSharing::PerPlugin;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_RUNTIME_CACHE_SHARING
+                           << ". Expected values: PER_STREAM/PER_MODEL/PER_PLUGIN";
+        } else if (PluginConfigInternalParams::KEY_CPU_DYNAMIC_SHAPES_HISTORY == key) {
+            if (val == PluginConfigParams::YES)
+                dynamicShapesHistory = true;
+            else if (val == PluginConfigParams::NO)
+                dynamicShapesHistory = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_DYNAMIC_SHAPES_HISTORY
+                           << ". Expected only YES/NO";
+        } else if (key == ov::internal::cache_entry_id.name()) {
+            cacheEntryId = val;
+        } else if (PluginConfigInternalParams::KEY_CPU_PARALLEL_GRAPH_EXECUTION == key) {
+            if (val == PluginConfigParams::YES)
+                parallelGraphExecution = true;
+            else if (val == PluginConfigParams::NO)
+                parallelGraphExecution = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_PARALLEL_GRAPH_EXECUTION
+                           << ". Expected only YES/NO";
+        } else if (PluginConfigInternalParams::KEY_CPU_ACTIVATION_ARENA_SHARING == key) {
+            if (val == PluginConfigParams::YES)
+                activationArenaSharing = true;
+            else if (val == PluginConfigParams::NO)
+                activationArenaSharing = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_ACTIVATION_ARENA_SHARING
+                           << ". Expected only YES/NO";
+        } else if (PluginConfigInternalParams::KEY_CPU_STATE_MAX_LENGTH_HINT == key) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_STATE_MAX_LENGTH_HINT
+                           << ". Expected only integer numbers";
+            }
+            if (val_i < 0)
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_STATE_MAX_LENGTH_HINT
+                           << ". Expected only non negative numbers";
+            stateMaxLengthHint = static_cast<size_t>(val_i);
         } else if (CPUConfigParams::KEY_CPU_DENORMALS_OPTIMIZATION == key) {
             if (val == PluginConfigParams::YES) {
                 denormalsOptMode = DenormalsOptMode::DO_On;
@@ -237,6 +287,14 @@ void Config::readProperties(const std::map<std::string, std::string> &prop, cons
             else
                 IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_SNIPPETS_MODE
                             << ". Expected values: ENABLE/DISABLE/IGNORE_CALLBACK";
+        } else if (key == ov::intel_cpu::transformations_profiling.name()) {
+            if (val == PluginConfigParams::YES)
+                transformationsProfiling = true;
+            else if (val == PluginConfigParams::NO)
+                transformationsProfiling = false;
+            else
+                IE_THROW() << "Wrong value for property key " << ov::intel_cpu::transformations_profiling.name()
+                           << ". Expected only YES/NO";
         } else if (key == ov::hint::execution_mode.name()) {
             if (val == "PERFORMANCE") {
                 executionMode = ov::hint::ExecutionMode::PERFORMANCE;
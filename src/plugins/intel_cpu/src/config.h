@@ -45,6 +45,12 @@ struct Config {
         PER_PLATFORM,
     };
 
+    enum class RuntimeCacheSharing {
+        PerStream,
+        PerModel,
+        PerPlugin,
+    };
+
     enum class ModelType {
         CNN,
         Unknown
@@ -62,6 +68,13 @@ struct Config {
     // TODO: Executor cache may leads to incorrect behavior on oneDNN ACL primitives
     size_t rtCacheCapacity = 0ul;
 #endif
+    RuntimeCacheSharing rtCacheSharing = RuntimeCacheSharing::PerStream;
+    bool dynamicShapesHistory = false;
+    std::string cacheEntryId = {};
+    bool parallelGraphExecution = false;
+    bool activationArenaSharing = false;
+    size_t stateMaxLengthHint = 0ul;
+    bool transformationsProfiling = false;
     InferenceEngine::IStreamsExecutor::Config streamExecutorConfig;
     InferenceEngine::PerfHintsConfig  perfHintsConfig;
     bool enableCpuPinning = true;
@@ -94,6 +107,9 @@ struct Config {
     std::map<std::string, std::string> _config;
 
     bool isLegacyApi = false;
+    // all the constants are used in place instead of the per socket copies of the weights cache (see ExecNetwork),
+    // otherwise only the ones mapped from the model file are
+    bool constantsInPlace = true;
 
     int modelPreferThreads = -1;
     ModelType modelType = ModelType::Unknown;
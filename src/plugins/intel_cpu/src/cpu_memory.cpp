@@ -3,6 +3,7 @@
 //
 
 #include <oneapi/dnnl/dnnl.hpp>
+#include <algorithm>
 #include <vector>
 #include <numeric>
 #include <unordered_set>
@@ -239,6 +240,47 @@ void MemoryMngrWithReuse::destroy(void *ptr) {
     dnnl::impl::free(ptr);
 }
 
+void* MemoryMngrWithGrowth::getRawPtr() const noexcept {
+    return m_data.get();
+}
+
+void MemoryMngrWithGrowth::setExtBuff(void *ptr, size_t size) {
+    m_useExternalStorage = true;
+    m_size = size;
+    m_capacity = size;
+    m_data = decltype(m_data)(ptr, release);
+}
+
+bool MemoryMngrWithGrowth::resize(size_t size) {
+    constexpr int cacheLineSize = 64;
+    bool sizeChanged = false;
+    if (size > m_capacity) {
+        const size_t capacity = std::max(size, 2 * m_capacity);
+        void *ptr = dnnl::impl::malloc(capacity, cacheLineSize);
+        if (!ptr) {
+            IE_THROW() << "Failed to allocate " << capacity << " bytes of memory";
+        }
+        if (m_data && m_size)
+            cpu_memcpy(ptr, m_data.get(), std::min(m_size, m_capacity));
+        m_capacity = capacity;
+        m_useExternalStorage = false;
+        m_data = decltype(m_data)(ptr, destroy);
+        sizeChanged = true;
+    }
+    m_size = size;
+    return sizeChanged;
+}
+
+bool MemoryMngrWithGrowth::hasExtBuffer() const noexcept {
+    return m_useExternalStorage;
+}
+
+void MemoryMngrWithGrowth::release(void *ptr) {}
+
+void MemoryMngrWithGrowth::destroy(void *ptr) {
+    dnnl::impl::free(ptr);
+}
+
 void* DnnlMemoryMngr::getRawPtr() const noexcept {
     return m_pMemMngr->getRawPtr();
 }
@@ -90,6 +90,32 @@ private:
     static void destroy(void *ptr);
 };
 
+/**
+ * @brief An implementation of the mem manager which keeps the data on reallocation and reserves extra capacity growing
+ * the buffer geometrically, so a tensor which grows a bit on every inference is reallocated rarely.
+ */
+class MemoryMngrWithGrowth : public IMemoryMngr {
+public:
+    MemoryMngrWithGrowth() : m_data(nullptr, release) {}
+    void* getRawPtr() const noexcept override;
+    void setExtBuff(void* ptr, size_t size) override;
+    bool resize(size_t size) override;
+    bool hasExtBuffer() const noexcept override;
+
+    size_t getCapacity() const noexcept {
+        return m_capacity;
+    }
+
+private:
+    bool m_useExternalStorage = false;
+    size_t m_size = 0ul;
+    size_t m_capacity = 0ul;
+    std::unique_ptr<void, void (*)(void *)> m_data;
+
+    static void release(void *ptr);
+    static void destroy(void *ptr);
+};
+
 class IMemoryMngrObserver : public IMemoryMngr {
 public:
     virtual void registerMemory(Memory* memPtr) = 0;
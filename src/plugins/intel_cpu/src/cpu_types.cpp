@@ -206,7 +206,8 @@ static const TypeToNameMap& get_type_to_name_tbl() {
             { "Interaction", Type::Interaction},
             { "MHA", Type::MHA},
             { "Unique", Type::Unique},
-            { "Ngram", Type::Ngram}
+            { "Ngram", Type::Ngram},
+            { "NormalizePreprocess", Type::NormalizePreprocess}
     };
     return type_to_name_tbl;
 }
@@ -319,6 +320,7 @@ std::string NameFromType(const Type type) {
         CASE(MHA);
         CASE(Unique);
         CASE(Ngram);
+        CASE(NormalizePreprocess);
         CASE(Unknown);
     }
 #undef CASE
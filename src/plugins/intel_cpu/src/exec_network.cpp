@@ -29,6 +29,7 @@
 #include "ie_icore.hpp"
 #include "openvino/runtime/properties.hpp"
 #include "openvino/util/common_util.hpp"
+#include "openvino/util/log.hpp"
 
 #include <algorithm>
 #include <unordered_set>
@@ -66,12 +67,14 @@ struct ImmediateSerialExecutor : public ITaskExecutor {
 ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
                          const Config &cfg,
                          const ExtensionManager::Ptr& extMgr,
-                         const std::shared_ptr<InferenceEngine::IInferencePlugin>& plugin) :
+                         const std::shared_ptr<InferenceEngine::IInferencePlugin>& plugin,
+                         const MultiCachePtr& sharedParamsCache) :
     InferenceEngine::ExecutableNetworkThreadSafeDefault{nullptr, nullptr},
     extensionManager(extMgr),
     _network(network),
     _cfg{cfg},
-    _name{network.getName()} {
+    _name{network.getName()},
+    _sharedParamsCache(sharedParamsCache) {
     SetPointerToPlugin(plugin);
     auto function = network.getFunction();
     if (function == nullptr) {
@@ -84,6 +87,9 @@ ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
     if (!core)
         IE_THROW() << "Unable to get API version. Core is unavailable";
     _cfg.isLegacyApi = !core->isNewAPI();
+    // The weights cache keeps a copy of the constants per socket, so the streams read the memory local to their NUMA
+    // node. The copies are not needed if there is a single socket.
+    _cfg.constantsInPlace = get_num_sockets() == 1;
 
 
     if (cfg.exclusiveAsyncRequests) {
@@ -115,6 +121,15 @@ ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
         _callbackExecutor = _taskExecutor;
     }
     int streams = std::max(1, _cfg.streamExecutorConfig._streams);
+    if (_cfg.dynamicShapesHistory) {
+        InitShapesHistory();
+    }
+    if (!_sharedParamsCache && _cfg.rtCacheSharing == Config::RuntimeCacheSharing::PerModel && streams > 1) {
+        _sharedParamsCache = std::make_shared<MultiCache>(_cfg.rtCacheCapacity, static_cast<size_t>(streams));
+    }
+    if (_cfg.activationArenaSharing) {
+        _activationArenaPool = std::make_shared<ActivationArenaPool>();
+    }
     std::vector<Task> tasks; tasks.resize(streams);
     _graphs.resize(streams);
     if (_cfg.streamExecutorConfig._streams != 0) {
@@ -153,12 +168,47 @@ ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
                 if (suffix_idx != std::string::npos)
                     state_name = state_name.substr(0, suffix_idx);
 
-                memoryStates.emplace_back(new VariableState(state_name, state_store));
+                memoryStates.emplace_back(new VariableState(state_name, memoryNode->getEngine(),
+                                                             memoryNode->getBaseMemDescAtOutputPort(0), state_store));
             }
         }
     }
 }
 
+ExecNetwork::~ExecNetwork() {
+    if (!_shapesHistory || !_shapesHistory->isModified())
+        return;
+    try {
+        if (auto core = _plugin->GetCore()) {
+            core->write_cache_entry(_plugin->GetName(), _shapesHistoryId, [&](std::ostream& stream) {
+                _shapesHistory->save(stream);
+            });
+        }
+    } catch (const std::exception& e) {
+        OPENVINO_WARN << "Failed to store the input shapes history of the CPU compiled model: " << e.what();
+    }
+}
+
+void ExecNetwork::InitShapesHistory() {
+    // the history is useless without the runtime cache, since there is no place to keep the prepared executors
+    if (_cfg.cacheEntryId.empty() || _cfg.rtCacheCapacity == 0 || !_network.getFunction()->is_dynamic())
+        return;
+    auto core = _plugin->GetCore();
+    if (!core)
+        return;
+
+    // the history is kept along with the model cache entry, so it has the same key as the compiled model
+    _shapesHistoryId = _cfg.cacheEntryId + ".cpu_shapes";
+    _shapesHistory = std::make_shared<ShapesHistory>(_cfg.rtCacheCapacity);
+    try {
+        core->read_cache_entry(_plugin->GetName(), _shapesHistoryId, [&](std::istream& stream) {
+            _shapesHistory->load(stream);
+        });
+    } catch (const std::exception& e) {
+        OPENVINO_WARN << "Failed to read the input shapes history of the CPU compiled model: " << e.what();
+    }
+}
+
 ExecNetwork::GraphGuard::Lock ExecNetwork::GetGraph() const {
     int streamId = 0;
     int socketId = 0;
@@ -182,9 +232,25 @@ ExecNetwork::GraphGuard::Lock ExecNetwork::GetGraph() const {
                         (_cfg.lpTransformsMode == Config::On) &&
                         ov::pass::low_precision::LowPrecision::isFunctionQuantized(_network.getFunction());
 
-                    ctx = std::make_shared<GraphContext>(_cfg, extensionManager, weightsCache, isQuantizedFlag);
+                    ctx = std::make_shared<GraphContext>(_cfg,
+                                                         extensionManager,
+                                                         weightsCache,
+                                                         isQuantizedFlag,
+                                                         _sharedParamsCache,
+                                                         _activationArenaPool);
                 }
                 graphLock._graph.CreateGraph(_network, ctx);
+                if (_shapesHistory) {
+                    for (const auto& signature : _shapesHistory->getSignatures()) {
+                        try {
+                            graphLock._graph.WarmUp(signature);
+                        } catch (const std::exception& e) {
+                            // an inapplicable signature must not break the compilation, it is just not prepared in advance
+                            OPENVINO_WARN << "Failed to prepare the CPU compiled model for the stored input shapes: "
+                                          << e.what();
+                        }
+                    }
+                }
             } catch (...) {
                 exception = std::current_exception();
             }
@@ -301,6 +367,8 @@ InferenceEngine::Parameter ExecNetwork::GetMetric(const std::string &name) const
             RO_property(ov::execution_devices.name()),
             RO_property(ov::intel_cpu::denormals_optimization.name()),
             RO_property(ov::intel_cpu::sparse_weights_decompression_rate.name()),
+            RO_property(ov::intel_cpu::transformations_profiling.name()),
+            RO_property(ov::intel_cpu::transformations_profile.name()),
         };
     }
 
@@ -358,6 +426,10 @@ InferenceEngine::Parameter ExecNetwork::GetMetric(const std::string &name) const
         return decltype(ov::intel_cpu::denormals_optimization)::value_type(config.denormalsOptMode == Config::DenormalsOptMode::DO_On);
     } else if (name == ov::intel_cpu::sparse_weights_decompression_rate) {
         return decltype(ov::intel_cpu::sparse_weights_decompression_rate)::value_type(config.fcSparseWeiDecompressionRate);
+    } else if (name == ov::intel_cpu::transformations_profiling) {
+        return decltype(ov::intel_cpu::transformations_profiling)::value_type(config.transformationsProfiling);
+    } else if (name == ov::intel_cpu::transformations_profile) {
+        return decltype(ov::intel_cpu::transformations_profile)::value_type(_transformationsProfile);
     }
     /* Internally legacy parameters are used with new API as part of migration procedure.
      * This fallback can be removed as soon as migration completed */
@@ -10,6 +10,8 @@
 #include "graph.h"
 #include "extension_mngr.h"
 #include "graph_context.h"
+#include "cache/shapes_history.h"
+#include "openvino/pass/pass_profiler.hpp"
 #include <threading/ie_thread_local.hpp>
 
 #include <vector>
@@ -37,7 +39,10 @@ public:
 
     ExecNetwork(const InferenceEngine::CNNNetwork &network, const Config &cfg,
                 const ExtensionManager::Ptr &extMgr,
-                const std::shared_ptr<InferenceEngine::IInferencePlugin>& plugin);
+                const std::shared_ptr<InferenceEngine::IInferencePlugin>& plugin,
+                const MultiCachePtr& sharedParamsCache = nullptr);
+
+    ~ExecNetwork() override;
 
     InferenceEngine::Parameter GetConfig(const std::string &name) const override;
 
@@ -47,6 +52,10 @@ public:
 
     void Export(std::ostream& modelStream) override;
 
+    void setTransformationsProfile(ov::pass::PassProfile profile) {
+        _transformationsProfile = std::move(profile);
+    }
+
 protected:
     friend class InferRequestBase;
     ExtensionManager::Ptr extensionManager;
@@ -69,6 +78,15 @@ protected:
     // WARNING: Do not use _graphs directly.
     mutable std::deque<GraphGuard>              _graphs;
     mutable SocketsWeights                      _socketWeights;
+    // runtime parameters cache shared by the streams, nullptr means that each stream has its own cache
+    MultiCachePtr                               _sharedParamsCache;
+    // arenas for the intermediate tensors leased by the graphs for the time of inference (Config::activationArenaSharing)
+    ActivationArenaPool::Ptr                    _activationArenaPool;
+    // input shapes seen by the dynamic model and the model cache entry they are persisted to (Config::dynamicShapesHistory)
+    ShapesHistoryPtr                            _shapesHistory;
+    std::string                                 _shapesHistoryId;
+    // statistics of the transformations applied to the model (Config::transformationsProfiling)
+    ov::pass::PassProfile                       _transformationsProfile;
 
     /* WARNING: Use GetGraph() function to get access to graph in current stream.
      * NOTE: Main thread is interpreted as master thread of external stream so use this function to get access to graphs
@@ -78,6 +96,8 @@ protected:
 
     InferenceEngine::Parameter GetConfigLegacy(const std::string &name) const;
 
+    void InitShapesHistory();
+
     InferenceEngine::Parameter GetMetricLegacy(const std::string &name, const GraphGuard& graph) const;
 };
 
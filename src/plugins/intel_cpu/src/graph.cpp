@@ -13,6 +13,8 @@
 #include <unordered_map>
 #include <memory>
 #include <utility>
+#include <set>
+#include <functional>
 
 #include "graph.h"
 #include "graph_dumper.h"
@@ -55,6 +57,8 @@
 #include <common/primitive_desc_iface.hpp>
 #if (OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO)
 #   include <tbb/task.h>
+#   include <tbb/task_group.h>
+#   include <tbb/enumerable_thread_specific.h>
 #endif
 
 using namespace dnnl;
@@ -388,6 +392,12 @@ void Graph::InitGraph() {
     ExtractExecutableNodes();
 
     status = hasDynNodes ? Status::ReadyDynamic : Status::ReadyStatic;
+
+    if (status == Status::ReadyStatic && getConfig().parallelGraphExecution)
+        BuildExecutionDAG();
+    // the placement of the edges is needed for the execution DAG only
+    edgePlacements.clear();
+    clusterPlacements.clear();
 }
 
 void Graph::InitNodes() {
@@ -481,6 +491,154 @@ void Graph::ExtractExecutableNodes() {
     }
 }
 
+static inline bool isConstOutput(EdgePtr edge) {
+    return edge->getParent()->isConstant() && !edge->getChild()->isConstant();
+}
+
+void Graph::BuildExecutionDAG() {
+    OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, "Graph::BuildExecutionDAG");
+    const size_t nodesNum = executableGraphNodes.size();
+
+    std::unordered_map<const Node*, size_t> execIndices;
+    for (size_t i = 0; i < nodesNum; i++)
+        execIndices[executableGraphNodes[i].get()] = i;
+
+    std::vector<std::set<size_t>> predecessors(nodesNum);
+
+    // Data dependencies. Non executable nodes (inputs, constants, in-place reshapes etc.) are transparent,
+    // so the search goes through them up to the nearest executable producers.
+    for (size_t i = 0; i < nodesNum; i++) {
+        std::vector<Node*> toVisit;
+        std::unordered_set<Node*> visited;
+        for (size_t j = 0; j < executableGraphNodes[i]->getParentEdges().size(); j++)
+            toVisit.push_back(executableGraphNodes[i]->getParentEdgeAt(j)->getParent().get());
+
+        while (!toVisit.empty()) {
+            auto parent = toVisit.back();
+            toVisit.pop_back();
+            if (!visited.insert(parent).second)
+                continue;
+
+            auto itr = execIndices.find(parent);
+            if (itr != execIndices.end()) {
+                predecessors[i].insert(itr->second);
+                continue;
+            }
+            for (size_t j = 0; j < parent->getParentEdges().size(); j++)
+                toVisit.push_back(parent->getParentEdgeAt(j)->getParent().get());
+        }
+    }
+
+    // Memory hazards. Tensors with non overlapping lifetimes may share the same memory (see AllocateWithReuse),
+    // as well as in-place tensors, so every pair of nodes touching overlapping memory regions, where at least one
+    // of them writes, must be executed in the sequential order.
+    // The regions are computed from the placement of the edge clusters rather than from the data pointers, which are
+    // valid for the current binding only. The workspace and the arena are rebound as a whole and the edges of a cluster
+    // follow its memory, so the offsets within them don't change. The rebindable clusters may be replaced by any
+    // external memory, e.g. the same tensor set as an input and an output, so they are treated as overlapping each
+    // other as well as their workspace regions.
+    using Domain = ClusterPlacement::Domain;
+    const size_t unknownCluster = std::numeric_limits<size_t>::max();
+    struct MemoryRegion {
+        Domain domain;
+        size_t cluster;
+        size_t begin;
+        size_t end;
+        size_t nodeIdx;
+        bool write;
+    };
+    std::vector<MemoryRegion> regions;
+    std::vector<MemoryRegion> externalRegions;
+    for (size_t i = 0; i < nodesNum; i++) {
+        const auto& node = executableGraphNodes[i];
+        auto addRegion = [&](const EdgePtr& edge, bool write) {
+            if (!edge || isConstOutput(edge))
+                return;
+            auto itr = edgePlacements.find(edge.get());
+            if (itr == edgePlacements.end()) {
+                externalRegions.push_back({Domain::None, unknownCluster, 0, std::numeric_limits<size_t>::max(), i, write});
+                return;
+            }
+            const auto& placement = clusterPlacements[itr->second];
+            // the offset of the edge memory within the cluster (the in-place edges may refer to a part of it)
+            size_t begin = 0;
+            size_t end = placement.size;
+            const auto& mem = edge->getMemoryPtr();
+            const auto& rootMem = placement.root ? placement.root->getMemoryPtr() : nullptr;
+            if (mem && rootMem && mem->isAllocated() && rootMem->isAllocated() && mem->getData() && rootMem->getData()) {
+                const auto diff = static_cast<const uint8_t*>(mem->getData()) - static_cast<const uint8_t*>(rootMem->getData());
+                if (diff >= 0) {
+                    begin = static_cast<size_t>(diff);
+                    end = begin + std::max<size_t>(mem->getSize(), 1);
+                }
+            }
+            if (placement.domain != Domain::None)
+                regions.push_back({placement.domain, itr->second, placement.offset + begin, placement.offset + end, i, write});
+            if (placement.rebindable || placement.domain == Domain::None)
+                externalRegions.push_back({Domain::None, itr->second, begin, end, i, write});
+        };
+        for (size_t j = 0; j < node->getParentEdges().size(); j++)
+            addRegion(node->getParentEdgeAt(j), false);
+        for (size_t j = 0; j < node->getChildEdges().size(); j++)
+            addRegion(node->getChildEdgeAt(j), true);
+    }
+
+    auto addHazard = [&](const MemoryRegion& lhs, const MemoryRegion& rhs) {
+        if (lhs.nodeIdx == rhs.nodeIdx || !(lhs.write || rhs.write))
+            return;
+        predecessors[std::max(lhs.nodeIdx, rhs.nodeIdx)].insert(std::min(lhs.nodeIdx, rhs.nodeIdx));
+    };
+    std::sort(regions.begin(), regions.end(), [](const MemoryRegion& lhs, const MemoryRegion& rhs) {
+        return std::make_pair(lhs.domain, lhs.begin) < std::make_pair(rhs.domain, rhs.begin);
+    });
+    for (size_t i = 0; i < regions.size(); i++) {
+        for (size_t j = i + 1; j < regions.size() && regions[j].domain == regions[i].domain && regions[j].begin < regions[i].end; j++)
+            addHazard(regions[i], regions[j]);
+    }
+    // the parts of the same cluster may be told apart, the different external clusters may overlap in any way
+    for (size_t i = 0; i < externalRegions.size(); i++) {
+        for (size_t j = i + 1; j < externalRegions.size(); j++) {
+            const auto& lhs = externalRegions[i];
+            const auto& rhs = externalRegions[j];
+            const bool sameCluster = lhs.cluster == rhs.cluster && lhs.cluster != unknownCluster;
+            if (!sameCluster || (lhs.begin < rhs.end && rhs.begin < lhs.end))
+                addHazard(lhs, rhs);
+        }
+    }
+
+    // Nodes which share a state beyond the edges (the graph scratchpad, memory states, inner graphs) keep their relative order.
+    size_t lastSerialized = nodesNum;
+    for (size_t i = 0; i < nodesNum; i++) {
+        const auto& node = executableGraphNodes[i];
+        if (node->scratchpadMem ||
+            one_of(node->getType(), Type::MemoryInput, Type::MemoryOutput, Type::TensorIterator, Type::If)) {
+            if (lastSerialized != nodesNum)
+                predecessors[i].insert(lastSerialized);
+            lastSerialized = i;
+        }
+    }
+
+    execSuccessors.assign(nodesNum, {});
+    execPredecessorsNum.assign(nodesNum, 0);
+    execRoots.clear();
+    bool hasBranches = false;
+    for (size_t i = 0; i < nodesNum; i++) {
+        execPredecessorsNum[i] = predecessors[i].size();
+        if (predecessors[i].empty())
+            execRoots.push_back(i);
+        for (auto pred : predecessors[i])
+            execSuccessors[pred].push_back(i);
+    }
+    for (size_t i = 0; i < nodesNum; i++) {
+        hasBranches |= execSuccessors[i].size() > 1;
+    }
+    hasBranches |= execRoots.size() > 1;
+
+    // a chain of nodes can't benefit from the dataflow execution, so the sequential one is kept
+    parallelExecution = hasBranches;
+    DEBUG_LOG("Graph ", _name, " parallel execution: ", parallelExecution, ", roots: ", execRoots.size());
+}
+
 void Graph::CreatePrimitivesAndExecConstants() const {
     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, "Graph::CreatePrimitivesAndExecConstants");
     dnnl::stream stream(getEngine());
@@ -668,10 +826,6 @@ void Graph::InitEdges() {
     }
 }
 
-static inline bool isConstOutput(EdgePtr edge) {
-    return edge->getParent()->isConstant() && !edge->getChild()->isConstant();
-}
-
 static edge_clusters_t findEdgeClusters(const std::vector<EdgePtr> & graphEdges) {
     typedef std::unordered_map<EdgePtr, size_t> edge_cluster_idx_map_t;
 
@@ -748,7 +902,15 @@ void Graph::AllocateWithReuse() {
 
     const int64_t alignment = 32;  // 32 bytes
 
+    edgePlacements.clear();
+    clusterPlacements.assign(remaining_edge_clusters_count, {});
+    for (size_t i = 0; i < remaining_edge_clusters_count; i++) {
+        for (auto& edge : edge_clusters[i])
+            edgePlacements[edge.get()] = i;
+    }
+
     std::vector<MemorySolver::Box> definedBoxes;
+    std::vector<MemorySolver::Box> arenaBoxes;
     std::vector<MemorySolver::Box> undefinedBoxes;
     for (size_t i = 0; i < remaining_edge_clusters_count; i++) {
         MemorySolver::Box box = { std::numeric_limits<int>::max(), 0, 0, static_cast<int64_t>(i) };
@@ -771,12 +933,14 @@ void Graph::AllocateWithReuse() {
         // Constant data are filled once on load.
         // So we need it untouchable during all execution time
         // -1 is a place holder for a max timestamp.
-        bool isConst = false, isOutput = false, isInput = false;
+        bool isConst = false, isOutput = false, isInput = false, isState = false;
         for (auto &edge : edge_clusters[i]) {
             isConst  |= isConstOutput(edge);
             isOutput |= edge->getChild()->getType() == Type::Output;
             isInput  |= edge->getParent()->getType() == Type::Input;
+            isState  |= edge->getParent()->getType() == Type::MemoryInput || edge->getChild()->getType() == Type::MemoryOutput;
         }
+        clusterPlacements[i].rebindable = isInput || isOutput || isState;
 
         if (reuse_io_tensors) {
             if (isInput | isConst) box.start = 0;
@@ -790,7 +954,12 @@ void Graph::AllocateWithReuse() {
 
         if (boxSize != -1) {
             box.size = div_up(boxSize, alignment);
-            definedBoxes.push_back(box);
+            // the tensors living within a single inference may be placed in the arena shared with the other graphs,
+            // except the ones rebound to the variable state buffers by the infer request
+            if (context->getActivationArenaPool() && box.start != 0 && box.finish != -1 && !isState)
+                arenaBoxes.push_back(box);
+            else
+                definedBoxes.push_back(box);
         } else {
             box.size = boxSize;
             undefinedBoxes.push_back(box);
@@ -805,27 +974,57 @@ void Graph::AllocateWithReuse() {
     if (edge_clusters.empty())
         return;
 
-    auto* workspace_ptr = static_cast<int8_t*>(memWorkspace->getData());
-
-    for (auto& box : definedBoxes) {
-        int count = 0;
-        for (auto& edge : edge_clusters[box.id]) {
-            if (edge->getStatus() == Edge::Status::NeedAllocation) {
-                int64_t offset = staticMemSolver.getOffset(box.id);
-                // !! Fallback to individual memory allocation !!
-                // if you like to check infer without reuse just call this function without arguments.
-                edge->allocate(workspace_ptr + offset * alignment);  // alignment in byte
+    auto allocateBoxes = [&](const std::vector<MemorySolver::Box>& boxes, MemorySolver& memSolver, int8_t* workspace_ptr,
+                             ClusterPlacement::Domain domain, const std::function<void(const EdgePtr&, size_t)>& onAllocated) {
+        for (auto& box : boxes) {
+            int count = 0;
+            for (auto& edge : edge_clusters[box.id]) {
+                if (edge->getStatus() == Edge::Status::NeedAllocation) {
+                    int64_t offset = memSolver.getOffset(box.id);
+                    auto& placement = clusterPlacements[box.id];
+                    placement.domain = domain;
+                    placement.offset = static_cast<size_t>(offset * alignment);
+                    placement.size = static_cast<size_t>(box.size * alignment);
+                    placement.root = edge;
+                    // !! Fallback to individual memory allocation !!
+                    // if you like to check infer without reuse just call this function without arguments.
+                    edge->allocate(workspace_ptr + offset * alignment);  // alignment in byte
+                    if (onAllocated)
+                        onAllocated(edge, static_cast<size_t>(offset * alignment));
+
+                    // TODO: WA for some test (like strided_slice_test) which use tensors with
+                    //       shapes {0}. And it is implisitly converted into {1} tensor.
+                    //       Zeroing of input data allow pass tests.
+                    if (edge->getParent()->type == Type::Input && edge->hasDefinedMaxSize())
+                        edge->getMemoryPtr()->nullify();
+
+                    count++;
+                }
+            }
+            IE_ASSERT(count == 1);
+        }
+    };
 
-                // TODO: WA for some test (like strided_slice_test) which use tensors with
-                //       shapes {0}. And it is implisitly converted into {1} tensor.
-                //       Zeroing of input data allow pass tests.
-                if (edge->getParent()->type == Type::Input && edge->hasDefinedMaxSize())
-                    edge->getMemoryPtr()->nullify();
+    allocateBoxes(definedBoxes, staticMemSolver, static_cast<int8_t*>(memWorkspace->getData()), ClusterPlacement::Domain::Workspace,
+                  nullptr);
 
-                count++;
-            }
+    if (!arenaBoxes.empty()) {
+        MemorySolver arenaMemSolver(arenaBoxes);
+        arenaSize = static_cast<size_t>(arenaMemSolver.solve()) * alignment;
+        // the initial placement only: the arena is returned to the pool right away and may be leased by another graph
+        // (or reallocated) before this graph infers, so the tensors stay unbound until the first inference rebinds them
+        // to the arena leased for it
+        {
+            auto lease = context->getActivationArenaPool()->acquire(arenaSize, nullptr);
+            auto onAllocated = [&](const EdgePtr& edge, size_t offset) {
+                const auto& mem = edge->getMemoryPtr();
+                arenaTensors.push_back({mem->getMemoryMngr(), offset, mem->getSize()});
+            };
+            allocateBoxes(arenaBoxes, arenaMemSolver, static_cast<int8_t*>(lease.getData()), ClusterPlacement::Domain::Arena,
+                          onAllocated);
         }
-        IE_ASSERT(count == 1);
+        arenaData = nullptr;
+        DEBUG_LOG("Graph ", _name, " leases activation arena of ", arenaSize, " bytes, private workspace ", total_size, " bytes");
     }
 
     if (!undefinedBoxes.empty()) {
@@ -1132,6 +1331,61 @@ void Graph::InferStatic(InferRequestBase* request) {
     }
 }
 
+void Graph::InferStaticParallel(InferRequestBase* request) {
+#if (OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO)
+    const size_t nodesNum = executableGraphNodes.size();
+    std::unique_ptr<std::atomic<size_t>[]> pendingPredecessors(new std::atomic<size_t>[nodesNum]);
+    for (size_t i = 0; i < nodesNum; i++)
+        pendingPredecessors[i].store(execPredecessorsNum[i], std::memory_order_relaxed);
+
+    tbb::enumerable_thread_specific<dnnl::stream> streams([this]() {
+        return dnnl::stream(getEngine());
+    });
+    tbb::task_group taskGroup;
+
+    std::function<void(size_t)> runFrom = [&](size_t nodeIdx) {
+        // the last ready successor is executed by the same thread to avoid spawning a task per node in chains
+        while (true) {
+            {
+                const auto& node = executableGraphNodes[nodeIdx];
+                VERBOSE(node, getConfig().debugCaps.verbose);
+                PERF(node, getConfig().collectPerfCounters);
+
+                if (request)
+                    request->ThrowIfCanceled();
+                ExecuteNode(node, streams.local());
+            }
+
+            size_t next = nodesNum;
+            for (auto succ : execSuccessors[nodeIdx]) {
+                if (pendingPredecessors[succ].fetch_sub(1, std::memory_order_acq_rel) != 1)
+                    continue;
+                if (next != nodesNum) {
+                    taskGroup.run([&runFrom, next]() {
+                        runFrom(next);
+                    });
+                }
+                next = succ;
+            }
+
+            if (next == nodesNum)
+                break;
+            nodeIdx = next;
+        }
+    };
+
+    for (auto root : execRoots) {
+        taskGroup.run([&runFrom, root]() {
+            runFrom(root);
+        });
+    }
+    taskGroup.wait();
+#else
+    // dataflow execution relies on the nested parallelism of TBB, other threading backends run the graph sequentially
+    InferStatic(request);
+#endif
+}
+
 namespace {
 
 class IUpdateNodes {
@@ -1361,6 +1615,28 @@ void Graph::InferDynamic(InferRequestBase* request) {
     }
 }
 
+void Graph::WarmUp(const std::map<std::string, VectorDims>& inputShapes) {
+    OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, "Graph::WarmUp");
+    if (Status::ReadyDynamic != status)
+        return;
+
+    for (const auto& input : inputShapes) {
+        const auto& inputNode = getInputNodeByName(input.first);
+        if (inputNode->isDynamicNode()) {
+            inputNode->redefineOutputMemory({input.second});
+        }
+    }
+
+    // output shapes of the nodes after the first synchronization point depend on the computed data
+    size_t stopIndx = executableGraphNodes.size();
+    for (const auto& nodeIndx : syncNodesInds) {
+        stopIndx = std::min(stopIndx, nodeIndx.second);
+    }
+
+    UpdateNodesSeq updateNodes(executableGraphNodes);
+    updateNodes.run(stopIndx);
+}
+
 inline void Graph::ExecuteNode(const NodePtr& node, const dnnl::stream& stream) const {
     DUMP(node, getConfig().debugCaps, infer_count);
 
@@ -1373,15 +1649,37 @@ inline void Graph::ExecuteNode(const NodePtr& node, const dnnl::stream& stream)
     }
 }
 
+ActivationArenaPool::Lease Graph::LeaseArena() {
+    if (arenaTensors.empty())
+        return {};
+
+    auto lease = context->getActivationArenaPool()->acquire(arenaSize, arenaData);
+    // arenaData is null before the first inference, so the tensors are always bound to the leased arena then
+    if (lease.getData() != arenaData) {
+        // the memory managers notify the memory objects (and the primitives arguments) sharing them
+        arenaData = lease.getData();
+        for (const auto& tensor : arenaTensors) {
+            tensor.mngr->setExtBuff(static_cast<int8_t*>(arenaData) + tensor.offset, tensor.size);
+        }
+    }
+    return lease;
+}
+
 void Graph::Infer(InferRequestBase* request) {
     if (!IsReady()) {
         IE_THROW() << "Wrong state of the ov::intel_cpu::Graph. Topology is not ready.";
     }
 
+    // the intermediate tensors are valid only within the inference, the arena is returned to the pool right after it
+    const auto arenaLease = LeaseArena();
+
     if (Status::ReadyDynamic == status) {
         InferDynamic(request);
     } else if (Status::ReadyStatic == status) {
-        InferStatic(request);
+        if (parallelExecution)
+            InferStaticParallel(request);
+        else
+            InferStatic(request);
     } else {
         IE_THROW() << "Unknown ov::intel_cpu::Graph state: " << static_cast<size_t>(status);
     }
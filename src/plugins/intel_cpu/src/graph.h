@@ -18,6 +18,8 @@
 #include <vector>
 #include <memory>
 #include <atomic>
+#include <limits>
+#include <unordered_map>
 
 #include "proxy_mem_mgr.h"
 
@@ -65,6 +67,15 @@ public:
 
     void Infer(InferRequestBase* request = nullptr);
 
+    /**
+     * @brief Prepares the dynamic nodes for the given input shapes without execution, so the executors and primitives
+     * are created and put into the runtime parameters cache in advance. Only the nodes preceding the first node with
+     * data dependent output shapes are prepared.
+     * @param inputShapes
+     * input name to input dims map
+     */
+    void WarmUp(const std::map<std::string, VectorDims>& inputShapes);
+
     const std::vector<NodePtr>& GetNodes() const {
         return graphNodes;
     }
@@ -206,6 +217,15 @@ protected:
         graphEdges.clear();
         _normalizePreprocMap.clear();
         syncNodesInds.clear();
+        execSuccessors.clear();
+        execPredecessorsNum.clear();
+        execRoots.clear();
+        parallelExecution = false;
+        edgePlacements.clear();
+        clusterPlacements.clear();
+        arenaTensors.clear();
+        arenaSize = 0;
+        arenaData = nullptr;
     }
     Status status { Status::NotReady };
 
@@ -217,6 +237,18 @@ protected:
 
     MemoryPtr memWorkspace;
 
+    // Intermediate tensors placed in the arena leased from the compiled model pool for the time of the inference
+    // (see Config::activationArenaSharing). The tensors are rebound if the graph gets another arena than last time,
+    // arenaData is null until the first inference.
+    struct ArenaTensor {
+        MemoryMngrPtr mngr;
+        size_t offset;
+        size_t size;
+    };
+    std::vector<ArenaTensor> arenaTensors;
+    size_t arenaSize = 0;
+    void* arenaData = nullptr;
+
     std::vector<NodePtr> graphNodes;
     std::vector<EdgePtr> graphEdges;
 
@@ -239,8 +271,11 @@ protected:
     void ExtractExecutableNodes();
     void ExecuteNode(const NodePtr& node, const dnnl::stream& stream) const;
     void CreatePrimitivesAndExecConstants() const;
+    void BuildExecutionDAG();
     void InferStatic(InferRequestBase* request);
+    void InferStaticParallel(InferRequestBase* request);
     void InferDynamic(InferRequestBase* request);
+    ActivationArenaPool::Lease LeaseArena();
 
     friend class LegacyInferRequest;
     friend class intel_cpu::InferRequest;
@@ -261,6 +296,32 @@ private:
 
     std::unordered_map<Node*, size_t> syncNodesInds;
 
+    // dependency DAG over executableGraphNodes (indices into the vector) used by the parallel static execution mode
+    std::vector<std::vector<size_t>> execSuccessors;
+    std::vector<size_t> execPredecessorsNum;
+    std::vector<size_t> execRoots;
+    bool parallelExecution = false;
+
+    // Placement of the edge clusters (the edges sharing memory in place) made by AllocateWithReuse, the memory hazards
+    // of the execution DAG are computed from it, since the memory of the edges may be rebound at runtime.
+    struct ClusterPlacement {
+        enum class Domain {
+            None,       // not placed by the memory solver
+            Workspace,
+            Arena
+        };
+        Domain domain = Domain::None;
+        size_t offset = 0;
+        // size of the cluster memory in bytes, the max value if it's unknown
+        size_t size = std::numeric_limits<size_t>::max();
+        // the memory may be replaced by the external one at runtime (the inputs, the outputs and the states)
+        bool rebindable = false;
+        // the edge the cluster memory is allocated for, the other edges refer to its memory
+        EdgePtr root;
+    };
+    std::unordered_map<const Edge*, size_t> edgePlacements;
+    std::vector<ClusterPlacement> clusterPlacements;
+
     GraphContext::CPtr context;
 
     void EnforceInferencePrecision();
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include "activation_arena_pool.h"
 #include "cache/multi_cache.h"
 #include "config.h"
 #include "dnnl_scratch_pad.h"
@@ -21,12 +22,19 @@ public:
     GraphContext(const Config& config,
                  ExtensionManager::Ptr extensionManager,
                  WeightsSharing::Ptr w_cache,
-                 bool isGraphQuantized)
+                 bool isGraphQuantized,
+                 MultiCachePtr sharedParamsCache = nullptr,
+                 ActivationArenaPool::Ptr activationArenaPool = nullptr)
         : config(config),
           extensionManager(extensionManager),
           weightsCache(w_cache),
+          activationArenaPool(activationArenaPool),
           isGraphQuantizedFlag(isGraphQuantized) {
-        rtParamsCache = std::make_shared<MultiCache>(config.rtCacheCapacity);
+        // the shared cache keeps the reentrant executors only, the rest of them are cached by the stream
+        if (sharedParamsCache)
+            rtParamsCache = std::make_shared<MultiCache>(config.rtCacheCapacity, sharedParamsCache);
+        else
+            rtParamsCache = std::make_shared<MultiCache>(config.rtCacheCapacity);
         rtScratchPad = std::make_shared<DnnlScratchPad>(eng);
     }
 
@@ -51,6 +59,10 @@ public:
         return rtScratchPad;
     }
 
+    ActivationArenaPool::Ptr getActivationArenaPool() const {
+        return activationArenaPool;
+    }
+
     dnnl::engine getEngine() const {
         return eng;
     }
@@ -65,9 +77,11 @@ private:
     ExtensionManager::Ptr extensionManager;
     WeightsSharing::Ptr weightsCache;         // per NUMA node caches for sharing weights data
 
-    MultiCachePtr rtParamsCache;     // primitive cache
+    MultiCachePtr rtParamsCache;     // primitive cache of the stream, may refer to the shared one (see Config::rtCacheSharing)
     DnnlScratchPadPtr rtScratchPad;  // scratch pad
 
+    ActivationArenaPool::Ptr activationArenaPool;  // arenas shared by the graphs of the model, nullptr if not shared
+
     bool isGraphQuantizedFlag = false;
     static dnnl::engine eng;  // onednn engine (singleton)
 };
@@ -27,6 +27,7 @@
 #include <ie_ngraph_utils.hpp>
 #include "proxy_mem_mgr.h"
 #include "openvino/runtime/make_tensor.hpp"
+#include "openvino/util/log.hpp"
 #include <utils/general_utils.h>
 
 namespace ov {
@@ -59,12 +60,18 @@ void InferRequestBase::CreateInferRequest() {
             if (suffix_idx != std::string::npos)
                 state_name = state_name.substr(0, suffix_idx);
 
-            memoryStates.emplace_back(new VariableState(state_name, state_store));
+            memoryStates.emplace_back(new VariableState(state_name, memoryNode->getEngine(),
+                                                         memoryNode->getBaseMemDescAtOutputPort(0), state_store));
         }
     }
 }
 
 InferRequestBase::~InferRequestBase() {
+    try {
+        UnbindStates();
+    } catch (const std::exception& e) {
+        OPENVINO_WARN << "Failed to unbind the variable states of the CPU infer request: " << e.what();
+    }
     --(execNetwork->_numRequests);
 }
 
@@ -95,45 +102,93 @@ void InferRequestBase::pushInput(const std::string& inputName, InferenceEngine::
     graph->PushInputData(inputName, needConvert ? iconv : inputBlob);
 }
 
+static VariableState* findState(const std::vector<InferenceEngine::IVariableStateInternal::Ptr>& states,
+                                const std::string& id) {
+    for (const auto& state : states) {
+        if (state->GetName() == id) {
+            auto cpuState = dynamic_cast<VariableState*>(state.get());
+            if (!cpuState) {
+                IE_THROW() << "Cannot cast state " << id << " to the CPU variable state";
+            }
+            return cpuState;
+        }
+    }
+    return nullptr;
+}
+
 void InferRequestBase::PushStates() {
+    // the state buffers are bound to the memory nodes, so ReadValue reads the current state and Assign writes
+    // the next one without copying them through the node stores
+    std::vector<std::pair<node::MemoryOutput*, VariableState*>> outputs;
+    for (auto &node : graph->GetNodes()) {
+        if (node->getType() == Type::MemoryOutput) {
+            auto cur_node = dynamic_cast<node::MemoryOutput*>(node.get());
+            if (!cur_node) {
+                IE_THROW() << "Cannot cast " << node->getName() << " to MemoryOutput";
+            }
+            auto state = findState(memoryStates, cur_node->getId());
+            // the capacity for the appended data is reserved before the current buffer is bound to the ReadValue
+            const auto axis = cur_node->getAppendAxis();
+            if (state && axis >= 0)
+                state->reserveForAppend(static_cast<size_t>(axis), execNetwork->_cfg.stateMaxLengthHint);
+            outputs.emplace_back(cur_node, state);
+        }
+    }
+
     for (auto &node : graph->GetNodes()) {
         if (node->getType() == Type::MemoryInput) {
             auto cur_node = dynamic_cast<node::MemoryInput*>(node.get());
             if (!cur_node) {
                 IE_THROW() << "Cannot cast " << node->getName() << " to MemoryInput";
             }
-            auto cur_id = cur_node->getId();
-            for (const auto& state : memoryStates) {
-                if (state->GetName() == cur_id) {
-                    auto cur_state_mem = cur_node->getStore();
-                    auto data_ptr = state->GetState()->cbuffer().as<void*>();
-                    auto data_size = state->GetState()->byteSize();
-                    auto cur_state_mem_buf = static_cast<uint8_t*>(cur_state_mem->getData());
-
-                    cpu_memcpy(cur_state_mem_buf, data_ptr, data_size);
-                }
-            }
+            if (auto state = findState(memoryStates, cur_node->getId()))
+                cur_node->bindState(state->getCurrent(), state->getCurrentCapacity());
+        }
+    }
+
+    for (auto& output : outputs) {
+        auto state = output.second;
+        if (!state) {
+            output.first->bindState(nullptr, 0);
+            continue;
         }
+        output.first->bindState(state->getNext(), state->getNextCapacity(), state->getCurrent(), state->getCurrentCapacity());
     }
 }
 
 void InferRequestBase::PullStates() {
     for (auto &node : graph->GetNodes()) {
-        if (node->getType() == Type::MemoryInput) {
-            auto cur_node = dynamic_cast<node::MemoryInput*>(node.get());
+        if (node->getType() == Type::MemoryOutput) {
+            auto cur_node = dynamic_cast<node::MemoryOutput*>(node.get());
             if (!cur_node) {
-                IE_THROW() << "Cannot cast " << node->getName() << " to MemoryInput";
+                IE_THROW() << "Cannot cast " << node->getName() << " to MemoryOutput";
             }
-            auto cur_id = cur_node->getId();
-            for (const auto& state : memoryStates) {
-                if (state->GetName() == cur_id) {
-                    auto cur_state_mem = cur_node->getStore();
-                    auto data_ptr = state->GetState()->cbuffer().as<void*>();
-                    auto data_size = state->GetState()->byteSize();
-                    auto cur_state_mem_buf = static_cast<uint8_t*>(cur_state_mem->getData());
-
-                    cpu_memcpy(data_ptr, cur_state_mem_buf, data_size);
-                }
+            // the state without Assign keeps its value
+            if (auto state = findState(memoryStates, cur_node->getId()))
+                state->commit(cur_node->isStateAppended());
+        }
+    }
+}
+
+void InferRequestBase::UnbindStates() {
+    if (memoryStates.empty())
+        return;
+    // the request may have inferred on any stream, so each graph still referencing its buffers is restored
+    for (auto& graphGuard : execNetwork->_graphs) {
+        ExecNetwork::GraphGuard::Lock graphLock{graphGuard};
+        if (!graphLock._graph.IsReady())
+            continue;
+        for (auto& node : graphLock._graph.GetNodes()) {
+            if (node->getType() == Type::MemoryInput) {
+                auto cur_node = dynamic_cast<node::MemoryInput*>(node.get());
+                auto state = cur_node ? findState(memoryStates, cur_node->getId()) : nullptr;
+                if (state && (cur_node->isBoundTo(state->getCurrent()) || cur_node->isBoundTo(state->getNext())))
+                    cur_node->unbindState();
+            } else if (node->getType() == Type::MemoryOutput) {
+                auto cur_node = dynamic_cast<node::MemoryOutput*>(node.get());
+                auto state = cur_node ? findState(memoryStates, cur_node->getId()) : nullptr;
+                if (state && (cur_node->isBoundTo(state->getCurrent()) || cur_node->isBoundTo(state->getNext())))
+                    cur_node->unbindState();
             }
         }
     }
@@ -141,15 +196,32 @@ void InferRequestBase::PullStates() {
 
 void InferRequestBase::redefineMemoryForInputNodes() {
     const auto cpuInputNodes = graph->GetInputNodesMap();
+    const auto& shapesHistory = execNetwork->_shapesHistory;
+    bool signatureChanged = false;
 
     for (const auto &blob : _inputs) {
         const auto inputNode = cpuInputNodes.find(blob.first);
         if (inputNode == cpuInputNodes.end())
             IE_THROW() << "CPU execution graph doesn't contain input node with name: " << blob.first;
         if (inputNode->second->isDynamicNode()) {
-            inputNode->second->redefineOutputMemory({blob.second->getTensorDesc().getDims()});
+            const auto& dims = blob.second->getTensorDesc().getDims();
+            inputNode->second->redefineOutputMemory({dims});
+            if (shapesHistory) {
+                // the set of the inputs is the same for each inference, so the signature is updated in place
+                const auto recorded = lastSignature.emplace(blob.first, dims);
+                if (recorded.second) {
+                    signatureChanged = true;
+                } else if (recorded.first->second != dims) {
+                    recorded.first->second = dims;
+                    signatureChanged = true;
+                }
+            }
         }
     }
+
+    // the history is consulted only when the request sees new shapes, the repeated ones cost nothing
+    if (signatureChanged)
+        shapesHistory->record(lastSignature);
 }
 
 void InferRequestBase::InferImpl() {
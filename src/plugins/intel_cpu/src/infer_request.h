@@ -10,6 +10,7 @@
 #include <map>
 #include <cpp_interfaces/interface/ie_iinfer_request_internal.hpp>
 #include "cpu_tensor.h"
+#include "cache/shapes_history.h"
 
 namespace ov {
 namespace intel_cpu {
@@ -116,12 +117,15 @@ protected:
 private:
     void PushStates();
     void PullStates();
+    void UnbindStates();
     void redefineMemoryForInputNodes();
 
     std::shared_ptr<ExecNetwork>        execNetwork;
     openvino::itt::handle_t             profilingTask;
     std::vector<std::shared_ptr<InferenceEngine::IVariableStateInternal>> memoryStates;
     AsyncInferRequest*                  _asyncRequest = nullptr;
+    // the input shapes of the last inference recorded to the shapes history of the compiled model
+    ShapesHistory::Signature            lastSignature;
 
 protected:
     virtual void changeDefaultPtr();
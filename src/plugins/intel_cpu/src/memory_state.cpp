@@ -11,10 +11,79 @@ using namespace InferenceEngine;
 namespace ov {
 namespace intel_cpu {
 
+VariableState::VariableState(std::string name, const dnnl::engine& eng, MemoryDescPtr desc, MemoryPtr storage)
+    : InferenceEngine::IVariableStateInternal{name}, variableDesc(std::move(desc)), initialDesc(storage->getDescPtr()) {
+    for (size_t i = 0; i < buffers.size(); i++) {
+        std::unique_ptr<MemoryMngrWithGrowth> mngr(new MemoryMngrWithGrowth());
+        mngrs[i] = mngr.get();
+        buffers[i] = std::make_shared<Memory>(eng, initialDesc, std::make_shared<DnnlMemoryMngr>(std::move(mngr)));
+    }
+    if (storage->getSize())
+        cpu_memcpy(getCurrent()->getData(), storage->getData(), storage->getSize());
+    getNext()->nullify();
+    state = make_blob_with_precision(MemoryDescUtils::convertToTensorDesc(storage->getDesc()));
+    state->allocate();
+}
+
 void VariableState::Reset() {
-    std::memset(state->buffer(), 0, state->byteSize());
+    getCurrent()->redefineDesc(initialDesc);
+    getCurrent()->nullify();
+}
+
+void VariableState::SetState(const Blob::Ptr& newState) {
+    if (!newState) {
+        IE_THROW() << "Cannot set state " << GetName() << ": the new state is empty";
+    }
+    const auto& dims = newState->getTensorDesc().getDims();
+    if (!variableDesc->getShape().isStatic() && variableDesc->getShape().isCompatible(dims))
+        getCurrent()->redefineDesc(variableDesc->cloneWithNewDims(dims, true));
+    if (newState->byteSize() != getCurrent()->getSize()) {
+        IE_THROW() << "Cannot set state " << GetName() << ": the size of the new state doesn't match the variable size";
+    }
+    cpu_memcpy(getCurrent()->getData(), newState->cbuffer().as<const void*>(), newState->byteSize());
+}
+
+Blob::CPtr VariableState::GetState() const {
+    const auto& current = getCurrent();
+    auto result = state;
+    // the shape of a dynamic state may differ from the one of the blob allocated last time
+    if (result->getTensorDesc().getDims() != current->getStaticDims()) {
+        result = make_blob_with_precision(MemoryDescUtils::convertToTensorDesc(current->getDesc()));
+        result->allocate();
+    }
+    cpu_memcpy(result->buffer().as<void*>(), current->getData(), current->getSize());
+    return result;
+}
+
+void VariableState::reserveForAppend(size_t axis, size_t maxLengthHint) {
+    const auto& current = getCurrent();
+    sizeBeforeAppend = current->getSize();
+    appending = true;
+
+    size_t required = sizeBeforeAppend + lastAppendSize;
+    const auto& dims = current->getStaticDims();
+    if (maxLengthHint && axis < dims.size()) {
+        size_t positionSize = current->getDesc().getPrecision().size();
+        for (size_t i = 0; i < dims.size(); i++) {
+            if (i != axis)
+                positionSize *= dims[i];
+        }
+        required = std::max(required, positionSize * maxLengthHint);
+    }
+    // the growing manager keeps the data on reallocation
+    if (required > getCurrentCapacity())
+        current->getMemoryMngr()->resize(required);
+}
+
+void VariableState::commit(bool appended) {
+    if (!appended)
+        currentIdx ^= 1;
+    if (appending) {
+        const auto size = getCurrent()->getSize();
+        lastAppendSize = size > sizeBeforeAppend ? size - sizeBeforeAppend : 0;
+        appending = false;
+    }
 }
 
 }   // namespace intel_cpu
 }   // namespace ov
-
@@ -10,21 +10,79 @@
 #include "nodes/common/cpu_memcpy.h"
 #include "memory_desc/cpu_memory_desc_utils.h"
 
+#include <array>
 #include <string>
 
 namespace ov {
 namespace intel_cpu {
 
+/**
+ * @brief Variable state of an infer request backed by two CPU memory buffers.
+ * The ReadValue node reads the current buffer while the Assign node writes the next one, so after the inference the
+ * new state is committed by swapping the buffers instead of copying the data. The state blob exposed to the user is
+ * materialized on demand only.
+ * The buffers keep extra capacity, so the state of a dynamic shape may grow from one inference to another without
+ * reallocation. When the new state is the current one with some data appended (e.g. the KV cache of an autoregressive
+ * model), the data is appended to the current buffer in place and the buffers are not swapped.
+ */
 class VariableState : public InferenceEngine::IVariableStateInternal {
 public:
-    VariableState(std::string name, MemoryPtr storage)
-        : InferenceEngine::IVariableStateInternal{name} {
-        state = make_blob_with_precision(MemoryDescUtils::convertToTensorDesc(storage->getDesc()));
-        state->allocate();
-        cpu_memcpy(state->buffer(), storage->getData(), storage->getSize());
-    }
+    /**
+     * @param name name of the variable
+     * @param eng engine the buffers are allocated for
+     * @param desc descriptor of the variable, the shape may be dynamic
+     * @param storage initial value of the state
+     */
+    VariableState(std::string name, const dnnl::engine& eng, MemoryDescPtr desc, MemoryPtr storage);
 
     void Reset() override;
+    void SetState(const InferenceEngine::Blob::Ptr& newState) override;
+    InferenceEngine::Blob::CPtr GetState() const override;
+
+    // buffer read by the ReadValue node
+    MemoryPtr getCurrent() const {
+        return buffers[currentIdx];
+    }
+
+    size_t getCurrentCapacity() const {
+        return mngrs[currentIdx]->getCapacity();
+    }
+
+    // buffer written by the Assign node
+    MemoryPtr getNext() const {
+        return buffers[currentIdx ^ 1];
+    }
+
+    size_t getNextCapacity() const {
+        return mngrs[currentIdx ^ 1]->getCapacity();
+    }
+
+    /**
+     * @brief Reserves the capacity of the current buffer for appending the data along the axis in place.
+     * The buffer is expected to grow by the same amount as during the previous inference.
+     * @param axis the axis the data is appended along
+     * @param maxLengthHint expected maximum length of the state along the axis, 0 if unknown
+     */
+    void reserveForAppend(size_t axis, size_t maxLengthHint);
+
+    /**
+     * @brief Commits the new state
+     * @param appended true if the new state has been appended to the current buffer in place,
+     *        otherwise the new state is in the next buffer and the buffers are swapped
+     */
+    void commit(bool appended = false);
+
+private:
+    std::array<MemoryPtr, 2> buffers;
+    // the managers are owned by the buffers
+    std::array<MemoryMngrWithGrowth*, 2> mngrs;
+    size_t currentIdx = 0;
+    MemoryDescPtr variableDesc;
+    MemoryDescPtr initialDesc;
+    // size of the current buffer before the inference appending the data, and the amount appended last time
+    size_t sizeBeforeAppend = 0;
+    size_t lastAppendSize = 0;
+    bool appending = false;
 };
 
 }   // namespace intel_cpu
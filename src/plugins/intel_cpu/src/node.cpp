@@ -880,6 +880,18 @@ MemoryPtr Node::prepareWeightMemory(DnnlMemoryDescPtr dstWeightDesc, DnnlMemoryD
     }
 
     auto create = [&] () {
+        // the weights are already in the required layout, so the constant memory is used directly without
+        // the copy (the constant is kept alive by the graph as long as the node using the weights), unless
+        // the weights cache keeps the copies per socket (see Config::constantsInPlace) and the weights are not
+        // mapped from the model file
+        auto input = std::dynamic_pointer_cast<node::Input>(getParentEdgeAt(1)->getParent());
+        if ((!context->getWeightsCache() || context->getConfig().constantsInPlace ||
+             (input && input->isMappedConstant())) &&
+            srcWeightDesc->isCompatible(*dstWeightDesc) &&
+            edgeMem->getSize() >= dstWeightDesc->getCurrentMemSize()) {
+            MemoryPtr _ptr = std::make_shared<Memory>(getEngine(), dstWeightDesc, edgeMem->getData());
+            return _ptr;
+        }
         Memory srcMemory{ getEngine(), srcWeightDesc, edgeMem->getData() };
         MemoryPtr _ptr = std::make_shared<Memory>(getEngine(), dstWeightDesc);
         node::Reorder::reorderData(srcMemory, *_ptr, context->getParamsCache());
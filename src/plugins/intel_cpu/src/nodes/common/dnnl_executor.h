@@ -5,6 +5,7 @@
 #pragma once
 
 #include <cpu_memory.h>
+#include "cache/multi_cache.h"
 #include <onednn/iml_type_mapper.h>
 
 namespace ov {
@@ -74,5 +75,10 @@ class DnnlExecutor {
         DnnlMemoryDescPtr scrch_md;
 };
 
+// the primitive is executed with the scratchpad of the stream and the intermediate reorders allocate their buffers
+// on each call, so the executor may be shared between the streams
+template<>
+struct is_shareable_cache_value<std::shared_ptr<DnnlExecutor>> : std::true_type {};
+
 }   // namespace intel_cpu
 }   // namespace ov
@@ -0,0 +1,78 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "nms_kernel.hpp"
+
+#include <array>
+#include <bitset>
+#include <cstdint>
+#if defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+#include <immintrin.h>
+#endif
+
+namespace ov {
+namespace intel_cpu {
+namespace XARCH {
+
+#if defined(HAVE_AVX2) && !defined(HAVE_AVX512F)
+// positions of the set bits of every 8-bit mask, used to compact the lanes with a single permutation
+static const std::array<std::array<int32_t, 8>, 256>& compress_table() {
+    static const std::array<std::array<int32_t, 8>, 256> table = [] {
+        std::array<std::array<int32_t, 8>, 256> positions{};
+        for (size_t mask = 0; mask < positions.size(); mask++) {
+            size_t count = 0;
+            for (int32_t bit = 0; bit < 8; bit++) {
+                if (mask & (1 << bit))
+                    positions[mask][count++] = bit;
+            }
+        }
+        return positions;
+    }();
+    return table;
+}
+#endif
+
+size_t nms_filter_scores(const float* scores, size_t num, float threshold, bool inclusive, int* indices) {
+    size_t count = 0;
+    size_t i = 0;
+
+#if defined(HAVE_AVX512F)
+    const __m512 v_threshold = _mm512_set1_ps(threshold);
+    const __m512i v_step = _mm512_set1_epi32(16);
+    __m512i v_indices = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+    for (; i + 16 <= num; i += 16) {
+        const __m512 v_scores = _mm512_loadu_ps(scores + i);
+        const __mmask16 mask = inclusive ? _mm512_cmp_ps_mask(v_scores, v_threshold, _CMP_GE_OQ)
+                                         : _mm512_cmp_ps_mask(v_scores, v_threshold, _CMP_GT_OQ);
+        _mm512_mask_compressstoreu_epi32(indices + count, mask, v_indices);
+        count += std::bitset<16>(mask).count();
+        v_indices = _mm512_add_epi32(v_indices, v_step);
+    }
+#elif defined(HAVE_AVX2)
+    const __m256 v_threshold = _mm256_set1_ps(threshold);
+    const auto& table = compress_table();
+    for (; i + 8 <= num; i += 8) {
+        const __m256 v_scores = _mm256_loadu_ps(scores + i);
+        const int mask = _mm256_movemask_ps(inclusive ? _mm256_cmp_ps(v_scores, v_threshold, _CMP_GE_OQ)
+                                                      : _mm256_cmp_ps(v_scores, v_threshold, _CMP_GT_OQ));
+        // the full vector is stored, the lanes after count are overwritten by the next iterations,
+        // it never gets out of the bounds since count <= i
+        const __m256i positions = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(table[mask].data()));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(indices + count),
+                            _mm256_add_epi32(positions, _mm256_set1_epi32(static_cast<int>(i))));
+        count += std::bitset<8>(mask).count();
+    }
+#endif
+
+    // branch free compaction
+    for (; i < num; i++) {
+        indices[count] = static_cast<int>(i);
+        count += inclusive ? scores[i] >= threshold : scores[i] > threshold;
+    }
+    return count;
+}
+
+}  // namespace XARCH
+}  // namespace intel_cpu
+}  // namespace ov
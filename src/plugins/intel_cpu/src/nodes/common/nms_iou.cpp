@@ -0,0 +1,147 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "nms_kernel.hpp"
+
+#include <algorithm>
+#include <limits>
+#if defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+#include <immintrin.h>
+#endif
+
+namespace ov {
+namespace intel_cpu {
+namespace XARCH {
+
+float nms_max_iou(const NmsBoxes& boxes, size_t idx, const NmsBoxes& others, size_t begin, size_t end,
+                  const NmsIouConfig& config, float stop_iou, float* ious) {
+    const float ymin = boxes.ymin[idx];
+    const float xmin = boxes.xmin[idx];
+    const float ymax = boxes.ymax[idx];
+    const float xmax = boxes.xmax[idx];
+    const float area = boxes.area[idx];
+    const float offset = config.offset;
+    const bool overlap_only = config.overlap_only;
+
+    const float* o_ymin_ptr = others.ymin.data();
+    const float* o_xmin_ptr = others.xmin.data();
+    const float* o_ymax_ptr = others.ymax.data();
+    const float* o_xmax_ptr = others.xmax.data();
+    const float* o_area_ptr = others.area.data();
+
+    float max_iou = -std::numeric_limits<float>::infinity();
+    size_t i = begin;
+
+#if defined(HAVE_AVX512F)
+    const __m512 v_ymin = _mm512_set1_ps(ymin);
+    const __m512 v_xmin = _mm512_set1_ps(xmin);
+    const __m512 v_ymax = _mm512_set1_ps(ymax);
+    const __m512 v_xmax = _mm512_set1_ps(xmax);
+    const __m512 v_area = _mm512_set1_ps(area);
+    const __m512 v_offset = _mm512_set1_ps(offset);
+    const __m512 v_zero = _mm512_setzero_ps();
+    const __m512 v_stop = _mm512_set1_ps(stop_iou);
+    const __mmask16 area_valid = _mm512_cmp_ps_mask(v_area, v_zero, _CMP_GT_OQ);
+    __m512 v_max = _mm512_set1_ps(max_iou);
+    for (; i + 16 <= end; i += 16) {
+        const __m512 o_ymin = _mm512_loadu_ps(o_ymin_ptr + i);
+        const __m512 o_xmin = _mm512_loadu_ps(o_xmin_ptr + i);
+        const __m512 o_ymax = _mm512_loadu_ps(o_ymax_ptr + i);
+        const __m512 o_xmax = _mm512_loadu_ps(o_xmax_ptr + i);
+        const __m512 o_area = _mm512_loadu_ps(o_area_ptr + i);
+
+        // the operands of min/max are swapped to match std::min/std::max of the scalar code for NaN
+        __m512 height = _mm512_add_ps(_mm512_sub_ps(_mm512_min_ps(o_ymax, v_ymax), _mm512_max_ps(o_ymin, v_ymin)), v_offset);
+        __m512 width = _mm512_add_ps(_mm512_sub_ps(_mm512_min_ps(o_xmax, v_xmax), _mm512_max_ps(o_xmin, v_xmin)), v_offset);
+        __mmask16 valid;
+        if (overlap_only) {
+            valid = _mm512_cmp_ps_mask(o_xmin, v_xmax, _CMP_NGT_UQ) & _mm512_cmp_ps_mask(o_xmax, v_xmin, _CMP_NLT_UQ) &
+                    _mm512_cmp_ps_mask(o_ymin, v_ymax, _CMP_NGT_UQ) & _mm512_cmp_ps_mask(o_ymax, v_ymin, _CMP_NLT_UQ);
+        } else {
+            height = _mm512_max_ps(v_zero, height);
+            width = _mm512_max_ps(v_zero, width);
+            valid = area_valid & _mm512_cmp_ps_mask(o_area, v_zero, _CMP_GT_OQ);
+        }
+        const __m512 intersection = _mm512_mul_ps(height, width);
+        const __m512 iou = _mm512_maskz_div_ps(valid, intersection,
+                                               _mm512_sub_ps(_mm512_add_ps(v_area, o_area), intersection));
+        if (ious)
+            _mm512_storeu_ps(ious + i - begin, iou);
+        v_max = _mm512_max_ps(iou, v_max);
+        if (_mm512_cmp_ps_mask(v_max, v_stop, _CMP_GE_OQ))
+            return _mm512_reduce_max_ps(v_max);
+    }
+    max_iou = _mm512_reduce_max_ps(v_max);
+#elif defined(HAVE_AVX2)
+    const __m256 v_ymin = _mm256_set1_ps(ymin);
+    const __m256 v_xmin = _mm256_set1_ps(xmin);
+    const __m256 v_ymax = _mm256_set1_ps(ymax);
+    const __m256 v_xmax = _mm256_set1_ps(xmax);
+    const __m256 v_area = _mm256_set1_ps(area);
+    const __m256 v_offset = _mm256_set1_ps(offset);
+    const __m256 v_zero = _mm256_setzero_ps();
+    const __m256 v_stop = _mm256_set1_ps(stop_iou);
+    const __m256 area_valid = _mm256_cmp_ps(v_area, v_zero, _CMP_GT_OQ);
+    __m256 v_max = _mm256_set1_ps(max_iou);
+    auto reduce_max = [](__m256 vec) {
+        __m128 res = _mm_max_ps(_mm256_castps256_ps128(vec), _mm256_extractf128_ps(vec, 1));
+        res = _mm_max_ps(res, _mm_movehl_ps(res, res));
+        res = _mm_max_ss(res, _mm_shuffle_ps(res, res, 1));
+        return _mm_cvtss_f32(res);
+    };
+    for (; i + 8 <= end; i += 8) {
+        const __m256 o_ymin = _mm256_loadu_ps(o_ymin_ptr + i);
+        const __m256 o_xmin = _mm256_loadu_ps(o_xmin_ptr + i);
+        const __m256 o_ymax = _mm256_loadu_ps(o_ymax_ptr + i);
+        const __m256 o_xmax = _mm256_loadu_ps(o_xmax_ptr + i);
+        const __m256 o_area = _mm256_loadu_ps(o_area_ptr + i);
+
+        __m256 height = _mm256_add_ps(_mm256_sub_ps(_mm256_min_ps(o_ymax, v_ymax), _mm256_max_ps(o_ymin, v_ymin)), v_offset);
+        __m256 width = _mm256_add_ps(_mm256_sub_ps(_mm256_min_ps(o_xmax, v_xmax), _mm256_max_ps(o_xmin, v_xmin)), v_offset);
+        __m256 valid;
+        if (overlap_only) {
+            valid = _mm256_and_ps(_mm256_and_ps(_mm256_cmp_ps(o_xmin, v_xmax, _CMP_NGT_UQ), _mm256_cmp_ps(o_xmax, v_xmin, _CMP_NLT_UQ)),
+                                  _mm256_and_ps(_mm256_cmp_ps(o_ymin, v_ymax, _CMP_NGT_UQ), _mm256_cmp_ps(o_ymax, v_ymin, _CMP_NLT_UQ)));
+        } else {
+            height = _mm256_max_ps(v_zero, height);
+            width = _mm256_max_ps(v_zero, width);
+            valid = _mm256_and_ps(area_valid, _mm256_cmp_ps(o_area, v_zero, _CMP_GT_OQ));
+        }
+        const __m256 intersection = _mm256_mul_ps(height, width);
+        const __m256 iou = _mm256_and_ps(valid, _mm256_div_ps(intersection,
+                                                              _mm256_sub_ps(_mm256_add_ps(v_area, o_area), intersection)));
+        if (ious)
+            _mm256_storeu_ps(ious + i - begin, iou);
+        v_max = _mm256_max_ps(iou, v_max);
+        if (_mm256_movemask_ps(_mm256_cmp_ps(v_max, v_stop, _CMP_GE_OQ)))
+            return reduce_max(v_max);
+    }
+    max_iou = reduce_max(v_max);
+#endif
+
+    for (; i < end; i++) {
+        float height = (std::min)(ymax, o_ymax_ptr[i]) - (std::max)(ymin, o_ymin_ptr[i]) + offset;
+        float width = (std::min)(xmax, o_xmax_ptr[i]) - (std::max)(xmin, o_xmin_ptr[i]) + offset;
+        bool valid;
+        if (overlap_only) {
+            valid = !(o_xmin_ptr[i] > xmax || o_xmax_ptr[i] < xmin || o_ymin_ptr[i] > ymax || o_ymax_ptr[i] < ymin);
+        } else {
+            height = (std::max)(height, 0.f);
+            width = (std::max)(width, 0.f);
+            valid = area > 0.f && o_area_ptr[i] > 0.f;
+        }
+        const float intersection = height * width;
+        const float iou = valid ? intersection / (area + o_area_ptr[i] - intersection) : 0.f;
+        if (ious)
+            ious[i - begin] = iou;
+        max_iou = (std::max)(max_iou, iou);
+        if (max_iou >= stop_iou)
+            break;
+    }
+    return max_iou;
+}
+
+}  // namespace XARCH
+}  // namespace intel_cpu
+}  // namespace ov
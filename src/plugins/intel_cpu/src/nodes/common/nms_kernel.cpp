@@ -0,0 +1,62 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "nms_kernel.hpp"
+
+#include <algorithm>
+
+#include "ie_parallel.hpp"
+
+namespace ov {
+namespace intel_cpu {
+
+std::vector<size_t> nms_greedy(const NmsBoxes& candidates, const NmsIouConfig& config, float iou_threshold, float eta,
+                               size_t max_selected, bool parallel) {
+    // the candidates of the small problems are not worth the synchronization
+    constexpr size_t min_parallel_candidates = 256;
+    constexpr size_t min_block_size = 64;
+
+    const size_t num = candidates.size();
+    const size_t max_num = (std::min)(num, max_selected);
+    std::vector<size_t> selected_idx;
+    selected_idx.reserve(max_num);
+    NmsBoxes selected;
+    selected.reserve(max_num);
+
+    const size_t nthr = parallel && num >= min_parallel_candidates ? static_cast<size_t>(parallel_get_max_threads()) : 1;
+    const size_t block_size = nthr > 1 ? (std::max)(min_block_size, 4 * nthr) : num;
+    std::vector<float> prev_max_iou(nthr > 1 ? block_size : 0);
+
+    float threshold = iou_threshold;
+    for (size_t block_begin = 0; block_begin < num && selected_idx.size() < max_num; block_begin += block_size) {
+        const size_t block_end = (std::min)(num, block_begin + block_size);
+        const size_t num_prev = nthr > 1 ? selected.size() : 0;
+        if (num_prev > 0) {
+            // the threshold only decreases inside the block, so the candidates stopped at the current one are
+            // suppressed anyway
+            InferenceEngine::parallel_for(block_end - block_begin, [&](size_t i) {
+                prev_max_iou[i] =
+                    XARCH::nms_max_iou(candidates, block_begin + i, selected, 0, num_prev, config, threshold, nullptr);
+            });
+        }
+
+        for (size_t idx = block_begin; idx < block_end && selected_idx.size() < max_num; idx++) {
+            if (num_prev > 0 && prev_max_iou[idx - block_begin] >= threshold)
+                continue;
+            const float max_iou =
+                XARCH::nms_max_iou(candidates, idx, selected, num_prev, selected.size(), config, threshold, nullptr);
+            if (max_iou >= threshold)
+                continue;
+
+            selected_idx.push_back(idx);
+            selected.push_back(candidates, idx);
+            if (eta < 1.f && threshold > 0.5f)
+                threshold *= eta;
+        }
+    }
+    return selected_idx;
+}
+
+}  // namespace intel_cpu
+}  // namespace ov
@@ -0,0 +1,96 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * Boxes of a single NMS problem (one class of one image) in the structure of arrays layout, so the IoU of a box
+ * with a range of the boxes is computed with the vector instructions.
+ * The corners are expected to be ordered (ymin <= ymax) if the node IoU flavor relies on it, the area is computed by
+ * the node since its formula differs between the NMS operations.
+ */
+struct NmsBoxes {
+    std::vector<float> ymin;
+    std::vector<float> xmin;
+    std::vector<float> ymax;
+    std::vector<float> xmax;
+    std::vector<float> area;
+
+    size_t size() const {
+        return area.size();
+    }
+
+    void reserve(size_t num) {
+        ymin.reserve(num);
+        xmin.reserve(num);
+        ymax.reserve(num);
+        xmax.reserve(num);
+        area.reserve(num);
+    }
+
+    void push_back(float box_ymin, float box_xmin, float box_ymax, float box_xmax, float box_area) {
+        ymin.push_back(box_ymin);
+        xmin.push_back(box_xmin);
+        ymax.push_back(box_ymax);
+        xmax.push_back(box_xmax);
+        area.push_back(box_area);
+    }
+
+    void push_back(const NmsBoxes& boxes, size_t idx) {
+        push_back(boxes.ymin[idx], boxes.xmin[idx], boxes.ymax[idx], boxes.xmax[idx], boxes.area[idx]);
+    }
+};
+
+/**
+ * IoU flavor of the NMS operation.
+ * offset: added to the sides of the intersection, 1 for the not normalized boxes of MulticlassNms and MatrixNms
+ * overlap_only: MatrixNms flavor, the IoU of the boxes which do not overlap is zero, otherwise the intersection is
+ *     taken as is. Without it the sides of the intersection are clamped at zero and the IoU is zero if any of the
+ *     areas is not positive (NonMaxSuppression and MulticlassNms flavor).
+ */
+struct NmsIouConfig {
+    float offset;
+    bool overlap_only;
+};
+
+namespace XARCH {
+
+/**
+ * Computes IoU of the box idx of boxes with the boxes [begin, end) of others and returns the maximum of them, or
+ * -infinity for the empty range. The computation stops as soon as the maximum reaches stop_iou, so the result is
+ * exact only if it is below stop_iou.
+ * If ious is not nullptr, the IoU values are stored to it (all of them if stop_iou is infinity).
+ */
+float nms_max_iou(const NmsBoxes& boxes, size_t idx, const NmsBoxes& others, size_t begin, size_t end,
+                  const NmsIouConfig& config, float stop_iou, float* ious);
+
+/**
+ * Stores the indices of the scores above the threshold (or equal to it if inclusive) to indices in the ascending
+ * order and returns their number. indices must have room for num values.
+ */
+size_t nms_filter_scores(const float* scores, size_t num, float threshold, bool inclusive, int* indices);
+
+}  // namespace XARCH
+
+/**
+ * Greedy hard NMS over the candidates sorted by the score: a candidate is selected if its IoU with each of the
+ * selected boxes is below the threshold. After each selection the threshold is multiplied by eta while it is
+ * above 0.5 (eta = 1 keeps it constant). Returns the positions of the selected candidates, at most max_selected.
+ *
+ * With parallel the candidates are processed in blocks: the IoU with the boxes selected before the block is computed
+ * for all the candidates of the block in parallel, then the block is resolved sequentially against the boxes
+ * selected inside it, so the result is the same as the sequential one. It pays off if the classes of the node do not
+ * keep all the threads busy.
+ */
+std::vector<size_t> nms_greedy(const NmsBoxes& candidates, const NmsIouConfig& config, float iou_threshold, float eta,
+                               size_t max_selected, bool parallel);
+
+}  // namespace intel_cpu
+}  // namespace ov
@@ -12,6 +12,10 @@
 namespace ov {
 namespace intel_cpu {
 
+// oneDNN is built with the concurrent execution support, so the reorder primitive may be shared between the streams
+template<>
+struct is_shareable_cache_value<dnnl::reorder> : std::true_type {};
+
 dnnl::reorder getReorderPrim(MultiCachePtr cache,
                              const dnnl::engine& engine,
                              const dnnl::memory::desc& src,
@@ -546,11 +546,16 @@ void Concat::execRef() {
             for (size_t a = 0; a < srcPtrs.size(); ++a) {
                 const auto inData = srcPtrs[a];
                 auto outputData = &dstPtr[dstOffset[a]];
+                // the input is already in place (e.g. the data is appended to the output of the previous inference)
+                if (inData == outputData)
+                    continue;
                 std::memcpy(outputData, inData, nelemToCopy[a]);
             }
         } else {
             parallel_nt(nthr, [&](int ithr, int nthr) {
                 for (size_t a = 0; a < srcPtrs.size(); ++a) {
+                    if (srcPtrs[a] == dstPtr + dstOffset[a])
+                        continue;
                     size_t start = 0, end = 0;
                     splitter(nelemToCopy[a], nthr, ithr, start, end);
                     const uint8_t* i = srcPtrs[a] + start;
@@ -34,6 +34,19 @@ public:
     bool needPrepareParams() const override;
     void prepareParams() override;
 
+    size_t getAxis() const {
+        return axis;
+    }
+
+    /**
+     * @brief Returns true if an input which memory is already placed at its position in the output is not copied,
+     * i.e. new data may be appended to the first input in place when the output shares the memory with it
+     * and all the dims before the axis are ones
+     */
+    bool canAppendInPlace() const {
+        return canExecRef && !canOptimizeNspc && !isInPlace();
+    }
+
 private:
     size_t axis = 0;
     size_t reorderedAxis = 0;
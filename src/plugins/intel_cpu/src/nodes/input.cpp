@@ -22,6 +22,8 @@
 #include <cpu/x64/jit_generator.hpp>
 #include "memory_desc/dnnl_blocked_memory_desc.h"
 #include "shape_inference/shape_inference_pass_through.hpp"
+#include "ngraph/runtime/shared_buffer.hpp"
+#include "openvino/util/mmap_object.hpp"
 
 using namespace dnnl;
 using namespace InferenceEngine;
@@ -245,6 +247,39 @@ jit_has_subnormals_base::fn_t jit_has_subnormals_function() {
 }   // namespace
 #endif
 
+namespace {
+OPENVINO_SUPPRESS_DEPRECATED_START
+class ConstantBufferVisitor : public ov::AttributeVisitor {
+public:
+    void on_adapter(const std::string& name, ov::ValueAccessor<void>& adapter) override {
+        if (auto a = ov::as_type<ov::AttributeAdapter<std::shared_ptr<ngraph::runtime::AlignedBuffer>>>(&adapter))
+            buffer = a->get();
+    }
+
+    std::shared_ptr<ngraph::runtime::AlignedBuffer> buffer;
+};
+
+// Checks whether the constant data are the pages of the file mapped on the model reading (see ov::enable_mmap).
+// The buffers of the constants deserialized from IR share the buffer of the whole weights file, which is
+// the mapped memory itself when the file is mapped.
+bool isConstantMapped(const std::shared_ptr<ngraph::op::Constant>& constOp) {
+    using SharedAlignedBuffer = ngraph::runtime::SharedBuffer<std::shared_ptr<ngraph::runtime::AlignedBuffer>>;
+    using SharedMappedMemory = ngraph::runtime::SharedBuffer<std::shared_ptr<ov::MappedMemory>>;
+
+    ConstantBufferVisitor visitor;
+    constOp->visit_attributes(visitor);
+    auto buffer = visitor.buffer;
+    while (buffer) {
+        if (std::dynamic_pointer_cast<SharedMappedMemory>(buffer))
+            return true;
+        auto shared = std::dynamic_pointer_cast<SharedAlignedBuffer>(buffer);
+        buffer = shared ? shared->get_shared_object() : nullptr;
+    }
+    return false;
+}
+OPENVINO_SUPPRESS_DEPRECATED_END
+}   // namespace
+
 Input::Input(const std::shared_ptr<ngraph::Node>& op, const GraphContext::CPtr context)
         : Node(op, context, PassThroughShapeInferFactory()) {
     if (!one_of(op->get_type_info(),
@@ -386,16 +421,33 @@ void Input::cloneBlobIfRequired() {
     };
 
     auto weightCache = context->getWeightsCache();
+    isMapped = isConstantMapped(constOp);
 
-    if (weightCache) {
-        MemoryPtr ptr = *weightCache->findOrCreate(blobKey(), cloneBlob);
-        memoryPtr = std::const_pointer_cast<const IMemory>(ptr);
+    // The constant data is used in place when it needs no processing, so the weights are not duplicated in the
+    // private buffers. The weights cache of each socket keeps its own copy though, so the streams read the memory
+    // local to their NUMA node, unless there is a single socket (see Config::constantsInPlace) or the constant is
+    // mapped from the model file: the copies would take the anonymous memory instead of the file pages shared by
+    // all the processes running the same model.
     // IRs already have all subnormals flushed to zero, but in
     // read_model scenario with directly loaded original model still can have subnormals
-    } else if (isBlobAligned() && (!needFlushDenormalsToZero || !hasSubnormals()) && !isWA()) {
-        memoryPtr = std::make_shared<Memory>(getEngine(), memDesc, constOp->get_data_ptr());
+    auto canUseBlobInPlace = [&, this] () {
+        return (!weightCache || context->getConfig().constantsInPlace || isMapped) &&
+               constOp->get_byte_size() >= memDesc.getCurrentMemSize() &&
+               isBlobAligned() && (!needFlushDenormalsToZero || !hasSubnormals()) && !isWA();
+    };
+
+    auto getBlob = [&, this] () -> MemoryPtr {
+        if (canUseBlobInPlace()) {
+            return std::make_shared<Memory>(getEngine(), memDesc, constOp->get_data_ptr());
+        }
+        return cloneBlob();
+    };
+
+    if (weightCache) {
+        MemoryPtr ptr = *weightCache->findOrCreate(blobKey(), getBlob);
+        memoryPtr = std::const_pointer_cast<const IMemory>(ptr);
     } else {
-        memoryPtr = std::const_pointer_cast<const IMemory>(cloneBlob());
+        memoryPtr = std::const_pointer_cast<const IMemory>(getBlob());
     }
 }
 
@@ -428,6 +480,10 @@ MemoryCPtr Input::getMemoryPtr() const {
     return memoryPtr;
 }
 
+bool Input::isMappedConstant() const {
+    return isMapped && memoryPtr && memoryPtr->getData() == constOp->get_data_ptr();
+}
+
 void Input::getSupportedDescriptors() {
     if (getType() == Type::Input) {
         if (!getParentEdges().empty())
@@ -30,6 +30,8 @@ public:
 
     void withMeanImage();
     MemoryCPtr getMemoryPtr() const;
+    // the memory of the constant refers to the pages of the model file mapped on the model reading
+    bool isMappedConstant() const;
 
     void execute(dnnl::stream strm) override {}
     void executeDynamicImpl(dnnl::stream strm) override {}
@@ -50,6 +52,7 @@ private:
     MemoryCPtr memoryPtr;
     MemoryDescPtr extMemDesc = nullptr;
     bool isMeanImage = false;
+    bool isMapped = false;
 };
 
 }   // namespace node
@@ -2,10 +2,12 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
 #include <string>
 #include <dnnl_types.h>
 #include <dnnl_extension_utils.h>
 #include "memory.hpp"
+#include "concat.h"
 #include "common/cpu_convert.h"
 #include "common/cpu_memcpy.h"
 #include "utils/general_utils.h"
@@ -21,6 +23,41 @@ namespace node {
 
 std::mutex MemoryNodeVirtualEdge::holderMutex;
 
+/**
+ * Copy data from one tensor into other.
+ * As is. Assume that data is dense tensor with same layout.
+ * @param dst destination memory object
+ * @param src source memory object
+ */
+inline
+static void simple_copy(const IMemory& dst, const IMemory& src) {
+    auto srcPtr = static_cast<uint8_t*>(src.getData());
+    auto dstPtr = static_cast<uint8_t*>(dst.getData());
+    if (src.getDataType() == dst.getDataType()) {
+        auto srcSizeInByte = src.getSize();
+        auto dstSizeInByte = dst.getSize();
+
+        IE_ASSERT(srcSizeInByte == dstSizeInByte) << "MemoryNode objects are not compatible. Has different sizes.";
+
+        cpu_memcpy(dstPtr, srcPtr, srcSizeInByte);
+    } else {
+        cpu_convert(srcPtr, dstPtr, src.getDesc().getPrecision(),
+            dst.getDesc().getPrecision(), src.getDesc().getShape().getElementsCount());
+    }
+}
+
+/**
+ * Checks whether the memory of one tensor may be replaced with the memory of other.
+ * The dims of the dynamic shape tensors are changed on each inference, so only the precision and the layout are compared.
+ */
+inline
+static bool isMemoryCompatible(const MemoryDesc& lhs, const MemoryDesc& rhs, bool dynamic) {
+    if (!dynamic)
+        return lhs.isCompatible(rhs);
+    return lhs.getPrecision() == rhs.getPrecision() &&
+           lhs.hasLayoutType(LayoutType::ncsp) && rhs.hasLayoutType(LayoutType::ncsp);
+}
+
 MemoryNode::MemoryNode(const std::shared_ptr<ngraph::Node>& op) {
     if (auto assignOp = std::dynamic_pointer_cast<ngraph::op::AssignBase>(op)) {
         _id = assignOp->get_variable_id();
@@ -31,11 +68,6 @@ MemoryNode::MemoryNode(const std::shared_ptr<ngraph::Node>& op) {
 
 bool MemoryOutput::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
     try {
-        if (isDynamicNgraphNode(op)) {
-            errorMessage = "Doesn't support op with dynamic shapes";
-            return false;
-        }
-
         if (!one_of(op->get_type_info(),
                 ngraph::op::v3::Assign::get_type_info_static(),
                 ngraph::op::v6::Assign::get_type_info_static())) {
@@ -81,18 +113,137 @@ void MemoryOutput::initSupportedPrimitiveDescriptors() {
 void MemoryOutput::execute(dnnl::stream strm)  {
     auto& srcMemory = getParentEdgeAt(0)->getMemory();
 
+    stateAppended = false;
+    if (appendStore && appendStore->getData() == srcMemory.getData()) {
+        // the new data has been appended to the current state in place, only the dims are updated,
+        // the buffer has enough capacity, so the data is kept
+        if (appendStore->getStaticDims() != srcMemory.getStaticDims())
+            appendStore->redefineDesc(appendStore->getDescPtr()->cloneWithNewDims(srcMemory.getStaticDims(), true));
+        stateAppended = true;
+        return;
+    }
+
+    if (stateStore) {
+        if (stateStore->getStaticDims() != srcMemory.getStaticDims())
+            stateStore->redefineDesc(stateStore->getDescPtr()->cloneWithNewDims(srcMemory.getStaticDims(), true));
+        // the producer has already written the state in place
+        if (stateStore->getData() != srcMemory.getData())
+            simple_copy(*stateStore, srcMemory);
+        return;
+    }
+
     auto inputMemoryNode = dynamic_cast<MemoryInput*>(inputNode);
     IE_ASSERT(inputMemoryNode != nullptr);
     inputMemoryNode->storeState(srcMemory);
 }
 
-bool MemoryInput::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
-    try {
-        if (isDynamicNgraphNode(op)) {
-            errorMessage = "Doesn't support op with dynamic shapes";
+bool MemoryOutput::canWriteStateInPlace() const {
+    auto parentEdge = getParentEdgeAt(0);
+    if (parentEdge->getStatus() != Edge::Status::Allocated ||
+        !isMemoryCompatible(parentEdge->getMemory().getDesc(), stateStore->getDesc(), isDynamicNode()))
+        return false;
+
+    // the same checks as for the zero copy output: the producer memory must not be shared with any other node
+    void* defaultPtr = parentEdge->getMemory().getData();
+    auto parent = parentEdge->getParent();
+    NodePtr previousParent;
+    do {
+        previousParent = parent;
+        if (parent->getChildEdges().size() != 1 || parent->isConstant() || parent->isInPlace() ||
+            one_of(parent->getType(), Type::Input, Type::MemoryInput))
             return false;
+
+        for (auto& edge : parent->getParentEdges()) {
+            auto e = edge.lock();
+            if (!e)
+                IE_THROW() << "Node " << parent->getName() << " contains empty parent edge";
+
+            if (e->getMemory().getData() == defaultPtr) {
+                parent = e->getParent();
+                break;
+            }
         }
+    } while (previousParent != parent);
+    return true;
+}
+
+int MemoryOutput::getAppendAxis() const {
+    auto concat = std::dynamic_pointer_cast<Concat>(getParentEdgeAt(0)->getParent());
+    if (!concat || !concat->canAppendInPlace() || concat->getParentEdgeAt(0)->getParent().get() != inputNode)
+        return -1;
+    return static_cast<int>(concat->getAxis());
+}
+
+bool MemoryOutput::canAppendStateInPlace(const MemoryPtr& current) const {
+    const auto axis = getAppendAxis();
+    auto parentEdge = getParentEdgeAt(0);
+    if (axis < 0 || parentEdge->getStatus() != Edge::Status::Allocated ||
+        !isMemoryCompatible(parentEdge->getMemory().getDesc(), current->getDesc(), isDynamicNode()))
+        return false;
+
+    // the first concatenated tensor must be the current state read in place by the paired ReadValue
+    auto concat = parentEdge->getParent();
+    if (current->getShape().hasZeroDims() || concat->getParentEdgeAt(0)->getMemory().getData() != current->getData())
+        return false;
+
+    // the current state is the beginning of the concatenation result only if all the dims before the axis are ones
+    const auto& dims = current->getStaticDims();
+    if (static_cast<size_t>(axis) >= dims.size() ||
+        std::any_of(dims.begin(), dims.begin() + axis, [](Dim dim) { return dim != 1; }))
+        return false;
+
+    // the result is the state, so it must not be modified by the other consumers or be exposed as the graph output
+    for (auto& childEdge : concat->getChildEdges()) {
+        auto ce = childEdge.lock();
+        if (!ce)
+            IE_THROW() << "Node " << concat->getName() << " contains empty child edge";
+        if (ce->getChild()->getType() == Type::Output || ce->modifiedInPlace())
+            return false;
+    }
+    return true;
+}
+
+void MemoryOutput::bindState(const MemoryPtr& next, size_t nextCapacity, const MemoryPtr& current, size_t currentCapacity) {
+    stateStore = next;
+    appendStore = nullptr;
+    if (!stateStore)
+        return;
+
+    auto& srcMemory = getParentEdgeAt(0)->getMemory();
+    auto rebind = [&](const MemoryPtr& state, size_t capacity) {
+        if (srcMemory.getData() == state->getData())
+            return;
+        auto memMngr = srcMemory.getMemoryMngr();
+        IE_ASSERT(memMngr);
+        memMngr->setExtBuff(state->getData(), capacity);
+    };
+
+    if (current && canAppendStateInPlace(current)) {
+        appendStore = current;
+        rebind(appendStore, currentCapacity);
+    } else if (canWriteStateInPlace()) {
+        rebind(stateStore, nextCapacity);
+    }
+}
+
+void MemoryOutput::unbindState() {
+    auto& srcMemory = getParentEdgeAt(0)->getMemory();
+    const auto data = srcMemory.getData();
+    const bool bound = data && ((stateStore && stateStore->getData() == data) || (appendStore && appendStore->getData() == data));
+    stateStore = nullptr;
+    appendStore = nullptr;
+    if (!bound)
+        return;
+
+    // the producer writes into its own memory until the next state is bound
+    auto memMngr = srcMemory.getMemoryMngr();
+    IE_ASSERT(memMngr);
+    memMngr->setExtBuff(nullptr, 0);
+    memMngr->resize(srcMemory.getSize());
+}
 
+bool MemoryInput::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
+    try {
         if (!one_of(op->get_type_info(),
                 ngraph::op::v3::ReadValue::get_type_info_static(),
                 ngraph::op::v6::ReadValue::get_type_info_static())) {
@@ -119,34 +270,16 @@ MemoryInput::MemoryInput(const std::shared_ptr<ngraph::Node>& op, const GraphCon
 void MemoryInput::createPrimitive() {
     Input::createPrimitive();
 
-    dataStore = std::make_shared<Memory>(getEngine(), getChildEdgeAt(0)->getMemory().getDesc());
+    auto stateDesc = getChildEdgeAt(0)->getMemory().getDescPtr();
+    // the state of a dynamic shape is empty by default
+    if (!stateDesc->isDefined())
+        stateDesc = stateDesc->cloneWithNewDims(stateDesc->getShape().getMinDims(), true);
+    defaultStore = std::make_shared<Memory>(getEngine(), stateDesc);
 
     // default memory state is zero filled
-    if (dataStore->getDesc().hasDefinedMaxSize())
-        dataStore->nullify();
-}
-
-/**
- * Copy data from one tensor into other.
- * As is. Assume that data is dense tensor with same layout.
- * @param dst destination memory object
- * @param src source memory object
- */
-inline
-static void simple_copy(const IMemory& dst, const IMemory& src) {
-    auto srcPtr = static_cast<uint8_t*>(src.getData());
-    auto dstPtr = static_cast<uint8_t*>(dst.getData());
-    if (src.getDataType() == dst.getDataType()) {
-        auto srcSizeInByte = src.getSize();
-        auto dstSizeInByte = dst.getSize();
-
-        IE_ASSERT(srcSizeInByte == dstSizeInByte) << "MemoryNode objects are not compatible. Has different sizes.";
-
-        cpu_memcpy(dstPtr, srcPtr, srcSizeInByte);
-    } else {
-        cpu_convert(srcPtr, dstPtr, src.getDesc().getPrecision(),
-            dst.getDesc().getPrecision(), src.getDesc().getShape().getElementsCount());
-    }
+    if (defaultStore->getDesc().hasDefinedMaxSize())
+        defaultStore->nullify();
+    dataStore = defaultStore;
 }
 
 MemoryInput::~MemoryInput() {
@@ -154,7 +287,8 @@ MemoryInput::~MemoryInput() {
 }
 
 MemoryPtr MemoryInput::getStore() {
-    return dataStore;
+    // not the bound state, it belongs to the infer request inferred last and may be released together with it
+    return defaultStore;
 }
 
 void MemoryInput::storeState(const IMemory &new_state) {
@@ -164,11 +298,56 @@ void MemoryInput::storeState(const IMemory &new_state) {
     simple_copy(*dataStore, new_state);
 }
 
+bool MemoryInput::canReadStateInPlace() const {
+    if (!isMemoryCompatible(dataStore->getDesc(), getChildEdgeAt(0)->getMemory().getDesc(), isDynamicNode()))
+        return false;
+
+    // the same checks as for the zero copy input: the state memory must not be modified by the consumers
+    for (auto& childEdge : getChildEdges()) {
+        auto ce = childEdge.lock();
+        if (!ce)
+            IE_THROW() << "Node " << getName() << " contains empty child edge";
+
+        auto& child = ce->getChild();
+        if (child->isConstant() || ce->inPlace(Edge::LOOK_DOWN) || ce->modifiedInPlace() ||
+            (child->getType() == Type::Concatenation && child->isInPlace()))
+            return false;
+    }
+    return true;
+}
+
+void MemoryInput::bindState(const MemoryPtr& state, size_t capacity) {
+    dataStore = state;
+    if (canReadStateInPlace()) {
+        for (auto& childEdge : getChildEdges()) {
+            auto ce = childEdge.lock();
+            auto& mem = ce->getMemory();
+            if (mem.getData() == dataStore->getData())
+                continue;
+            auto memMngr = mem.getMemoryMngr();
+            IE_ASSERT(memMngr);
+            memMngr->setExtBuff(dataStore->getData(), capacity);
+        }
+    }
+    // the output shape follows the state, the buffer bound above has enough capacity for it
+    if (isDynamicNode())
+        redefineOutputMemory({dataStore->getStaticDims()});
+}
+
+void MemoryInput::unbindState() {
+    if (dataStore != defaultStore)
+        bindState(defaultStore, defaultStore->getSize());
+}
+
 void MemoryInput::execute(dnnl::stream strm) {
+    auto& dstMemory = getChildEdgeAt(0)->getMemory();
+    // the consumers read the state in place
+    if (dstMemory.getData() == dataStore->getData())
+        return;
     // TODO: Should be simple call of:
     //           dst_mem.load(dataStore, false);
     //       But because of performance reason we use simple manual copy
-    simple_copy(getChildEdgeAt(0)->getMemory(), *dataStore);
+    simple_copy(dstMemory, *dataStore);
 }
 
 MemoryNodeVirtualEdge::Holder* MemoryNodeVirtualEdge::registerInput(MemoryInput * node) {
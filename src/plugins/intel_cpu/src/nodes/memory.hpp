@@ -68,6 +68,15 @@ public:
     void initSupportedPrimitiveDescriptors() override;
     void createPrimitive() override {}
     void execute(dnnl::stream strm) override;
+    void executeDynamicImpl(dnnl::stream strm) override {
+        execute(strm);
+    }
+    bool needShapeInfer() const override {
+        return false;
+    }
+    bool needPrepareParams() const override {
+        return false;
+    }
     bool created() const override {
         return getType() == Type::MemoryOutput;
     }
@@ -76,7 +85,47 @@ public:
         inputNode = node;
     }
 
+    /**
+     * @brief Binds the buffers of the state. The new state is written to the next buffer: the producer output is
+     * redirected into the buffer when it's not shared with other consumers, so the state is stored without an extra copy.
+     * If the new state is the current one with some data appended (see getAppendAxis()), the data is appended to the
+     * current buffer in place instead.
+     * @param next buffer for the new state
+     * @param nextCapacity capacity of the next buffer in bytes
+     * @param current buffer of the current state read by the paired ReadValue, if the in place append is allowed
+     * @param currentCapacity capacity of the current buffer in bytes
+     */
+    void bindState(const MemoryPtr& next, size_t nextCapacity, const MemoryPtr& current = nullptr, size_t currentCapacity = 0);
+
+    /**
+     * @brief Detaches the state buffers bound by bindState(), the producer output gets its own memory back.
+     * Must be called before the buffers are released, since the graph outlives the infer request owning them.
+     */
+    void unbindState();
+
+    // true if the buffer is bound to the node as the next or the current state
+    bool isBoundTo(const MemoryPtr& buffer) const {
+        return buffer && (stateStore == buffer || appendStore == buffer);
+    }
+
+    /**
+     * @brief Returns the axis the stored data is appended to the state along, i.e. the state is stored as the
+     * concatenation of the paired ReadValue output with the new data, -1 otherwise
+     */
+    int getAppendAxis() const;
+
+    // true if the last execution has appended the new data to the current state in place
+    bool isStateAppended() const {
+        return stateAppended;
+    }
+
  private:
+    bool canWriteStateInPlace() const;
+    bool canAppendStateInPlace(const MemoryPtr& current) const;
+
+    MemoryPtr stateStore;
+    MemoryPtr appendStore;
+    bool stateAppended = false;
     /**
      * @brief keeps reference to input sibling node
      */
@@ -97,13 +146,42 @@ public:
         return true;
     }
     void execute(dnnl::stream strm) override;
+    void executeDynamicImpl(dnnl::stream strm) override {
+        execute(strm);
+    }
 
     void createPrimitive() override;
 
     void setInputNode(Node* node) override {}
     void storeState(const IMemory& mem);
     MemoryPtr getStore();
+
+    /**
+     * @brief Binds the buffer the current state is read from. The consumers read the buffer directly
+     * when none of them modifies the input memory, otherwise the state is copied on execution.
+     * The output shape of a dynamic node is redefined according to the state.
+     * @param state buffer of the current state
+     * @param capacity capacity of the buffer in bytes
+     */
+    void bindState(const MemoryPtr& state, size_t capacity);
+
+    /**
+     * @brief Binds the default state of the node back instead of the buffer bound by bindState().
+     * Must be called before the buffer is released, since the graph outlives the infer request owning it.
+     */
+    void unbindState();
+
+    // true if the buffer is bound to the node as the current state
+    bool isBoundTo(const MemoryPtr& buffer) const {
+        return buffer && dataStore == buffer;
+    }
+
  private:
+    bool canReadStateInPlace() const;
+
+    // the initial value of the state owned by the node, the new infer requests start from it
+    MemoryPtr defaultStore;
+    // the state read by the node, either the default one or the buffer of the infer request bound last
     MemoryPtr dataStore;
     MemoryNodeVirtualEdge::Holder* holder = nullptr;
 };
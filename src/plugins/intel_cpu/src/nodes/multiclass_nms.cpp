@@ -10,13 +10,13 @@
 #include <chrono>
 #include <cmath>
 #include <ie_ngraph_utils.hpp>
-#include <queue>
 #include <string>
 #include <utility>
 #include <vector>
 
 #include "ie_parallel.hpp"
 #include "utils/general_utils.h"
+#include "common/nms_kernel.hpp"
 #include <shape_inference/shape_inference_internal_dyn.hpp>
 
 using namespace InferenceEngine;
@@ -414,6 +414,37 @@ float MultiClassNms::intersectionOverUnion(const float* boxesI, const float* box
     return intersection_area / (areaI + areaJ - intersection_area);
 }
 
+namespace {
+
+// candidates of the class sorted by the score: score, box_idx
+std::vector<std::pair<float, int>> sortCandidates(const float* scoresPtr, int numBoxes, float scoreThreshold) {
+    std::vector<int> candidateIdx(numBoxes);
+    // ">=" to align with ref
+    candidateIdx.resize(XARCH::nms_filter_scores(scoresPtr, numBoxes, scoreThreshold, true, candidateIdx.data()));
+
+    std::vector<std::pair<float, int>> sorted_boxes;
+    sorted_boxes.reserve(candidateIdx.size());
+    for (const auto box_idx : candidateIdx)
+        sorted_boxes.emplace_back(std::make_pair(scoresPtr[box_idx], box_idx));
+    parallel_sort(sorted_boxes.begin(), sorted_boxes.end(), [](const std::pair<float, int>& l, const std::pair<float, int>& r) {
+        return (l.first > r.first || ((l.first == r.first) && (l.second < r.second)));
+    });
+    return sorted_boxes;
+}
+
+// first num sorted boxes with the area of the intersectionOverUnion() flavor
+NmsBoxes makeNmsBoxes(const float* boxesPtr, const std::vector<std::pair<float, int>>& sorted_boxes, size_t num, float norm) {
+    NmsBoxes candidates;
+    candidates.reserve(num);
+    for (size_t i = 0; i < num; i++) {
+        const float* box = &boxesPtr[sorted_boxes[i].second * 4];
+        candidates.push_back(box[0], box[1], box[2], box[3], (box[2] - box[0] + norm) * (box[3] - box[1] + norm));
+    }
+    return candidates;
+}
+
+}  // namespace
+
 void MultiClassNms::nmsWithEta(const float* boxes,
                                 const float* scores,
                                 const int* roisnum,
@@ -421,13 +452,10 @@ void MultiClassNms::nmsWithEta(const float* boxes,
                                 const SizeVector& scoresStrides,
                                 const SizeVector& roisnumStrides,
                                 const bool shared) {
-    auto less = [](const boxInfo& l, const boxInfo& r) {
-        return l.score < r.score || ((l.score == r.score) && (l.idx > r.idx));
-    };
-
-    auto func = [](float iou, float adaptive_threshold) {
-        return iou <= adaptive_threshold ? 1.0f : 0.0f;
-    };
+    const float norm = static_cast<float>(m_normalized == false);
+    const NmsIouConfig iouConfig{norm, false};
+    // the candidates of a class are processed in parallel if the classes do not keep all the threads busy
+    const bool intraClassParallel = m_numBatches * m_numClasses < static_cast<size_t>(parallel_get_max_threads());
 
     parallel_for2d(m_numBatches, m_numClasses, [&](int batch_idx, int class_idx) {
         if (!shared) {
@@ -441,48 +469,33 @@ void MultiClassNms::nmsWithEta(const float* boxes,
             const float* boxesPtr = slice_class(batch_idx, class_idx, boxes, boxesStrides, true, roisnum, roisnumStrides, shared);
             const float* scoresPtr = slice_class(batch_idx, class_idx, scores, scoresStrides, false, roisnum, roisnumStrides, shared);
 
-            std::priority_queue<boxInfo, std::vector<boxInfo>, decltype(less)> sorted_boxes(less);
             int cur_numBoxes = shared ? m_numBoxes : roisnum[batch_idx];
-            for (int box_idx = 0; box_idx < cur_numBoxes; box_idx++) {
-                if (scoresPtr[box_idx] >= m_scoreThreshold)  // algin with ref
-                    sorted_boxes.emplace(boxInfo({scoresPtr[box_idx], box_idx, 0}));
-            }
-            fb.reserve(sorted_boxes.size());
+            const auto sorted_boxes = sortCandidates(scoresPtr, cur_numBoxes, m_scoreThreshold);
             if (sorted_boxes.size() > 0) {
+                const size_t max_out_box = (std::min)(static_cast<size_t>(m_nmsRealTopk), sorted_boxes.size());
+                // the candidates scored at the threshold are checked against the last selected box only,
+                // like in the reference implementation
+                const size_t numAboveThreshold = std::find_if(sorted_boxes.begin(), sorted_boxes.begin() + max_out_box,
+                    [&](const std::pair<float, int>& box) { return box.first <= m_scoreThreshold; }) - sorted_boxes.begin();
+
+                const auto candidates = makeNmsBoxes(boxesPtr, sorted_boxes, numAboveThreshold, norm);
+                const auto selected = nms_greedy(candidates, iouConfig, m_iouThreshold, m_nmsEta, numAboveThreshold, intraClassParallel);
+                fb.reserve(max_out_box);
                 auto adaptive_threshold = m_iouThreshold;
-                int max_out_box =
-                    (static_cast<size_t>(m_nmsRealTopk) > sorted_boxes.size()) ? sorted_boxes.size() : m_nmsRealTopk;
-                while (max_out_box && !sorted_boxes.empty()) {
-                    boxInfo currBox = sorted_boxes.top();
-                    float origScore = currBox.score;
-                    sorted_boxes.pop();
-                    max_out_box--;
-
-                    bool box_is_selected = true;
-                    for (int idx = static_cast<int>(fb.size()) - 1; idx >= currBox.suppress_begin_index; idx--) {
-                        float iou = intersectionOverUnion(&boxesPtr[currBox.idx * 4], &boxesPtr[fb[idx].box_index * 4], m_normalized);
-                        currBox.score *= func(iou, adaptive_threshold);
-                        if (iou >= adaptive_threshold) {
-                            box_is_selected = false;
-                            break;
-                        }
-                        if (currBox.score <= m_scoreThreshold)
-                            break;
-                    }
-
-                    currBox.suppress_begin_index = fb.size();
-                    if (box_is_selected) {
-                        if (m_nmsEta < 1 && adaptive_threshold > 0.5) {
-                            adaptive_threshold *= m_nmsEta;
-                        }
-                        if (currBox.score == origScore) {
-                            fb.push_back({currBox.score, batch_idx, class_idx, currBox.idx});
-                            continue;
-                        }
-                        if (currBox.score > m_scoreThreshold) {
-                            sorted_boxes.push(currBox);
-                        }
+                auto select = [&](size_t candidate_idx) {
+                    fb.push_back({sorted_boxes[candidate_idx].first, batch_idx, class_idx, sorted_boxes[candidate_idx].second});
+                    if (m_nmsEta < 1 && adaptive_threshold > 0.5) {
+                        adaptive_threshold *= m_nmsEta;
                     }
+                };
+                for (const auto candidate_idx : selected)
+                    select(candidate_idx);
+
+                for (size_t candidate_idx = numAboveThreshold; candidate_idx < max_out_box; candidate_idx++) {
+                    if (!fb.empty() && intersectionOverUnion(&boxesPtr[sorted_boxes[candidate_idx].second * 4],
+                                                             &boxesPtr[fb.back().box_index * 4], m_normalized) >= adaptive_threshold)
+                        continue;
+                    select(candidate_idx);
                 }
             }
             m_numFiltBox[batch_idx][class_idx] = fb.size();
@@ -533,6 +546,11 @@ void MultiClassNms::nmsWithoutEta(const float* boxes,
                                 const SizeVector& scoresStrides,
                                 const SizeVector& roisnumStrides,
                                 const bool shared) {
+    const float norm = static_cast<float>(m_normalized == false);
+    const NmsIouConfig iouConfig{norm, false};
+    // the candidates of a class are processed in parallel if the classes do not keep all the threads busy
+    const bool intraClassParallel = m_numBatches * m_numClasses < static_cast<size_t>(parallel_get_max_threads());
+
     parallel_for2d(m_numBatches, m_numClasses, [&](int batch_idx, int class_idx) {
         /*
         // nms over a class over an image
@@ -549,39 +567,19 @@ void MultiClassNms::nmsWithoutEta(const float* boxes,
             const float* boxesPtr = slice_class(batch_idx, class_idx, boxes, boxesStrides, true, roisnum, roisnumStrides, shared);
             const float* scoresPtr = slice_class(batch_idx, class_idx, scores, scoresStrides, false, roisnum, roisnumStrides, shared);
 
-            std::vector<std::pair<float, int>> sorted_boxes;
             int cur_numBoxes = shared ? m_numBoxes : roisnum[batch_idx];
-            for (int box_idx = 0; box_idx < cur_numBoxes; box_idx++) {
-                if (scoresPtr[box_idx] >= m_scoreThreshold)  // align with ref
-                    sorted_boxes.emplace_back(std::make_pair(scoresPtr[box_idx], box_idx));
-            }
+            const auto sorted_boxes = sortCandidates(scoresPtr, cur_numBoxes, m_scoreThreshold);
 
             int io_selection_size = 0;
             if (sorted_boxes.size() > 0) {
-                parallel_sort(sorted_boxes.begin(), sorted_boxes.end(), [](const std::pair<float, int>& l, const std::pair<float, int>& r) {
-                    return (l.first > r.first || ((l.first == r.first) && (l.second < r.second)));
-                });
+                const size_t max_out_box = (std::min)(static_cast<size_t>(m_nmsRealTopk), sorted_boxes.size());
+                const auto candidates = makeNmsBoxes(boxesPtr, sorted_boxes, max_out_box, norm);
+                const auto selected = nms_greedy(candidates, iouConfig, m_iouThreshold, 1.f, max_out_box, intraClassParallel);
                 int offset = batch_idx * m_numClasses * m_nmsRealTopk + class_idx * m_nmsRealTopk;
-                m_filtBoxes[offset + 0] = filteredBoxes(sorted_boxes[0].first, batch_idx, class_idx, sorted_boxes[0].second);
-                io_selection_size++;
-                int max_out_box =
-                    (static_cast<size_t>(m_nmsRealTopk) > sorted_boxes.size()) ? sorted_boxes.size() : m_nmsRealTopk;
-                for (int box_idx = 1; box_idx < max_out_box; box_idx++) {
-                    bool box_is_selected = true;
-                    for (int idx = io_selection_size - 1; idx >= 0; idx--) {
-                        float iou = intersectionOverUnion(&boxesPtr[sorted_boxes[box_idx].second * 4],
-                            &boxesPtr[m_filtBoxes[offset + idx].box_index * 4], m_normalized);
-                        if (iou >= m_iouThreshold) {
-                            box_is_selected = false;
-                            break;
-                        }
-                    }
-
-                    if (box_is_selected) {
-                        m_filtBoxes[offset + io_selection_size] = filteredBoxes(sorted_boxes[box_idx].first, batch_idx, class_idx,
-                            sorted_boxes[box_idx].second);
-                        io_selection_size++;
-                    }
+                for (const auto candidate_idx : selected) {
+                    m_filtBoxes[offset + io_selection_size] = filteredBoxes(sorted_boxes[candidate_idx].first, batch_idx, class_idx,
+                        sorted_boxes[candidate_idx].second);
+                    io_selection_size++;
                 }
             }
             m_numFiltBox[batch_idx][class_idx] = io_selection_size;
@@ -83,12 +83,6 @@ private:
             : score(_score), batch_index(_batch_index), class_index(_class_index), box_index(_box_index) {}
     };
 
-    struct boxInfo {
-        float score;
-        int idx;
-        int suppress_begin_index;
-    };
-
     std::vector<filteredBoxes> m_filtBoxes; // rois after nms for each class in each image
 
     void checkPrecision(const InferenceEngine::Precision prec, const std::vector<InferenceEngine::Precision> precList, const std::string name,
@@ -14,6 +14,7 @@
 #include <ngraph/opsets/opset5.hpp>
 #include <ov_ops/nms_ie_internal.hpp>
 #include "utils/general_utils.h"
+#include "common/nms_kernel.hpp"
 
 #include "cpu/x64/jit_generator.hpp"
 #include "emitters/x64/jit_load_store_emitters.hpp"
@@ -835,6 +836,25 @@ bool NonMaxSuppression::created() const {
     return getType() == Type::NonMaxSuppression;
 }
 
+// stores the box with the ordered corners and the area of the intersectionOverUnion() flavor
+static void appendNmsBox(NmsBoxes& boxes, const float *box, NMSBoxEncodeType boxEncodingType) {
+    float ymin, xmin, ymax, xmax;
+    if (boxEncodingType == NMSBoxEncodeType::CENTER) {
+        //  box format: x_center, y_center, width, height
+        ymin = box[1] - box[3] / 2.f;
+        xmin = box[0] - box[2] / 2.f;
+        ymax = box[1] + box[3] / 2.f;
+        xmax = box[0] + box[2] / 2.f;
+    } else {
+        //  box format: y1, x1, y2, x2
+        ymin = (std::min)(box[0], box[2]);
+        xmin = (std::min)(box[1], box[3]);
+        ymax = (std::max)(box[0], box[2]);
+        xmax = (std::max)(box[1], box[3]);
+    }
+    boxes.push_back(ymin, xmin, ymax, xmax, (ymax - ymin) * (xmax - xmin));
+}
+
 float NonMaxSuppression::intersectionOverUnion(const float *boxesI, const float *boxesJ) {
     float yminI, xminI, ymaxI, xmaxI, yminJ, xminJ, ymaxJ, xmaxJ;
     if (boxEncodingType == NMSBoxEncodeType::CENTER) {
@@ -994,84 +1014,39 @@ void NonMaxSuppression::nmsWithSoftSigma(const float *boxes, const float *scores
 
 void NonMaxSuppression::nmsWithoutSoftSigma(const float *boxes, const float *scores, const VectorDims &boxesStrides,
                                                                 const VectorDims &scoresStrides, std::vector<filteredBoxes> &filtBoxes) {
-    int max_out_box = static_cast<int>(maxOutputBoxesPerClass);
+    const NmsIouConfig iouConfig{0.f, false};
+    // the candidates of a class are processed in parallel if the classes do not keep all the threads busy
+    const bool intraClassParallel = numBatches * numClasses < static_cast<size_t>(parallel_get_max_threads());
     parallel_for2d(numBatches, numClasses, [&](int batch_idx, int class_idx) {
         const float *boxesPtr = boxes + batch_idx * boxesStrides[0];
         const float *scoresPtr = scores + batch_idx * scoresStrides[0] + class_idx * scoresStrides[1];
 
+        std::vector<int> candidateIdx(numBoxes);
+        candidateIdx.resize(XARCH::nms_filter_scores(scoresPtr, numBoxes, scoreThreshold, false, candidateIdx.data()));
+
         std::vector<std::pair<float, int>> sorted_boxes;  // score, box_idx
-        for (size_t box_idx = 0; box_idx < numBoxes; box_idx++) {
-            if (scoresPtr[box_idx] > scoreThreshold)
-                sorted_boxes.emplace_back(std::make_pair(scoresPtr[box_idx], box_idx));
-        }
+        sorted_boxes.reserve(candidateIdx.size());
+        for (const auto box_idx : candidateIdx)
+            sorted_boxes.emplace_back(std::make_pair(scoresPtr[box_idx], box_idx));
 
         int io_selection_size = 0;
-        size_t sortedBoxSize = sorted_boxes.size();
-        if (sortedBoxSize > 0) {
+        if (!sorted_boxes.empty()) {
             parallel_sort(sorted_boxes.begin(), sorted_boxes.end(),
                           [](const std::pair<float, int>& l, const std::pair<float, int>& r) {
                               return (l.first > r.first || ((l.first == r.first) && (l.second < r.second)));
                           });
-            int offset = batch_idx*numClasses*maxOutputBoxesPerClass + class_idx*maxOutputBoxesPerClass;
-            filtBoxes[offset + 0] = filteredBoxes(sorted_boxes[0].first, batch_idx, class_idx, sorted_boxes[0].second);
-            io_selection_size++;
-            if (sortedBoxSize > 1) {
-                if (nms_kernel) {
-                    std::vector<float> boxCoord0(sortedBoxSize, 0.0f);
-                    std::vector<float> boxCoord1(sortedBoxSize, 0.0f);
-                    std::vector<float> boxCoord2(sortedBoxSize, 0.0f);
-                    std::vector<float> boxCoord3(sortedBoxSize, 0.0f);
 
-                    boxCoord0[0] = boxesPtr[sorted_boxes[0].second * 4];
-                    boxCoord1[0] = boxesPtr[sorted_boxes[0].second * 4 + 1];
-                    boxCoord2[0] = boxesPtr[sorted_boxes[0].second * 4 + 2];
-                    boxCoord3[0] = boxesPtr[sorted_boxes[0].second * 4 + 3];
+            NmsBoxes candidates;
+            candidates.reserve(sorted_boxes.size());
+            for (const auto& box : sorted_boxes)
+                appendNmsBox(candidates, &boxesPtr[box.second * 4], boxEncodingType);
 
-                    auto arg = jit_nms_args();
-                    arg.iou_threshold = static_cast<float*>(&iouThreshold);
-                    arg.score_threshold = static_cast<float*>(&scoreThreshold);
-                    arg.scale = static_cast<float*>(&scale);
-                    // box start index do not change for hard supresion
-                    arg.selected_boxes_coord[0] = static_cast<float*>(&boxCoord0[0]);
-                    arg.selected_boxes_coord[1] = static_cast<float*>(&boxCoord1[0]);
-                    arg.selected_boxes_coord[2] = static_cast<float*>(&boxCoord2[0]);
-                    arg.selected_boxes_coord[3] = static_cast<float*>(&boxCoord3[0]);
-
-                    for (size_t candidate_idx = 1; (candidate_idx < sortedBoxSize) && (io_selection_size < max_out_box); candidate_idx++) {
-                        int candidateStatus = NMSCandidateStatus::SELECTED; // 0 for suppressed, 1 for selected
-                        arg.selected_boxes_num = io_selection_size;
-                        arg.candidate_box = static_cast<const float*>(&boxesPtr[sorted_boxes[candidate_idx].second * 4]);
-                        arg.candidate_status = static_cast<int*>(&candidateStatus);
-                        (*nms_kernel)(&arg);
-                        if (candidateStatus == NMSCandidateStatus::SELECTED) {
-                            boxCoord0[io_selection_size] = boxesPtr[sorted_boxes[candidate_idx].second * 4];
-                            boxCoord1[io_selection_size] = boxesPtr[sorted_boxes[candidate_idx].second * 4 + 1];
-                            boxCoord2[io_selection_size] = boxesPtr[sorted_boxes[candidate_idx].second * 4 + 2];
-                            boxCoord3[io_selection_size] = boxesPtr[sorted_boxes[candidate_idx].second * 4 + 3];
-                            filtBoxes[offset + io_selection_size] =
-                                filteredBoxes(sorted_boxes[candidate_idx].first, batch_idx, class_idx, sorted_boxes[candidate_idx].second);
-                            io_selection_size++;
-                        }
-                    }
-                } else {
-                    for (size_t candidate_idx = 1; (candidate_idx < sortedBoxSize) && (io_selection_size < max_out_box); candidate_idx++) {
-                        int candidateStatus = NMSCandidateStatus::SELECTED; // 0 for suppressed, 1 for selected
-                        for (int selected_idx = io_selection_size - 1; selected_idx >= 0; selected_idx--) {
-                            float iou = intersectionOverUnion(&boxesPtr[sorted_boxes[candidate_idx].second * 4],
-                                &boxesPtr[filtBoxes[offset + selected_idx].box_index * 4]);
-                            if (iou >= iouThreshold) {
-                                candidateStatus = NMSCandidateStatus::SUPPRESSED;
-                                break;
-                            }
-                        }
-
-                        if (candidateStatus == NMSCandidateStatus::SELECTED) {
-                            filtBoxes[offset + io_selection_size] =
-                                filteredBoxes(sorted_boxes[candidate_idx].first, batch_idx, class_idx, sorted_boxes[candidate_idx].second);
-                            io_selection_size++;
-                        }
-                    }
-                }
+            const auto selected = nms_greedy(candidates, iouConfig, iouThreshold, 1.f, maxOutputBoxesPerClass, intraClassParallel);
+            int offset = batch_idx*numClasses*maxOutputBoxesPerClass + class_idx*maxOutputBoxesPerClass;
+            for (const auto candidate_idx : selected) {
+                filtBoxes[offset + io_selection_size] =
+                    filteredBoxes(sorted_boxes[candidate_idx].first, batch_idx, class_idx, sorted_boxes[candidate_idx].second);
+                io_selection_size++;
             }
         }
 
@@ -0,0 +1,137 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "normalize_preprocess.h"
+#include "ie_parallel.hpp"
+#include "transformations/cpu_opset/common/op/normalize_preprocess.hpp"
+#include "shape_inference/custom/normalize_preprocess.hpp"
+
+namespace ov {
+namespace intel_cpu {
+namespace node {
+
+bool NormalizePreprocess::isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std::string& errorMessage) noexcept {
+    try {
+        const auto preprocess = ov::as_type_ptr<const NormalizePreprocessNode>(op);
+        if (!preprocess) {
+            errorMessage = "Only NormalizePreprocess from CPU internal opset is supported";
+            return false;
+        }
+        for (size_t i = 1; i < op->get_input_size(); ++i) {
+            if (!ov::is_type<ov::op::v0::Constant>(op->get_input_node_ptr(i))) {
+                errorMessage = "Only constant scale and shift inputs are supported";
+                return false;
+            }
+        }
+    } catch (...) {
+        return false;
+    }
+
+    return true;
+}
+
+NormalizePreprocess::NormalizePreprocess(const std::shared_ptr<ov::Node>& op, const GraphContext::CPtr& context)
+    : Node(op, context, NormalizePreprocessShapeInferFactory(op)) {
+    std::string errorMessage;
+    if (!isSupportedOperation(op, errorMessage)) {
+        IE_THROW(NotImplemented) << errorMessage;
+    }
+}
+
+void NormalizePreprocess::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    srcPrecision = getOriginalInputPrecisionAtPort(0);
+    if (srcPrecision != InferenceEngine::Precision::U8 && srcPrecision != InferenceEngine::Precision::I8) {
+        srcPrecision = InferenceEngine::Precision::FP32;
+    }
+
+    addSupportedPrimDesc({{LayoutType::ncsp, srcPrecision},
+                          {LayoutType::ncsp, InferenceEngine::Precision::FP32},
+                          {LayoutType::ncsp, InferenceEngine::Precision::FP32}},
+                         {{LayoutType::ncsp, InferenceEngine::Precision::FP32}},
+                         ref_any);
+}
+
+void NormalizePreprocess::prepareParams() {
+    const auto& srcDims = getParentEdgeAt(0)->getMemoryPtr()->getStaticDims();
+    const size_t rank = srcDims.size();
+
+    batch = srcDims[0];
+    rows = std::accumulate(srcDims.begin() + 1, srcDims.end() - 2, size_t(1), std::multiplies<size_t>());
+    cols = srcDims[rank - 2];
+    channels = srcDims[rank - 1];
+}
+
+template <typename T>
+void NormalizePreprocess::normalize(const T* src, float* dst) const {
+    const auto* scale = reinterpret_cast<const float*>(getParentEdgeAt(1)->getMemoryPtr()->getData());
+    const auto* shift = reinterpret_cast<const float*>(getParentEdgeAt(2)->getMemoryPtr()->getData());
+    const size_t planeSize = rows * cols;
+
+    // Every thread processes a row of the image: the interleaved channels are read once and written to
+    // the contiguous planes of the output, the inner loops are simple enough to be vectorized by the compiler
+    parallel_for2d(batch, rows, [&](size_t n, size_t r) {
+        const T* in = src + (n * planeSize + r * cols) * channels;
+        float* out = dst + n * planeSize * channels + r * cols;
+        if (channels == 3) {
+            float* out0 = out;
+            float* out1 = out + planeSize;
+            float* out2 = out + 2 * planeSize;
+            const float scale0 = scale[0], scale1 = scale[1], scale2 = scale[2];
+            const float shift0 = shift[0], shift1 = shift[1], shift2 = shift[2];
+            for (size_t w = 0; w < cols; ++w) {
+                out0[w] = static_cast<float>(in[3 * w]) * scale0 + shift0;
+                out1[w] = static_cast<float>(in[3 * w + 1]) * scale1 + shift1;
+                out2[w] = static_cast<float>(in[3 * w + 2]) * scale2 + shift2;
+            }
+        } else {
+            for (size_t c = 0; c < channels; ++c) {
+                float* outC = out + c * planeSize;
+                const T* inC = in + c;
+                const float scaleC = scale[c];
+                const float shiftC = shift[c];
+                for (size_t w = 0; w < cols; ++w) {
+                    outC[w] = static_cast<float>(inC[w * channels]) * scaleC + shiftC;
+                }
+            }
+        }
+    });
+}
+
+void NormalizePreprocess::execute(dnnl::stream strm) {
+    const auto* srcData = getParentEdgeAt(0)->getMemoryPtr()->getData();
+    auto* dstData = reinterpret_cast<float*>(getChildEdgeAt(0)->getMemoryPtr()->getData());
+
+    switch (srcPrecision) {
+        case InferenceEngine::Precision::U8:
+            normalize(reinterpret_cast<const uint8_t*>(srcData), dstData);
+            break;
+        case InferenceEngine::Precision::I8:
+            normalize(reinterpret_cast<const int8_t*>(srcData), dstData);
+            break;
+        case InferenceEngine::Precision::FP32:
+            normalize(reinterpret_cast<const float*>(srcData), dstData);
+            break;
+        default:
+            IE_THROW() << "Unsupported source precision: " << srcPrecision;
+    }
+}
+
+void NormalizePreprocess::executeDynamicImpl(dnnl::stream strm) {
+    execute(strm);
+}
+
+bool NormalizePreprocess::created() const {
+    return getType() == Type::NormalizePreprocess;
+}
+
+}   // namespace node
+}   // namespace intel_cpu
+}   // namespace ov
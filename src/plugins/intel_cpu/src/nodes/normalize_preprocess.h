@@ -0,0 +1,51 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <node.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace ov {
+namespace intel_cpu {
+namespace node {
+
+/**
+ * Fused input preprocessing: element type conversion, per-channel scale and shift and channels last to
+ * channels first layout conversion done in a single pass over the input.
+ */
+class NormalizePreprocess : public Node {
+public:
+    NormalizePreprocess(const std::shared_ptr<ov::Node>& op, const GraphContext::CPtr& context);
+
+    void getSupportedDescriptors() override {};
+    void initSupportedPrimitiveDescriptors() override;
+    void execute(dnnl::stream strm) override;
+    bool created() const override;
+
+    static bool isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std::string& errorMessage) noexcept;
+
+protected:
+    void executeDynamicImpl(dnnl::stream strm) override;
+    void prepareParams() override;
+
+private:
+    template <typename T>
+    void normalize(const T* src, float* dst) const;
+
+    size_t batch = 0;
+    // all the spatial dimensions except the innermost one
+    size_t rows = 0;
+    size_t cols = 0;
+    size_t channels = 0;
+
+    InferenceEngine::Precision srcPrecision;
+};
+
+}   // namespace node
+}   // namespace intel_cpu
+}   // namespace ov
@@ -48,6 +48,8 @@ namespace {
 
 struct SnippetKey {
     Snippet::SnippetAttrs attrs;
+    // the shape agnostic executor is keyed by the canonical chunk shapes which may coincide with the real ones
+    bool shapeAgnostic;
 
     size_t hash() const;
     bool operator==(const SnippetKey& rhs) const;
@@ -73,12 +75,13 @@ size_t SnippetKey::hash() const {
         seed = hash_combine(seed, prec.getPrecVal());
 
     seed = hash_combine(seed, attrs.bodyHash);
+    seed = hash_combine(seed, shapeAgnostic);
 
     return seed;
 }
 
 bool SnippetKey::operator==(const SnippetKey& rhs) const {
-    if (attrs.bodyHash != rhs.attrs.bodyHash)
+    if (attrs.bodyHash != rhs.attrs.bodyHash || shapeAgnostic != rhs.shapeAgnostic)
         return false;
     if (attrs.inMemBlockedDims.size() != rhs.attrs.inMemBlockedDims.size() ||
         attrs.inMemOrders.size() != rhs.attrs.inMemOrders.size() ||
@@ -138,6 +141,21 @@ snippets::op::Subgraph::BlockedShapeVector getBlockedShapes(const std::vector<st
 
     return blockedShapes;
 }
+
+// Replaces the blocked dims of all the inputs and outputs with <1, ..., 1, size>: the kernel generated for
+// these shapes processes size contiguous elements starting from the passed pointers
+Snippet::SnippetAttrs getShapeAgnosticAttrs(const Snippet::SnippetAttrs& attrs, size_t size) {
+    Snippet::SnippetAttrs result = attrs;
+    auto canonicalize = [size](std::vector<std::vector<size_t>>& memBlockedDims) {
+        for (auto& dims : memBlockedDims) {
+            std::fill(dims.begin(), dims.end(), 1);
+            dims.back() = size;
+        }
+    };
+    canonicalize(result.inMemBlockedDims);
+    canonicalize(result.outMemBlockedDims);
+    return result;
+}
 } // namespace
 
 Snippet::Snippet(const std::shared_ptr<ov::Node>& op, const GraphContext::CPtr& context)
@@ -176,6 +194,30 @@ void Snippet::init_body_hash() {
     snippetAttrs.bodyHash = seed;
 }
 
+bool Snippet::is_shape_agnostic_body() const {
+    if (snippetAttrs.snippet->has_domain_sensitive_ops() || original_snippet->get_virtual_port_count() != 0)
+        return false;
+    for (const auto& op : original_snippet->body_ptr()->get_ops()) {
+        if (ov::is_type<ov::op::v1::Reshape>(op))
+            return false;
+        // non scalar constants are broadcasted along the particular axes
+        if (ov::is_type<ov::op::v0::Constant>(op) && ov::shape_size(op->get_output_shape(0)) != 1)
+            return false;
+    }
+    return true;
+}
+
+bool Snippet::have_equal_mem_blocked_dims() const {
+    const auto& dims = snippetAttrs.outMemBlockedDims[0];
+    if (dims.empty() || dims.size() > rank6D)
+        return false;
+    auto isEqual = [&dims](const std::vector<size_t>& other) {
+        return other == dims;
+    };
+    return std::all_of(snippetAttrs.inMemBlockedDims.begin(), snippetAttrs.inMemBlockedDims.end(), isEqual) &&
+           std::all_of(snippetAttrs.outMemBlockedDims.begin(), snippetAttrs.outMemBlockedDims.end(), isEqual);
+}
+
 void Snippet::initSupportedPrimitiveDescriptors() {
     copy_snippet();
     if (!supportedPrimitiveDescriptors.empty())
@@ -336,6 +378,15 @@ void Snippet::initOptimalPrimitiveDescriptor() {
     snippetAttrs.outMemBlockedDims.resize(outputNum);
     srcMemPtrs.resize(inputNum);
     dstMemPtrs.resize(outputNum);
+
+    if (is_dynamic && is_shape_agnostic_body()) {
+        const auto& order = snippetAttrs.outMemOrders[0];
+        auto isEqual = [&order](const std::vector<size_t>& other) {
+            return other == order;
+        };
+        is_shape_agnostic = std::all_of(snippetAttrs.inMemOrders.begin(), snippetAttrs.inMemOrders.end(), isEqual) &&
+                            std::all_of(snippetAttrs.outMemOrders.begin(), snippetAttrs.outMemOrders.end(), isEqual);
+    }
 }
 
 InferenceEngine::Precision Snippet::getRuntimePrecision() const {
@@ -356,16 +407,34 @@ void Snippet::prepareParams() {
     for (size_t i = 0; i < outputNum; i++)
         snippetAttrs.outMemBlockedDims[i] = getChildEdgesAtPort(i)[0]->getMemory().getDescWithType<BlockedMemoryDesc>()->getBlockDims();
 
-    SnippetKey key = {snippetAttrs};
-
     auto builder = [this](const SnippetKey& key) -> std::shared_ptr<SnippetExecutor> {
-        std::shared_ptr<SnippetExecutor> executor = std::make_shared<SnippetJitExecutor>(key.attrs, is_canonicalized,
-            is_dynamic, context->getConfig().inferencePrecision == ov::element::bf16);
+        const bool enforceBF16 = context->getConfig().inferencePrecision == ov::element::bf16;
+        std::shared_ptr<SnippetExecutor> executor;
+        if (key.shapeAgnostic) {
+            auto shapeAgnosticExecutor =
+                std::make_shared<SnippetJitShapeAgnosticExecutor>(key.attrs, is_canonicalized, is_dynamic, enforceBF16);
+            if (shapeAgnosticExecutor->kernels_created())
+                executor = shapeAgnosticExecutor;
+        } else {
+            executor = std::make_shared<SnippetJitExecutor>(key.attrs, is_canonicalized, is_dynamic, enforceBF16);
+        }
         is_canonicalized = true;
         return executor;
     };
 
     auto cache = context->getParamsCache();
+    // the shape agnostic executor serves all the shapes without broadcasting, so it's looked up by the canonical shapes
+    if (is_shape_agnostic && have_equal_mem_blocked_dims()) {
+        SnippetKey key = {getShapeAgnosticAttrs(snippetAttrs, SnippetJitShapeAgnosticExecutor::chunkSize), true};
+        execPtr = cache->getOrCreate(key, builder).first;
+        if (execPtr)
+            return;
+        // the body isn't compiled to the kernels processing the flattened tensors in one call,
+        // so the node falls back to the executors generated for each shape
+        is_shape_agnostic = false;
+    }
+
+    SnippetKey key = {snippetAttrs};
     auto result = cache->getOrCreate(key, builder);
     execPtr = result.first;
     if (!execPtr) {
@@ -427,17 +496,9 @@ void Snippet::SnippetJitExecutor::exec(const std::vector<MemoryPtr>& inMemPtrs,
     if (schedule.ptr == nullptr) {
         IE_THROW() << "Snippet can't use Optimized implementation and can't fallback to reference";
     }
-    auto initStartMemoryOffsets = [this, &inMemPtrs, &outMemPtrs]() {
-        for (size_t i = 0; i < numInput; i++) {
-            start_offset_in[i] = inMemPtrs[i]->getDescWithType<BlockedMemoryDesc>()->getOffsetPadding() * dataSize[i];
-        }
-        for (size_t i = 0; i < numOutput; i++) {
-            start_offset_out[i] = outMemPtrs[i]->getDescWithType<BlockedMemoryDesc>()->getOffsetPadding() * dataSize[i + numInput];
-        }
-    };
     // initialize start offsets to src and dst memory
     // Needs to be done for every set of infer, as data memory ptrs could've updated
-    initStartMemoryOffsets();
+    init_start_offsets(inMemPtrs, outMemPtrs);
 
     if (tensorRank == rank6D) {
         schedule_6d(inMemPtrs, outMemPtrs);
@@ -446,6 +507,15 @@ void Snippet::SnippetJitExecutor::exec(const std::vector<MemoryPtr>& inMemPtrs,
     }
 }
 
+void Snippet::SnippetJitExecutor::init_start_offsets(const std::vector<MemoryPtr>& inMemPtrs, const std::vector<MemoryPtr>& outMemPtrs) {
+    for (size_t i = 0; i < numInput; i++) {
+        start_offset_in[i] = inMemPtrs[i]->getDescWithType<BlockedMemoryDesc>()->getOffsetPadding() * dataSize[i];
+    }
+    for (size_t i = 0; i < numOutput; i++) {
+        start_offset_out[i] = outMemPtrs[i]->getDescWithType<BlockedMemoryDesc>()->getOffsetPadding() * dataSize[i + numInput];
+    }
+}
+
 void Snippet::SnippetJitExecutor::update_ptrs(jit_snippets_call_args& call_args,
     const std::vector<MemoryPtr>& inMemPtrs, const std::vector<MemoryPtr>& outMemPtrs) {
     for (size_t i = 0; i < inMemPtrs.size(); i++)
@@ -495,6 +565,20 @@ void Snippet::SnippetJitExecutor::schedule_nt(const std::vector<MemoryPtr>& inMe
     });
 }
 
+void Snippet::SnippetJitExecutor::exec_flat(const std::vector<MemoryPtr>& inMemPtrs, const std::vector<MemoryPtr>& outMemPtrs,
+                                            size_t offset) {
+    jit_snippets_call_args call_args;
+    update_ptrs(call_args, inMemPtrs, outMemPtrs);
+    for (size_t i = 0; i < numInput; i++)
+        call_args.src_ptrs[i] = static_cast<const uint8_t*>(call_args.src_ptrs[i]) + offset * dataSize[i];
+    for (size_t i = 0; i < numOutput; i++)
+        call_args.dst_ptrs[i] = static_cast<uint8_t*>(call_args.dst_ptrs[i]) + offset * dataSize[i + numInput];
+
+    // the whole domain is processed by the single call, so there is no offset applied by the kernel itself
+    const int64_t indexes[rank6D] = {};
+    schedule.get_callable<kernel>()(indexes, &call_args);
+}
+
 Snippet::SnippetExecutor::SnippetExecutor(const SnippetAttrs& attrs, bool is_canonicalized, bool is_dynamic, bool enforceBF16)
     : snippetAttrs(attrs), is_canonicalized(is_canonicalized), is_dynamic(is_dynamic), enforceBF16(enforceBF16) {}
 
@@ -735,6 +819,67 @@ bool Snippet::SnippetJitExecutor::schedule_created() {
     return schedule.ptr != nullptr;
 }
 
+Snippet::SnippetJitShapeAgnosticExecutor::SnippetJitShapeAgnosticExecutor(const SnippetAttrs& attrs, bool is_canonicalized,
+                                                                          bool is_dynamic, bool enforceBF16) :
+    SnippetExecutor(attrs, is_canonicalized, is_dynamic, enforceBF16) {
+    // returns nullptr if the kernel can't process the given number of elements of the flattened tensors in one call
+    auto create = [&](size_t size, bool canonicalized) {
+        std::unique_ptr<SnippetJitExecutor> executor(
+            new SnippetJitExecutor(getShapeAgnosticAttrs(attrs, size), canonicalized, is_dynamic, enforceBF16));
+        if (!executor->schedule_created() || !executor->is_flat_kernel(size))
+            executor.reset();
+        return executor;
+    };
+    chunkExecutor = create(chunkSize, is_canonicalized);
+    for (size_t i = 0; i < tailExecutors.size() && chunkExecutor; i++) {
+        tailExecutors[i] = create(chunkSize >> (i + 1), true);
+        if (!tailExecutors[i])
+            chunkExecutor.reset();
+    }
+}
+
+bool Snippet::SnippetJitShapeAgnosticExecutor::kernels_created() const {
+    return chunkExecutor != nullptr;
+}
+
+void Snippet::SnippetJitShapeAgnosticExecutor::exec(const std::vector<MemoryPtr>& inMemPtrs, const std::vector<MemoryPtr>& outMemPtrs) {
+    // all the inputs and outputs have the same blocked dims, so the snippet is applied to the flattened tensors
+    const auto& blockedDims = outMemPtrs[0]->getDescWithType<BlockedMemoryDesc>()->getBlockDims();
+    const size_t workAmount = std::accumulate(blockedDims.begin(), blockedDims.end(), size_t(1), std::multiplies<size_t>());
+    const size_t chunksNum = workAmount / chunkSize;
+    const size_t tail = workAmount - chunksNum * chunkSize;
+
+    // the tail is split into the pieces of the power of two sizes, each one is processed by the vector loop
+    // of the kernel generated for its size, so the tail takes at most log2(chunkSize) calls
+    std::array<std::pair<SnippetJitExecutor*, size_t>, tailKernelsNum> tailPieces;
+    size_t tailPiecesNum = 0;
+    size_t offset = chunksNum * chunkSize;
+    for (size_t i = 0; i < tailExecutors.size(); i++) {
+        const size_t size = chunkSize >> (i + 1);
+        if (tail & size) {
+            tailPieces[tailPiecesNum++] = {tailExecutors[i].get(), offset};
+            offset += size;
+        }
+    }
+
+    chunkExecutor->init_start_offsets(inMemPtrs, outMemPtrs);
+    for (size_t i = 0; i < tailPiecesNum; i++)
+        tailPieces[i].first->init_start_offsets(inMemPtrs, outMemPtrs);
+
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        splitter(chunksNum + tailPiecesNum, nthr, ithr, start, end);
+        for (size_t i = start; i < end; ++i) {
+            if (i < chunksNum) {
+                chunkExecutor->exec_flat(inMemPtrs, outMemPtrs, i * chunkSize);
+            } else {
+                const auto& piece = tailPieces[i - chunksNum];
+                piece.first->exec_flat(inMemPtrs, outMemPtrs, piece.second);
+            }
+        }
+    });
+}
+
 }   // namespace node
 }   // namespace intel_cpu
 }   // namespace ov
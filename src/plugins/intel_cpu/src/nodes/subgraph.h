@@ -65,6 +65,9 @@ private:
     // TODO: Probably better to implement a proper copy constructor
     void copy_snippet() const;
     void init_body_hash();
+    // returns true if the body is a pure elementwise graph, so it can be evaluated on the flattened tensors
+    bool is_shape_agnostic_body() const;
+    bool have_equal_mem_blocked_dims() const;
 
     size_t inputNum = 0;
     size_t outputNum = 0;
@@ -82,6 +85,9 @@ private:
     mutable SnippetAttrs snippetAttrs;
     mutable bool is_canonicalized = false;
     bool is_dynamic = false;
+    // the elementwise snippet with the same layouts of all the inputs and outputs can be executed by the single
+    // shape agnostic executor for all the shapes without broadcasting, see SnippetJitShapeAgnosticExecutor
+    bool is_shape_agnostic = false;
 
     class SnippetExecutor {
         public:
@@ -105,6 +111,16 @@ private:
 
             bool schedule_created();
 
+            // true if the kernel processes the whole domain of the given number of elements in one call
+            bool is_flat_kernel(size_t size) const {
+                return tileRank == 1 && harnessWorkAmount == 1 && fullWorkAmount == size;
+            }
+
+            // Runs the kernel on the flattened inputs and outputs starting from the element offset, see is_flat_kernel().
+            // The start offsets must be initialized for the memory beforehand.
+            void exec_flat(const std::vector<MemoryPtr>& inMemPtrs, const std::vector<MemoryPtr>& outMemPtrs, size_t offset);
+            void init_start_offsets(const std::vector<MemoryPtr>& inMemPtrs, const std::vector<MemoryPtr>& outMemPtrs);
+
         private:
             static const size_t rank6D {6};
 
@@ -153,6 +169,29 @@ private:
             std::vector<uint8_t> buffer_scratchpad = {};
             size_t buffer_scratchpad_size = 0;
     };
+
+    // Executes the elementwise snippet on the flattened inputs and outputs of equal shapes: the body is compiled once
+    // for the fixed size chunk and for each power of two tail size smaller than the chunk, and the kernels are reused
+    // for any input shape, so the new shapes of the dynamic node don't trigger code generation.
+    class SnippetJitShapeAgnosticExecutor : public SnippetExecutor {
+        public:
+            SnippetJitShapeAgnosticExecutor(const SnippetAttrs& attrs, bool is_canonicalized, bool is_dynamic, bool enforceBF16);
+            void exec(const std::vector<MemoryPtr>& inMemPtrs, const std::vector<MemoryPtr>& outMemPtrs) override;
+
+            // false if the body can't be compiled to the kernels processing the flattened tensors in one call,
+            // the executor can't be used then
+            bool kernels_created() const;
+
+            static const size_t chunkSize {256};
+
+        private:
+            // log2(chunkSize)
+            static const size_t tailKernelsNum {8};
+
+            std::unique_ptr<SnippetJitExecutor> chunkExecutor;
+            // the kernels for chunkSize / 2, chunkSize / 4, ..., 1 elements
+            std::array<std::unique_ptr<SnippetJitExecutor>, tailKernelsNum> tailExecutors;
+    };
 };
 
 }   // namespace node
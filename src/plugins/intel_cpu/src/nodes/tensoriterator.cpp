@@ -78,6 +78,26 @@ static void nullifyUndefinedDims(VectorDims& dims) {
     });
 }
 
+// the body port memory may be rebound to another buffer if it is not a partition of another tensor
+// and the buffer is not owned by the memory manager
+static bool isRebindable(const MemoryPtr& mem) {
+    const auto mngr = mem->getMemoryMngr();
+    return std::dynamic_pointer_cast<DnnlMemoryMngr>(mngr) && mngr->hasExtBuffer();
+}
+
+// the chunk of the plain tensor taken along the axis is contiguous if all the outer dimensions are 1
+static bool isContiguousChunk(const MemoryPtr& full, const MemoryPtr& part, const PortMap& slice_rule) {
+    const auto& full_desc = full->getDesc();
+    const auto& part_desc = part->getDesc();
+    if (!full_desc.hasLayoutType(LayoutType::ncsp) || !part_desc.hasLayoutType(LayoutType::ncsp) ||
+        full_desc.getPrecision() != part_desc.getPrecision() || part->getSize() == 0)
+        return false;
+    const auto& dims = full->getStaticDims();
+    const auto iter_count = dims[slice_rule.axis] / std::abs(slice_rule.stride);
+    return std::all_of(dims.begin(), dims.begin() + slice_rule.axis, [](size_t dim) { return dim == 1; }) &&
+           part->getSize() * iter_count == full->getSize();
+}
+
 class PortIteratorHelper : public PortMapHelper {
 public:
     PortIteratorHelper(MultiCachePtr cache, const MemoryPtr &from, const MemoryPtr &to, bool sliced_src,
@@ -160,6 +180,66 @@ public:
     }
 };
 
+/**
+ * Binds the body port memory to the chunk of the outer tensor processed on the iteration, so the body reads the sliced
+ * input from (or writes the concatenated output to) the outer buffer directly, without the reorders.
+ * The memory manager of the body port notifies all the memory objects sharing it, including the primitives arguments.
+ */
+class PortChunkBindHelper : public PortMapHelper {
+public:
+    PortChunkBindHelper(const MemoryPtr &full, const MemoryPtr &part, const PortMap &slice_rule)
+                        : full_mem(full), part_mngr(part->getMemoryMngr()) {
+        const auto abs_stride = std::abs(slice_rule.stride);
+        iter_count = static_cast<int>(full->getStaticDims()[slice_rule.axis]) / abs_stride;
+        chunk_size = part->getSize();
+        IE_ASSERT(chunk_size * iter_count == full->getSize()) << "Shape mismatch for tensor iterator port";
+
+        chunk_stride_in_byte = static_cast<ptrdiff_t>(chunk_size);
+        chunk_offset_in_byte = slice_rule.stride < 0 ? (iter_count - 1) * chunk_stride_in_byte : 0;
+        chunk_stride_in_byte *= slice_rule.stride < 0 ? -1 : 1;
+    }
+
+    void execute(dnnl::stream strm, int iter) override {
+        IE_ASSERT(iter >= 0 && iter < iter_count);
+        // the outer buffer is requested on every iteration since it may be rebound between the inferences
+        part_mngr->setExtBuff(static_cast<uint8_t *>(full_mem->getData()) + chunk_offset_in_byte + chunk_stride_in_byte * iter,
+                              chunk_size);
+    }
+
+private:
+    ptrdiff_t chunk_stride_in_byte = 0;
+    ptrdiff_t chunk_offset_in_byte = 0;
+    size_t chunk_size = 0;
+
+    MemoryPtr full_mem;
+    MemoryMngrPtr part_mngr;
+
+    int iter_count;
+};
+
+/**
+ * Passes the body output to the body input of the next iteration by swapping their buffers instead of copying.
+ */
+class BackEdgeSwapHelper : public PortMapHelper {
+public:
+    BackEdgeSwapHelper(const MemoryPtr &from, const MemoryPtr &to)
+                       : from_mngr(from->getMemoryMngr()), to_mngr(to->getMemoryMngr()), size(to->getSize()) {}
+
+    void execute(dnnl::stream strm, int iter = -1) override {
+        if (iter != 0) {
+            auto from_ptr = from_mngr->getRawPtr();
+            auto to_ptr = to_mngr->getRawPtr();
+            to_mngr->setExtBuff(from_ptr, size);
+            from_mngr->setExtBuff(to_ptr, size);
+        }
+    }
+
+private:
+    MemoryMngrPtr from_mngr;
+    MemoryMngrPtr to_mngr;
+    size_t size;
+};
+
 class IterCountPortHelper : public PortMapHelper {
 public:
     IterCountPortHelper(const MemoryPtr &to, const dnnl::engine& eng) {
@@ -415,6 +495,10 @@ void TensorIterator::getSupportedDescriptors() {
         auto inNode = inMap.find(param->get_friendly_name());
         if (inNode != inMap.end()) {
             input_mems.push_back(getToMemories(inNode->second.get(), 0));
+            const auto& childEdges = inNode->second->getChildEdgesAtPort(0);
+            input_modified_in_place.push_back(std::any_of(childEdges.begin(), childEdges.end(), [](const EdgePtr& edge) {
+                return edge->modifiedInPlace() != nullptr;
+            }));
         }
     }
 
@@ -639,6 +723,8 @@ void TensorIterator::prepareInputPorts() {
 
         if (map_rule.axis == -1)
             first_mappers.emplace_back(std::make_shared<BackEdgePortHelper>(context->getParamsCache(), from_mem, to_mem, eng));
+        else if (canBindInput(map_rule, from_mem, to_mem))
+            before_mappers.emplace_back(std::make_shared<PortChunkBindHelper>(from_mem, to_mem, map_rule));
         else
             before_mappers.emplace_back(
                     std::make_shared<PortIteratorHelper>(context->getParamsCache(), from_mem, to_mem, true, map_rule, eng));
@@ -653,6 +739,8 @@ void TensorIterator::prepareOutputPorts() {
 
         if (map_rule.axis == -1)
             last_mappers.emplace_back(std::make_shared<BackEdgePortHelper>(context->getParamsCache(), from_mem, to_mem, eng));
+        else if (canBindOutput(map_rule, from_mem, to_mem))
+            before_mappers.emplace_back(std::make_shared<PortChunkBindHelper>(to_mem, from_mem, map_rule));
         else
             after_mappers.emplace_back(std::make_shared<PortIteratorHelper>(context->getParamsCache(), from_mem, to_mem, false, map_rule, eng));
     }
@@ -664,19 +752,35 @@ void TensorIterator::prepareBackEdges() {
         auto from_mem = output_mem[map_rule.from];
         auto to_mem = input_mems[map_rule.to].front();
 
-        before_mappers.emplace_back(std::make_shared<BackEdgePortHelper>(context->getParamsCache(), from_mem, to_mem, eng));
+        if (canSwapBackEdge(map_rule, from_mem, to_mem))
+            before_mappers.emplace_back(std::make_shared<BackEdgeSwapHelper>(from_mem, to_mem));
+        else
+            before_mappers.emplace_back(std::make_shared<BackEdgePortHelper>(context->getParamsCache(), from_mem, to_mem, eng));
     }
 }
 
 void TensorIterator::prepareDynamicBackEdges() {
     const auto &eng = getEngine();
-    back_mappers.clear();
-    for (auto map_rule : backEdges) {
+    bool rebuild = back_mappers.size() != backEdges.size();
+    for (size_t i = 0; i < backEdges.size(); i++) {
+        const auto& map_rule = backEdges[i];
         auto from_mem = output_mem[map_rule.from];
         auto to_mems = input_mems[map_rule.to];
 
         redefineToMemories(to_mems, from_mem->getDescPtr());
 
+        // the shapes passed through the back edges are usually loop invariant, in this case the memory primitives are
+        // the same as on the previous iteration and the mappers are reused
+        rebuild = rebuild || !back_mappers[i]->isBoundTo(from_mem->getPrimitive(), to_mems.front()->getPrimitive());
+    }
+    if (!rebuild)
+        return;
+
+    back_mappers.clear();
+    for (auto map_rule : backEdges) {
+        auto from_mem = output_mem[map_rule.from];
+        auto to_mems = input_mems[map_rule.to];
+
         // first memory is enough to get common memory ptr
         back_mappers.emplace_back(std::make_shared<BackEdgePortHelper>(context->getParamsCache(), from_mem, to_mems.front(), eng));
     }
@@ -872,6 +976,54 @@ int TensorIterator::getNumIteration(const std::vector<PortMap>& inputPortMap, co
     return numIterations;
 }
 
+bool TensorIterator::isExclusiveBodyMemory(const MemoryPtr& mem) const {
+    // the memory is shared with another body port (directly or in place) if their buffers overlap
+    const auto begin = static_cast<const uint8_t*>(mem->getData());
+    const auto end = begin + mem->getSize();
+    size_t users = 0;
+    const auto count_overlap = [&](const MemoryPtr& other) {
+        const auto other_begin = static_cast<const uint8_t*>(other->getData());
+        if (other_begin < end && begin < other_begin + other->getSize())
+            users++;
+    };
+    for (const auto& mems : input_mems) {
+        if (!mems.empty())
+            count_overlap(mems.front());
+    }
+    for (const auto& out : output_mem)
+        count_overlap(out);
+    return users == 1;
+}
+
+bool TensorIterator::canBindInput(const PortMap& map_rule, const MemoryPtr& from_mem, const MemoryPtr& to_mem) const {
+    // the body must not write to the outer buffer
+    return !isDynamicNode() && !input_modified_in_place[map_rule.to] && isRebindable(to_mem) &&
+           isExclusiveBodyMemory(to_mem) && isContiguousChunk(from_mem, to_mem, map_rule);
+}
+
+bool TensorIterator::canBindOutput(const PortMap& map_rule, const MemoryPtr& from_mem, const MemoryPtr& to_mem) const {
+    // the body output must be written to a single outer buffer and must not be passed to the next iteration
+    const auto sameBodyOutput = [&](const PortMap& rule) {
+        return rule.axis != -1 && rule.to == map_rule.to;
+    };
+    const auto isBackEdgeSource = [&](const PortMap& rule) {
+        return rule.from == map_rule.to;
+    };
+    return !isDynamicNode() && std::count_if(outputPortMap.begin(), outputPortMap.end(), sameBodyOutput) == 1 &&
+           std::none_of(backEdges.begin(), backEdges.end(), isBackEdgeSource) && isRebindable(from_mem) &&
+           isExclusiveBodyMemory(from_mem) && isContiguousChunk(to_mem, from_mem, map_rule);
+}
+
+bool TensorIterator::canSwapBackEdge(const PortMap& map_rule, const MemoryPtr& from_mem, const MemoryPtr& to_mem) const {
+    // the body output buffer becomes the input buffer of the next iteration, so it must feed a single back edge
+    const auto sameBodyOutput = [&](const PortMap& rule) {
+        return rule.from == map_rule.from;
+    };
+    return !isDynamicNode() && std::count_if(backEdges.begin(), backEdges.end(), sameBodyOutput) == 1 &&
+           from_mem->getDesc().isCompatible(to_mem->getDesc()) && from_mem->getSize() == to_mem->getSize() &&
+           isRebindable(from_mem) && isRebindable(to_mem) && isExclusiveBodyMemory(from_mem) && isExclusiveBodyMemory(to_mem);
+}
+
 bool TensorIterator::created() const {
     return getType() == Type::TensorIterator;
 }
@@ -37,6 +37,11 @@ class PortMapHelper {
 public:
     virtual ~PortMapHelper() = default;
     virtual void execute(dnnl::stream strm, int n_iter = -1) = 0;
+
+    /** Checks if the helper moves the data between the given memory primitives */
+    bool isBoundTo(const dnnl::memory& src, const dnnl::memory& dst) const {
+        return mem_holder_src == src && mem_holder_dst == dst;
+    }
 protected:
     dnnl::primitive reorder;
     dnnl::memory mem_holder_src;
@@ -139,15 +144,22 @@ private:
     bool checkForInputAndBodyShapesInequality() const;
     int getNumIteration(const std::vector<PortMap>& inputPortMap, const std::vector<PortMap>& outputPortMap) const;
 
+    /* Binding of the body ports to the outer buffers (static shapes only) */
+    bool isExclusiveBodyMemory(const MemoryPtr& mem) const;
+    bool canBindInput(const PortMap& map_rule, const MemoryPtr& from_mem, const MemoryPtr& to_mem) const;
+    bool canBindOutput(const PortMap& map_rule, const MemoryPtr& from_mem, const MemoryPtr& to_mem) const;
+    bool canSwapBackEdge(const PortMap& map_rule, const MemoryPtr& from_mem, const MemoryPtr& to_mem) const;
+
     ExtensionManager::Ptr ext_mng;
     Graph sub_graph;
     std::vector<std::vector<MemoryPtr>> input_mems;
+    std::vector<bool> input_modified_in_place;   /// < The body may write to the input memory
     std::vector<MemoryPtr> output_mem;
 
     std::vector<std::shared_ptr<PortMapHelper>>
         first_mappers,   /// < Applied once before loop
         last_mappers,    /// < Applied once after loop
-        before_mappers,  /// < Applied before each iteration
+        before_mappers,  /// < Applied before each iteration. Also binds the body ports to the outer buffers chunks
         after_mappers,   /// < Applied after each iteration
         back_mappers;    /// < Applied before each iteration for dynamic shapes
 
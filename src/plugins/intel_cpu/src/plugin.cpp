@@ -433,6 +433,21 @@ static bool shouldEnableLPT(const std::map<std::string, std::string>& modelConfi
         IE_THROW() << "Wrong value for property key LP_TRANSFORMS_MODE. Expected values: YES/NO";
 }
 
+static bool shouldProfileTransformations(const std::map<std::string, std::string>& modelConfig, const Config& engineConfig) {
+    const auto& profiling = modelConfig.find(ov::intel_cpu::transformations_profiling.name());
+    if (profiling == modelConfig.end()) // model config has higher priority
+        return engineConfig.transformationsProfiling;
+
+    const auto& val = profiling->second;
+    if (val == PluginConfigParams::YES)
+        return true;
+    else if (val == PluginConfigParams::NO)
+        return false;
+    else
+        IE_THROW() << "Wrong value for property key " << ov::intel_cpu::transformations_profiling.name()
+                   << ". Expected only YES/NO";
+}
+
 static ov::element::Type getInferencePrecision(const std::map<std::string, std::string>& modelConfig,
                                                const Config& engineConfig,
                                                Config::ModelType modelType) {
@@ -499,6 +514,11 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std
 
     DEBUG_LOG(PrintableModel(*nGraphFunc, "org_"));
 
+    // collects the statistics of all the passes run by the transformations pipeline below
+    std::unique_ptr<ov::pass::PassProfiler> profiler;
+    if (shouldProfileTransformations(config, engConfig))
+        profiler.reset(new ov::pass::PassProfiler());
+
     Transformations transformations(nGraphFunc, enableLPT, inferencePrecision, isLegacyAPI(), snippetsMode, engConfig);
     transformations.UpToLpt();
 
@@ -528,6 +548,12 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std
 
     transformations.CpuSpecificOpSet();
 
+    ov::pass::PassProfile transformationsProfile;
+    if (profiler) {
+        transformationsProfile = profiler->get_profile();
+        profiler.reset();
+    }
+
     DEBUG_LOG(PrintableModel(*nGraphFunc, "cpu_"));
 
     // SSE runtime check is needed for some ATOM machine, which is x86-64 but w/o SSE
@@ -542,7 +568,23 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std
         }
     }
 
-    return std::make_shared<ExecNetwork>(clonedNetwork, conf, extensionManager, shared_from_this());
+    auto execNetwork = std::make_shared<ExecNetwork>(clonedNetwork, conf, extensionManager, shared_from_this(), GetSharedParamsCache(conf));
+    execNetwork->setTransformationsProfile(std::move(transformationsProfile));
+    return execNetwork;
+}
+
+MultiCachePtr Engine::GetSharedParamsCache(const Config& config) {
+    if (config.rtCacheSharing != Config::RuntimeCacheSharing::PerPlugin)
+        return nullptr;
+
+    std::lock_guard<std::mutex> lock(sharedParamsCacheMutex);
+    auto cache = sharedParamsCache.lock();
+    if (!cache) {
+        // the cache lives as long as at least one compiled model uses it, the first model defines the capacity
+        cache = std::make_shared<MultiCache>(config.rtCacheCapacity, static_cast<size_t>(parallel_get_max_threads()));
+        sharedParamsCache = cache;
+    }
+    return cache;
 }
 
 void Engine::SetConfig(const std::map<std::string, std::string> &config) {
@@ -668,7 +710,8 @@ Parameter Engine::GetMetricLegacy(const std::string& name, const std::map<std::s
     } else if (ov::internal::supported_properties == name) {
         return decltype(ov::internal::supported_properties)::value_type{
             ov::PropertyName{ov::internal::caching_properties.name(), ov::PropertyMutability::RO},
-            ov::PropertyName{ov::internal::exclusive_async_requests.name(), ov::PropertyMutability::RW}};
+            ov::PropertyName{ov::internal::exclusive_async_requests.name(), ov::PropertyMutability::RW},
+            ov::PropertyName{ov::internal::cache_entry_id.name(), ov::PropertyMutability::WO}};
     } else if (name == ov::internal::caching_properties) {
         std::vector<ov::PropertyName> cachingProperties = { METRIC_KEY(FULL_DEVICE_NAME) };
         return decltype(ov::internal::caching_properties)::value_type(cachingProperties);
@@ -711,6 +754,7 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
                                                     RW_property(ov::device::id.name()),
                                                     RW_property(ov::intel_cpu::denormals_optimization.name()),
                                                     RW_property(ov::intel_cpu::sparse_weights_decompression_rate.name()),
+                                                    RW_property(ov::intel_cpu::transformations_profiling.name()),
         };
 
         std::vector<ov::PropertyName> supportedProperties;
@@ -722,7 +766,8 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
     } else if (ov::internal::supported_properties == name) {
         return decltype(ov::internal::supported_properties)::value_type{
             ov::PropertyName{ov::internal::caching_properties.name(), ov::PropertyMutability::RO},
-            ov::PropertyName{ov::internal::exclusive_async_requests.name(), ov::PropertyMutability::RW}};
+            ov::PropertyName{ov::internal::exclusive_async_requests.name(), ov::PropertyMutability::RW},
+            ov::PropertyName{ov::internal::cache_entry_id.name(), ov::PropertyMutability::WO}};
     } else if (name == ov::device::full_name) {
         return decltype(ov::device::full_name)::value_type(deviceFullName);
     } else if (name == ov::available_devices) {
@@ -753,6 +798,8 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
         return decltype(ov::intel_cpu::denormals_optimization)::value_type(engConfig.denormalsOptMode == Config::DenormalsOptMode::DO_On);
     } else if (name == ov::intel_cpu::sparse_weights_decompression_rate) {
         return decltype(ov::intel_cpu::sparse_weights_decompression_rate)::value_type(engConfig.fcSparseWeiDecompressionRate);
+    } else if (name == ov::intel_cpu::transformations_profiling) {
+        return decltype(ov::intel_cpu::transformations_profiling)::value_type(engConfig.transformationsProfiling);
     }
     /* Internally legacy parameters are used with new API as part of migration procedure.
      * This fallback can be removed as soon as migration completed */
@@ -828,7 +875,7 @@ InferenceEngine::IExecutableNetworkInternal::Ptr Engine::ImportNetwork(std::istr
 
     CalculateStreams(conf, function, true);
 
-    auto execNetwork = std::make_shared<ExecNetwork>(cnnnetwork, conf, extensionManager, shared_from_this());
+    auto execNetwork = std::make_shared<ExecNetwork>(cnnnetwork, conf, extensionManager, shared_from_this(), GetSharedParamsCache(conf));
 
     execNetwork->setNetworkInputs(cnnnetwork.getInputsInfo());
     execNetwork->setNetworkOutputs(cnnnetwork.getOutputsInfo());
@@ -11,6 +11,7 @@
 #include <map>
 #include <memory>
 #include <functional>
+#include <mutex>
 
 namespace ov {
 namespace intel_cpu {
@@ -51,6 +52,8 @@ private:
 
     void CalculateStreams(Config& conf, const std::shared_ptr<ngraph::Function>& ngraphFunc, bool imported = false);
 
+    MultiCachePtr GetSharedParamsCache(const Config& config);
+
     StreamCfg GetNumStreams(InferenceEngine::IStreamsExecutor::ThreadBindingType thread_binding_type,
                             int stream_mode,
                             const bool enable_hyper_thread = true) const;
@@ -63,6 +66,10 @@ private:
     const std::string deviceFullName;
 
     std::shared_ptr<void> specialSetup;
+
+    // runtime parameters cache shared between the compiled models (Config::RuntimeCacheSharing::PerPlugin)
+    std::weak_ptr<MultiCache> sharedParamsCache;
+    std::mutex sharedParamsCacheMutex;
 };
 
 }   // namespace intel_cpu
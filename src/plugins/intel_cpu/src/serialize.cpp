@@ -4,6 +4,7 @@
 #include "serialize.h"
 
 #include <openvino/pass/serialize.hpp>
+#include <openvino/runtime/mapped_memory_stream.hpp>
 
 #include <pugixml.hpp>
 
@@ -41,6 +42,34 @@ namespace {
         IE_THROW(NetworkNotRead) << "Unknown layout with name '" << name << "'";
     }
 
+    // Exposes the weights region of the mapped compiled model blob as the blob memory,
+    // the allocator keeps the mapping alive while the blob (and the constants sharing it) exists
+    class MappedMemoryAllocator : public InferenceEngine::IAllocator {
+    public:
+        MappedMemoryAllocator(std::shared_ptr<ov::MappedMemory> memory, size_t offset)
+            : _memory(std::move(memory)), _offset(offset) {}
+
+        void* lock(void* handle, InferenceEngine::LockOp) noexcept override {
+            return handle;
+        }
+
+        void unlock(void*) noexcept override {}
+
+        void* alloc(size_t size) noexcept override {
+            if (_offset > _memory->size() || size > _memory->size() - _offset)
+                return nullptr;
+            return _memory->data() + _offset;
+        }
+
+        bool free(void*) noexcept override {
+            return true;
+        }
+
+    private:
+        std::shared_ptr<ov::MappedMemory> _memory;
+        size_t _offset;
+    };
+
     template <typename T>
     void setInfo(pugi::xml_object_range<pugi::xml_named_node_iterator>&& nodes, T&& info) {
         auto nodes_it = nodes.begin();
@@ -146,10 +175,21 @@ void CNNNetworkDeserializer::operator >> (InferenceEngine::CNNNetwork & network)
     // read blob content
     _istream.seekg(hdr.consts_offset);
     if (hdr.consts_size) {
-        dataBlob = InferenceEngine::make_shared_blob<std::uint8_t>(
-            InferenceEngine::TensorDesc(InferenceEngine::Precision::U8, {hdr.consts_size}, InferenceEngine::Layout::C));
-        dataBlob->allocate();
-        _istream.read(dataBlob->buffer(), hdr.consts_size);
+        const InferenceEngine::TensorDesc desc(InferenceEngine::Precision::U8, {hdr.consts_size}, InferenceEngine::Layout::C);
+        // the weights are referenced in place if the blob is mapped (e.g. read from the model cache),
+        // so the pages are read on demand and are not duplicated in the heap
+        if (auto mappedMemory = ov::get_mapped_memory(_istream)) {
+            dataBlob = InferenceEngine::make_shared_blob<std::uint8_t>(
+                desc, std::make_shared<MappedMemoryAllocator>(mappedMemory, hdr.consts_offset));
+            dataBlob->allocate();
+            if (!dataBlob->buffer().as<void*>()) {
+                IE_THROW(NetworkNotRead) << "The weights are out of the compiled model blob bounds.";
+            }
+        } else {
+            dataBlob = InferenceEngine::make_shared_blob<std::uint8_t>(desc);
+            dataBlob->allocate();
+            _istream.read(dataBlob->buffer(), hdr.consts_size);
+        }
     }
 
     // read XML content
@@ -0,0 +1,28 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "transformations/cpu_opset/common/op/normalize_preprocess.hpp"
+#include "normalize_preprocess.hpp"
+#include "transpose.hpp"
+
+namespace ov {
+namespace intel_cpu {
+namespace node {
+
+ShapeInferPtr NormalizePreprocessShapeInferFactory::makeShapeInfer() const {
+    auto preprocess = ov::as_type_ptr<NormalizePreprocessNode>(m_op);
+    if (!preprocess) {
+        OPENVINO_THROW("Wrong operation type");
+    }
+    // the output shape is the channels last to channels first transposition of the data shape
+    const size_t rank = preprocess->get_input_partial_shape(0).rank().get_length();
+    std::vector<size_t> order{0, rank - 1};
+    for (size_t i = 1; i < rank - 1; ++i) {
+        order.push_back(i);
+    }
+    return std::make_shared<TransposeShapeInfer>(rank, order);
+}
+} // namespace node
+} // namespace intel_cpu
+} // namespace ov
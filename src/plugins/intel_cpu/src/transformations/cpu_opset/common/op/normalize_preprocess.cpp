@@ -0,0 +1,50 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "normalize_preprocess.hpp"
+#include "transformations/itt.hpp"
+
+ov::intel_cpu::NormalizePreprocessNode::NormalizePreprocessNode(const ov::Output<Node>& data,
+                                                                const ov::Output<Node>& scale,
+                                                                const ov::Output<Node>& shift)
+    : Op({data, scale, shift}) {
+    validate_and_infer_types();
+}
+
+std::shared_ptr<ov::Node> ov::intel_cpu::NormalizePreprocessNode::clone_with_new_inputs(const ov::OutputVector& new_args) const {
+    INTERNAL_OP_SCOPE(NormalizePreprocessNode_clone_with_new_inputs);
+    check_new_args_count(this, new_args);
+    return std::make_shared<ov::intel_cpu::NormalizePreprocessNode>(new_args.at(0), new_args.at(1), new_args.at(2));
+}
+
+bool ov::intel_cpu::NormalizePreprocessNode::visit_attributes(ov::AttributeVisitor &visitor) {
+    INTERNAL_OP_SCOPE(NormalizePreprocessNode_visit_attributes);
+    return true;
+}
+
+void ov::intel_cpu::NormalizePreprocessNode::validate_and_infer_types() {
+    INTERNAL_OP_SCOPE(NormalizePreprocessNode_validate_and_infer_types);
+    const auto& data_et = get_input_element_type(0);
+    const auto& data_shape = get_input_partial_shape(0);
+    NGRAPH_CHECK(data_et == ov::element::u8 || data_et == ov::element::i8 || data_et == ov::element::f32,
+                 "'data' input must be u8, i8 or f32 whereas current element type is ", data_et);
+    NGRAPH_CHECK(data_shape.rank().is_static() && data_shape.size() >= 3,
+                 "'data' input must have static rank >= 3 whereas current shape is ", data_shape);
+
+    for (size_t i = 1; i < 3; ++i) {
+        const auto& et = get_input_element_type(i);
+        const auto& shape = get_input_partial_shape(i);
+        NGRAPH_CHECK(et == ov::element::f32, "scale and shift inputs must be f32 whereas current element type is ", et);
+        NGRAPH_CHECK(shape.rank() == 1 && shape[0].compatible(data_shape[data_shape.size() - 1]),
+                     "scale and shift inputs must have shape [C] whereas current shape is ", shape);
+    }
+
+    // [N, D1, ..., Dk, C] -> [N, C, D1, ..., Dk]
+    ov::PartialShape out_shape(data_shape);
+    out_shape[1] = data_shape[data_shape.size() - 1];
+    for (size_t i = 2; i < data_shape.size(); ++i) {
+        out_shape[i] = data_shape[i - 1];
+    }
+    set_output_type(0, ov::element::f32, out_shape);
+}
@@ -0,0 +1,36 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <openvino/core/node.hpp>
+#include <openvino/op/op.hpp>
+
+namespace ov {
+namespace intel_cpu {
+/**
+ * The operation represents the typical input preprocessing chain (element type conversion, per-channel mean and scale,
+ * channels-last to channels-first layout conversion) as a single operation:
+ *     out[n, c, d...] = float(data[n, d..., c]) * scale[c] + shift[c]
+ * Inputs:
+ *     1. Data of type T - shape [N, D1, ..., Dk, C] (channels last), rank >= 3. Required
+ *     2. Per-channel scale of type f32 - shape [C]. Required
+ *     3. Per-channel shift of type f32 - shape [C]. Required
+ * Outputs:
+ *     1. Normalized data of type f32 and of shape [N, C, D1, ..., Dk] (channels first)
+ * Types:
+ *     T - U8, I8 and F32 are supported
+ */
+class NormalizePreprocessNode : public ov::op::Op {
+public:
+    OPENVINO_OP("NormalizePreprocess", "cpu_plugin_opset");
+
+    NormalizePreprocessNode() = default;
+    NormalizePreprocessNode(const ov::Output<Node>& data, const ov::Output<Node>& scale, const ov::Output<Node>& shift);
+    std::shared_ptr<ov::Node> clone_with_new_inputs(const ov::OutputVector& new_args) const override;
+    bool visit_attributes(ov::AttributeVisitor& visitor) override;
+    void validate_and_infer_types() override;
+};
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,143 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "normalize_preprocess_fusion.hpp"
+#include "transformations/cpu_opset/common/op/normalize_preprocess.hpp"
+#include <openvino/opsets/opset1.hpp>
+#include <openvino/core/rt_info.hpp>
+#include <openvino/pass/pattern/op/wrap_type.hpp>
+
+#include "transformations/itt.hpp"
+
+namespace {
+
+bool is_channels_last_to_first(const std::shared_ptr<ov::Node>& order_node, size_t rank) {
+    const auto order = ov::as_type_ptr<ov::opset1::Constant>(order_node);
+    if (!order || rank < 3)
+        return false;
+    const auto values = order->cast_vector<int64_t>();
+    if (values.size() != rank || values[0] != 0 || values[1] != static_cast<int64_t>(rank - 1))
+        return false;
+    for (size_t i = 2; i < rank; ++i) {
+        if (values[i] != static_cast<int64_t>(i - 1))
+            return false;
+    }
+    return true;
+}
+
+// Returns the per-channel values of the constant broadcasted to the [C] shape, or an empty vector
+// if the constant is not a scalar or a per-channel (along the last axis) tensor
+std::vector<float> get_per_channel_values(const std::shared_ptr<ov::opset1::Constant>& constant, size_t rank, size_t channels) {
+    const auto& shape = constant->get_shape();
+    if (shape.size() > rank)
+        return {};
+    const auto size = ov::shape_size(shape);
+    if (size != 1 && (size != channels || shape.back() != channels))
+        return {};
+    const auto values = constant->cast_vector<float>();
+    return size == 1 ? std::vector<float>(channels, values[0]) : values;
+}
+
+}   // namespace
+
+ov::intel_cpu::NormalizePreprocessFusion::NormalizePreprocessFusion() {
+    MATCHER_SCOPE(NormalizePreprocessFusion);
+    auto transpose_m = ov::pass::pattern::wrap_type<ov::opset1::Transpose>({ov::pass::pattern::any_input(ov::pass::pattern::has_static_rank()),
+                                                                            ov::pass::pattern::wrap_type<ov::opset1::Constant>()},
+                                                                           ov::pass::pattern::type_matches(ov::element::f32));
+
+    ov::matcher_pass_callback callback = [=](ov::pass::pattern::Matcher& m) {
+        const auto transpose = m.get_match_root();
+        const auto& data_shape = transpose->get_input_partial_shape(0);
+        const auto rank = data_shape.size();
+        if (!is_channels_last_to_first(transpose->get_input_node_shared_ptr(1), rank) || data_shape[rank - 1].is_dynamic())
+            return false;
+        const auto channels = static_cast<size_t>(data_shape[rank - 1].get_length());
+
+        // Walk up from the Transpose collecting the per-channel arithmetic, each node of the chain must feed only the next one
+        struct Step {
+            std::shared_ptr<ov::Node> node;
+            std::vector<float> values;
+            bool data_first;
+        };
+        std::vector<Step> steps;
+        ov::NodeVector fused;
+        auto data = transpose->input_value(0);
+        auto has_single_consumer = [](const ov::Output<ov::Node>& output) {
+            return output.get_target_inputs().size() == 1;
+        };
+        while (true) {
+            const auto node = data.get_node_shared_ptr();
+            if (!ov::is_type<ov::opset1::Add>(node) && !ov::is_type<ov::opset1::Subtract>(node) &&
+                !ov::is_type<ov::opset1::Multiply>(node) && !ov::is_type<ov::opset1::Divide>(node))
+                break;
+            if (!has_single_consumer(data) || node->get_output_element_type(0) != ov::element::f32 ||
+                node->get_output_partial_shape(0) != data_shape)
+                return false;
+            const bool data_first = !ov::is_type<ov::opset1::Constant>(node->get_input_node_ptr(0));
+            const auto constant = ov::as_type_ptr<ov::opset1::Constant>(node->get_input_node_shared_ptr(data_first ? 1 : 0));
+            if (!constant)
+                return false;
+            auto values = get_per_channel_values(constant, rank, channels);
+            if (values.empty())
+                return false;
+            // x / c is supported, c / x is not an affine transformation
+            if (ov::is_type<ov::opset1::Divide>(node) && !data_first)
+                return false;
+            steps.push_back({node, std::move(values), data_first});
+            fused.push_back(node);
+            data = node->input_value(data_first ? 0 : 1);
+        }
+
+        if (const auto convert = ov::as_type_ptr<ov::opset1::Convert>(data.get_node_shared_ptr())) {
+            const auto& src_type = convert->get_input_element_type(0);
+            if (!has_single_consumer(data) || convert->get_output_element_type(0) != ov::element::f32 ||
+                (src_type != ov::element::u8 && src_type != ov::element::i8))
+                return false;
+            fused.push_back(convert);
+            data = convert->input_value(0);
+        }
+
+        // Only the preprocessing at the model head is fused, a standalone Transpose is left to the graph optimizer
+        if (fused.empty() || !ov::is_type<ov::opset1::Parameter>(data.get_node_shared_ptr()))
+            return false;
+
+        // Compose the chain (applied from the Parameter to the Transpose) into out = in * scale + shift
+        std::vector<float> scale(channels, 1.f);
+        std::vector<float> shift(channels, 0.f);
+        for (auto it = steps.rbegin(); it != steps.rend(); ++it) {
+            const auto& values = it->values;
+            for (size_t c = 0; c < channels; ++c) {
+                if (ov::is_type<ov::opset1::Add>(it->node)) {
+                    shift[c] += values[c];
+                } else if (ov::is_type<ov::opset1::Subtract>(it->node)) {
+                    if (it->data_first) {
+                        shift[c] -= values[c];
+                    } else {
+                        scale[c] = -scale[c];
+                        shift[c] = values[c] - shift[c];
+                    }
+                } else if (ov::is_type<ov::opset1::Multiply>(it->node)) {
+                    scale[c] *= values[c];
+                    shift[c] *= values[c];
+                } else {
+                    scale[c] /= values[c];
+                    shift[c] /= values[c];
+                }
+            }
+        }
+
+        const auto scale_const = ov::opset1::Constant::create(ov::element::f32, ov::Shape{channels}, scale);
+        const auto shift_const = ov::opset1::Constant::create(ov::element::f32, ov::Shape{channels}, shift);
+        const auto preprocess = std::make_shared<ov::intel_cpu::NormalizePreprocessNode>(data, scale_const, shift_const);
+        preprocess->set_friendly_name(transpose->get_friendly_name());
+        fused.push_back(transpose);
+        ov::copy_runtime_info(fused, preprocess);
+        ov::replace_node(transpose, preprocess);
+        return true;
+    };
+
+    auto m = std::make_shared<ov::pass::pattern::Matcher>(transpose_m, matcher_name);
+    this->register_matcher(m, callback);
+}
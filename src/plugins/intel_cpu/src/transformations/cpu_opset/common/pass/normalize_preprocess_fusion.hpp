@@ -0,0 +1,24 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <openvino/pass/graph_rewrite.hpp>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * Fuses the preprocessing chain at the model head
+ *     Parameter -> [Convert] -> [per-channel Add/Subtract/Multiply/Divide]... -> Transpose (channels last -> channels first)
+ * into the single NormalizePreprocessNode, so the input image is processed in one pass.
+ */
+class NormalizePreprocessFusion: public ov::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("NormalizePreprocessFusion", "0");
+    NormalizePreprocessFusion();
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
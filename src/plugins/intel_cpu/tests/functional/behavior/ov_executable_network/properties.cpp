@@ -40,6 +40,8 @@ TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkSupportedPropertiesAreAvailable
         RO_property(ov::execution_devices.name()),
         RO_property(ov::intel_cpu::denormals_optimization.name()),
         RO_property(ov::intel_cpu::sparse_weights_decompression_rate.name()),
+        RO_property(ov::intel_cpu::transformations_profiling.name()),
+        RO_property(ov::intel_cpu::transformations_profile.name()),
     };
 
     ov::Core ie;
@@ -144,6 +146,21 @@ TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkCheckSparseWeigthsDecompression
     ASSERT_NO_THROW(ov::CompiledModel compiledModel = core.compile_model(model, deviceName));
 }
 
+TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkCheckTransformationsProfile) {
+    ov::Core core;
+
+    ov::CompiledModel compiledModel = core.compile_model(model, deviceName);
+    ov::pass::PassProfile profile;
+    ASSERT_NO_THROW(profile = compiledModel.get_property(ov::intel_cpu::transformations_profile));
+    ASSERT_TRUE(profile.children.empty());
+
+    compiledModel = core.compile_model(model, deviceName, ov::intel_cpu::transformations_profiling(true));
+    ASSERT_TRUE(compiledModel.get_property(ov::intel_cpu::transformations_profiling));
+    ASSERT_NO_THROW(profile = compiledModel.get_property(ov::intel_cpu::transformations_profile));
+    ASSERT_FALSE(profile.children.empty());
+    ASSERT_EQ(profile.runs, profile.children.size());
+}
+
 const auto bf16_if_can_be_emulated = InferenceEngine::with_cpu_x86_avx512_core() ? ov::element::bf16 : ov::element::f32;
 
 TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkCheckExecutionModeIsAvailableInCoreAndModel) {
@@ -83,6 +83,21 @@ INSTANTIATE_TEST_SUITE_P(smoke_Snippets_Eltwise, AddPair,
                                  ::testing::Values(ov::test::utils::DEVICE_CPU)),
                          AddPair::getTestCaseName);
 
+// the inputs and the output have equal shapes, so all the shapes are executed by the same kernels: the sizes are not
+// multiples of the kernel chunk, some of them are smaller than the chunk, and the shapes change and repeat
+std::vector<InputShape> inShapesShapeAgnostic{
+        {{-1, -1, -1, -1}, {{1, 1, 16, 16}, {1, 3, 10, 10}, {2, 5, 7, 3}, {1, 1, 1, 1}, {3, 1, 17, 19}, {1, 3, 10, 10}, {1, 2, 16, 16}}},
+};
+INSTANTIATE_TEST_SUITE_P(smoke_Snippets_Eltwise_ShapeAgnostic, Add,
+                         ::testing::Combine(
+                                 ::testing::ValuesIn(inShapesShapeAgnostic),
+                                 ::testing::ValuesIn(inShapesShapeAgnostic),
+                                 ::testing::Values(ov::element::f32),
+                                 ::testing::Values(1),
+                                 ::testing::Values(1), // Subgraph is created, since the inputs are followed by converts
+                                 ::testing::Values(ov::test::utils::DEVICE_CPU)),
+                         Add::getTestCaseName);
+
 // ===================================AddConst, AddRollConst=========================================================//
 std::vector<ov::test::InputShape> inShapesAddConst{{{}, {{1, 2, 3,  32}}},
                                                    {{}, {{1, 3, 17, 33}}},
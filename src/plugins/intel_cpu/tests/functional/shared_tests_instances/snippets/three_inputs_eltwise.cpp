@@ -30,6 +30,18 @@ INSTANTIATE_TEST_SUITE_P(smoke_Snippets_Eltwise_Dynamic, ThreeInputsEltwise,
                              ::testing::Values(1),
                              ::testing::Values(ov::test::utils::DEVICE_CPU)),
                          ThreeInputsEltwise::getTestCaseName);
+
+// the shapes of the inputs are equal, the sizes are not multiples of the kernel chunk
+const InputShape inShapeShapeAgnostic {{-1, -1, -1}, {{1, 10, 37}, {3, 16, 16}, {1, 1, 3}, {2, 9, 31}, {1, 10, 37}}};
+INSTANTIATE_TEST_SUITE_P(smoke_Snippets_Eltwise_ShapeAgnostic, ThreeInputsEltwise,
+                     ::testing::Combine(
+                             ::testing::Values(inShapeShapeAgnostic),
+                             ::testing::Values(inShapeShapeAgnostic),
+                             ::testing::Values(inShapeShapeAgnostic),
+                             ::testing::Values(1),
+                             ::testing::Values(1),
+                             ::testing::Values(ov::test::utils::DEVICE_CPU)),
+                         ThreeInputsEltwise::getTestCaseName);
 } // namespace
 } // namespace snippets
 } // namespace test
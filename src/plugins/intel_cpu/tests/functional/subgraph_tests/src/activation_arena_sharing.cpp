@@ -0,0 +1,116 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
+#include <common_test_utils/ov_tensor_utils.hpp>
+
+/*This test infers the following subgraph with the intermediate tensors placed in the activation arenas shared between
+the streams of the compiled model:
+
+        param
+          |
+     Convolution
+       /     \
+    Relu   Multiply
+      |       |
+ Convolution  |
+       \     /
+         Add
+          |
+        Result
+
+Several compiled models are created, and all their requests are inferred at the same time with different data, so the
+streams of a model lease different arenas from its pool, and the graphs get other arenas than the ones their tensors
+were placed in on the graph creation or the previous inference. The outputs are compared with the ones of the model
+compiled without the arena sharing.
+*/
+
+using namespace InferenceEngine;
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+
+using ActivationArenaSharingParams = bool;  // the parallel graph execution
+
+class ActivationArenaSharing : public testing::WithParamInterface<ActivationArenaSharingParams>,
+                               virtual public ov::test::SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<ActivationArenaSharingParams>& obj) {
+        std::ostringstream result;
+        result << "parallelGraphExecution=" << obj.param;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+
+        const auto precision = ov::element::f32;
+        auto param = std::make_shared<ov::op::v0::Parameter>(precision, ov::Shape{1, 8, 16, 16});
+        auto conv = ngraph::builder::makeConvolution(param, precision, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                                     ov::op::PadType::EXPLICIT, 16);
+        auto relu = std::make_shared<ov::op::v0::Relu>(conv);
+        auto conv2 = ngraph::builder::makeConvolution(relu, precision, {1, 1}, {1, 1}, {0, 0}, {0, 0}, {1, 1},
+                                                      ov::op::PadType::EXPLICIT, 16);
+        auto scale = ngraph::builder::makeConstant(precision, {1}, std::vector<float>{-0.5f});
+        auto multiply = std::make_shared<ov::op::v1::Multiply>(conv, scale);
+        auto add = std::make_shared<ov::op::v1::Add>(conv2, multiply);
+        function = std::make_shared<ov::Model>(ov::ResultVector{std::make_shared<ov::op::v0::Result>(add)},
+                                               ov::ParameterVector{param},
+                                               "ActivationArenaSharing");
+
+        configuration.insert(ov::num_streams(3));
+        configuration.insert({PluginConfigInternalParams::KEY_CPU_ACTIVATION_ARENA_SHARING, PluginConfigParams::YES});
+        configuration.insert({PluginConfigInternalParams::KEY_CPU_PARALLEL_GRAPH_EXECUTION,
+                              this->GetParam() ? PluginConfigParams::YES : PluginConfigParams::NO});
+    }
+};
+
+TEST_P(ActivationArenaSharing, ConcurrentModels) {
+    constexpr size_t modelsNum = 3;
+    constexpr size_t requestsPerModel = 5;
+    constexpr size_t rounds = 6;
+
+    std::vector<ov::CompiledModel> models;
+    std::vector<ov::InferRequest> requests;
+    for (size_t i = 0; i < modelsNum; i++) {
+        models.push_back(core->compile_model(function, targetDevice, configuration));
+        for (size_t j = 0; j < requestsPerModel; j++) {
+            requests.push_back(models.back().create_infer_request());
+        }
+    }
+    auto refModel = core->compile_model(function, targetDevice, ov::AnyMap{ov::num_streams(1)});
+    auto refRequest = refModel.create_infer_request();
+
+    for (size_t round = 0; round < rounds; round++) {
+        std::vector<ov::Tensor> inputs;
+        for (size_t i = 0; i < requests.size(); i++) {
+            inputs.push_back(ov::test::utils::create_and_fill_tensor(ov::element::f32, {1, 8, 16, 16}, 10, -5, 4,
+                                                                     static_cast<int>(round * requests.size() + i)));
+            requests[i].set_input_tensor(inputs.back());
+        }
+        // some rounds leave a part of the requests idle, so the graphs of the next rounds get the other arenas
+        const size_t active = round % 2 ? requests.size() / 2 : requests.size();
+        for (size_t i = 0; i < active; i++) {
+            requests[i].start_async();
+        }
+        for (size_t i = 0; i < active; i++) {
+            requests[i].wait();
+        }
+
+        for (size_t i = 0; i < active; i++) {
+            refRequest.set_input_tensor(inputs[i]);
+            refRequest.infer();
+            ov::test::utils::compare(refRequest.get_output_tensor(), requests[i].get_output_tensor(), 1e-5, 1e-5);
+        }
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_ActivationArenaSharing, ActivationArenaSharing,
+                         ::testing::Values(false, true),
+                         ActivationArenaSharing::getTestCaseName);
+
+} // namespace SubgraphTestsDefinitions
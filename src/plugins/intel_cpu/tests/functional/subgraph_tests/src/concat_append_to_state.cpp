@@ -0,0 +1,170 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
+#include "openvino/op/util/variable.hpp"
+
+/*This test runs the following subgraph with the dynamic state (the KV cache pattern):
+
+          Const [1, 0, 4]
+               |
+    param   ReadValue
+        \    /
+        Concat (axis 1)
+        /     \
+    Assign   Multiply (or Result)
+                |
+              Result
+
+The new data are appended to the state on each inference, so the length of the state grows by a different number
+of positions each time. When the Concat result is not the graph output, the data are appended to the current state
+buffer in place, otherwise the state is double buffered. The test checks the outputs and the state over several
+inferences, with the capacity of the state reserved up to the max length hint and grown beyond it, and after the
+state is reset or set by the user.
+*/
+
+using namespace InferenceEngine;
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+
+namespace {
+// the number of elements of the state at one position along the concatenation axis
+constexpr size_t positionSize = 4;
+}  // namespace
+
+using ConcatAppendToStateParams = std::tuple<bool,      // the Concat result is the graph output
+                                             size_t>;   // the max length hint of the state
+
+class ConcatAppendToState : public testing::WithParamInterface<ConcatAppendToStateParams>,
+                            virtual public ov::test::SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<ConcatAppendToStateParams>& obj) {
+        bool concatIsOutput;
+        size_t maxLengthHint;
+        std::tie(concatIsOutput, maxLengthHint) = obj.param;
+        std::ostringstream result;
+        result << "concatIsOutput=" << concatIsOutput << "_maxLengthHint=" << maxLengthHint;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        bool concatIsOutput;
+        size_t maxLengthHint;
+        std::tie(concatIsOutput, maxLengthHint) = this->GetParam();
+
+        const auto precision = ov::element::f32;
+        const ov::PartialShape shape{1, -1, positionSize};
+        auto param = std::make_shared<ov::op::v0::Parameter>(precision, shape);
+        auto variable = std::make_shared<ov::op::util::Variable>(ov::op::util::VariableInfo{shape, precision, "kv"});
+        auto init = ngraph::builder::makeConstant(precision, {1, 0, positionSize}, std::vector<float>{});
+        auto read = std::make_shared<ov::op::v6::ReadValue>(init, variable);
+        auto concat = std::make_shared<ov::op::v0::Concat>(ov::OutputVector{read, param}, 1);
+        auto assign = std::make_shared<ov::op::v6::Assign>(concat, variable);
+
+        std::shared_ptr<ov::Node> output = concat;
+        if (!concatIsOutput) {
+            auto scale = ngraph::builder::makeConstant(precision, {1}, std::vector<float>{2.0f});
+            output = std::make_shared<ov::op::v1::Multiply>(concat, scale);
+        }
+        expectedScale = concatIsOutput ? 1.0f : 2.0f;
+
+        function = std::make_shared<ov::Model>(ov::ResultVector{std::make_shared<ov::op::v0::Result>(output)},
+                                               ov::SinkVector{assign},
+                                               ov::ParameterVector{param},
+                                               "ConcatAppendToState");
+        if (maxLengthHint)
+            configuration.insert({PluginConfigInternalParams::KEY_CPU_STATE_MAX_LENGTH_HINT, std::to_string(maxLengthHint)});
+    }
+
+    // appends the given number of positions to the state and checks the output and the new state
+    void append(size_t length) {
+        const size_t step = ++steps;
+        ov::Tensor input(ov::element::f32, {1, length, positionSize});
+        auto inputData = input.data<float>();
+        for (size_t i = 0; i < input.get_size(); i++) {
+            inputData[i] = static_cast<float>(step * 1000 + i);
+        }
+        inferRequest.set_tensor(function->get_parameters().front(), input);
+        inferRequest.infer();
+
+        expected.insert(expected.end(), inputData, inputData + input.get_size());
+        const auto output = inferRequest.get_output_tensor(0);
+        ASSERT_EQ(output.get_shape(), ov::Shape({1, expected.size() / positionSize, positionSize}));
+        auto outputData = output.data<float>();
+        for (size_t i = 0; i < expected.size(); i++) {
+            ASSERT_EQ(outputData[i], expected[i] * expectedScale) << "step " << step << ", element " << i;
+        }
+        ASSERT_NO_FATAL_FAILURE(checkState());
+    }
+
+    void checkState() {
+        auto states = inferRequest.query_state();
+        ASSERT_EQ(states.size(), 1);
+        const auto state = states.front().get_state();
+        ASSERT_EQ(state.get_shape(), ov::Shape({1, expected.size() / positionSize, positionSize}));
+        auto stateData = state.data<float>();
+        for (size_t i = 0; i < expected.size(); i++) {
+            ASSERT_EQ(stateData[i], expected[i]) << "element " << i;
+        }
+    }
+
+    float expectedScale = 1.0f;
+    std::vector<float> expected;
+    size_t steps = 0;
+};
+
+TEST_P(ConcatAppendToState, CompareWithRefs) {
+    compile_model();
+    inferRequest = compiledModel.create_infer_request();
+
+    // the state is empty by default
+    ASSERT_NO_FATAL_FAILURE(checkState());
+
+    // the lengths vary and the total one exceeds the max length hint
+    for (size_t length : {3, 1, 1, 5, 2, 7, 1, 16}) {
+        ASSERT_NO_FATAL_FAILURE(append(length));
+    }
+
+    // the state is empty after the reset
+    inferRequest.query_state().front().reset();
+    expected.clear();
+    ASSERT_NO_FATAL_FAILURE(checkState());
+    for (size_t length : {2, 1, 9}) {
+        ASSERT_NO_FATAL_FAILURE(append(length));
+    }
+
+    // the state set by the user is continued
+    ov::Tensor newState(ov::element::f32, {1, 3, positionSize});
+    auto newStateData = newState.data<float>();
+    for (size_t i = 0; i < newState.get_size(); i++) {
+        newStateData[i] = -static_cast<float>(i);
+    }
+    inferRequest.query_state().front().set_state(newState);
+    expected.assign(newStateData, newStateData + newState.get_size());
+    ASSERT_NO_FATAL_FAILURE(checkState());
+    for (size_t length : {1, 4, 1, 12}) {
+        ASSERT_NO_FATAL_FAILURE(append(length));
+    }
+
+    // the state set by the user may be shorter than the current one
+    ov::Tensor shortState(ov::element::f32, {1, 1, positionSize});
+    std::fill_n(shortState.data<float>(), shortState.get_size(), 0.5f);
+    inferRequest.query_state().front().set_state(shortState);
+    expected.assign(positionSize, 0.5f);
+    for (size_t length : {2, 3}) {
+        ASSERT_NO_FATAL_FAILURE(append(length));
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_ConcatAppendToState, ConcatAppendToState,
+                         ::testing::Combine(::testing::Values(false, true),
+                                            ::testing::Values(0, 8)),
+                         ConcatAppendToState::getTestCaseName);
+
+} // namespace SubgraphTestsDefinitions
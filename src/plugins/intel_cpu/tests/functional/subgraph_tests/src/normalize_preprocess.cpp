@@ -0,0 +1,86 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <tuple>
+#include <string>
+#include <vector>
+#include <memory>
+#include <shared_test_classes/base/ov_subgraph.hpp>
+#include "common_test_utils/common_utils.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include <openvino/opsets/opset1.hpp>
+#include <openvino/core/preprocess/pre_post_process.hpp>
+
+using namespace CPUTestUtils;
+using namespace ov::test;
+
+namespace CPUSubgraphTestsDefinitions {
+
+typedef std::tuple<
+    InputShape,     // input tensor shape (channels last)
+    ElementType     // tensor element type
+> NormalizePreprocessTestParams;
+
+// Parameter (NHWC, u8/i8/f32) -> convert element type -> mean -> scale -> convert layout to NCHW -> Relu
+class NormalizePreprocessCPUTest : public testing::WithParamInterface<NormalizePreprocessTestParams>,
+                                   virtual public SubgraphBaseTest, public CPUTestsBase {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<NormalizePreprocessTestParams> &obj) {
+        InputShape input_shape;
+        ElementType tensor_et;
+        std::tie(input_shape, tensor_et) = obj.param;
+        std::ostringstream results;
+
+        results << "IS=" << ov::test::utils::partialShape2str({input_shape.first}) << "_TS=(";
+        for (const auto& item : input_shape.second) {
+            results << ov::test::utils::vec2str(item) << "_";
+        }
+        results << ")_tensor_prc=" << tensor_et;
+        return results.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        InputShape input_shape;
+        ElementType tensor_et;
+        std::tie(input_shape, tensor_et) = this->GetParam();
+        init_input_shapes({input_shape});
+
+        const auto& tensor_shape = inputDynamicShapes.front();
+        const ov::PartialShape model_shape{tensor_shape[0], tensor_shape[3], tensor_shape[1], tensor_shape[2]};
+        auto param = std::make_shared<ov::opset1::Parameter>(ElementType::f32, model_shape);
+        auto relu = std::make_shared<ov::opset1::Relu>(param);
+        function = std::make_shared<ov::Model>(relu, ov::ParameterVector{param}, "normalize_preprocess");
+
+        ov::preprocess::PrePostProcessor ppp(function);
+        ppp.input().tensor().set_element_type(tensor_et).set_layout("NHWC");
+        ppp.input().preprocess()
+            .convert_element_type(ElementType::f32)
+            .mean({123.675f, 116.28f, 103.53f})
+            .scale({58.395f, 57.12f, 57.375f});
+        ppp.input().model().set_layout("NCHW");
+        function = ppp.build();
+    }
+};
+
+TEST_P(NormalizePreprocessCPUTest, CompareWithRefs) {
+    run();
+    CheckNumberOfNodesWithType(compiledModel, "NormalizePreprocess", 1);
+}
+
+namespace {
+
+const std::vector<InputShape> inputShapes = {
+    InputShape{{1, 224, 224, 3}, {{1, 224, 224, 3}}},
+    InputShape{{2, 17, 31, 3}, {{2, 17, 31, 3}}},
+    InputShape{{-1, -1, -1, 3}, {{1, 32, 32, 3}, {2, 15, 7, 3}, {1, 32, 32, 3}}},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_NormalizePreprocess, NormalizePreprocessCPUTest,
+                        ::testing::Combine(::testing::ValuesIn(inputShapes),
+                                           ::testing::Values(ElementType::u8, ElementType::f32)),
+                        NormalizePreprocessCPUTest::getTestCaseName);
+} // namespace
+} // namespace CPUSubgraphTestsDefinitions
@@ -0,0 +1,107 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
+#include "openvino/op/util/variable.hpp"
+#include <common_test_utils/ov_tensor_utils.hpp>
+
+/*This test infers the following subgraph with the parallel graph execution, while the memory of the input, the output
+and the state edges is replaced between the inferences:
+
+     ReadValue    param
+        |   \    /  |  \
+        |    Add  Relu  Sigmoid
+        |   /  \   |      |
+     Assign    Concat   Result1
+                 |
+              Result0
+
+The branches are independent in the execution DAG as long as the edges don't share memory. The output tensors are set
+by the user at the adjacent places of one buffer, which move from one inference to another, the output of an inference
+is the input of the next one, and the state buffers are swapped by each inference, so the execution order must hold
+whatever memory the edges get at runtime. The outputs are compared with the ones of the model compiled without the
+parallel execution.
+*/
+
+using namespace InferenceEngine;
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+
+namespace {
+const ov::Shape inputShape{1, 4, 8, 8};
+const ov::Shape concatShape{1, 8, 8, 8};
+}  // namespace
+
+class ParallelExecutionReboundMemory : virtual public ov::test::SubgraphBaseTest {
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+
+        const auto precision = ov::element::f32;
+        auto param = std::make_shared<ov::op::v0::Parameter>(precision, inputShape);
+        auto variable = std::make_shared<ov::op::util::Variable>(ov::op::util::VariableInfo{inputShape, precision, "state"});
+        auto init = ngraph::builder::makeConstant(precision, inputShape, std::vector<float>(ov::shape_size(inputShape), 0.0f));
+        auto read = std::make_shared<ov::op::v6::ReadValue>(init, variable);
+        auto add = std::make_shared<ov::op::v1::Add>(read, param);
+        auto assign = std::make_shared<ov::op::v6::Assign>(add, variable);
+        auto relu = std::make_shared<ov::op::v0::Relu>(param);
+        auto concat = std::make_shared<ov::op::v0::Concat>(ov::OutputVector{add, relu}, 1);
+        auto sigmoid = std::make_shared<ov::op::v0::Sigmoid>(param);
+        function = std::make_shared<ov::Model>(ov::ResultVector{std::make_shared<ov::op::v0::Result>(concat),
+                                                                std::make_shared<ov::op::v0::Result>(sigmoid)},
+                                               ov::SinkVector{assign},
+                                               ov::ParameterVector{param},
+                                               "ParallelExecutionReboundMemory");
+
+        configuration.insert({PluginConfigInternalParams::KEY_CPU_PARALLEL_GRAPH_EXECUTION, PluginConfigParams::YES});
+    }
+};
+
+TEST_F(ParallelExecutionReboundMemory, UserTensors) {
+    constexpr size_t rounds = 7;
+    constexpr size_t slotsNum = 3;
+    const size_t inputSize = ov::shape_size(inputShape);
+    const size_t slotSize = ov::shape_size(concatShape) + inputSize;
+
+    auto compiledModel = core->compile_model(function, targetDevice, configuration);
+    auto request = compiledModel.create_infer_request();
+    auto refModel = core->compile_model(function, targetDevice,
+        ov::AnyMap{{PluginConfigInternalParams::KEY_CPU_PARALLEL_GRAPH_EXECUTION, PluginConfigParams::NO}});
+    auto refRequest = refModel.create_infer_request();
+
+    // the outputs of an inference are placed one after another in the slot of the inference, the input of the next
+    // inference is the sigmoid output of the previous slot
+    std::vector<float> buffer(slotsNum * slotSize);
+    ov::Tensor input(ov::element::f32, inputShape, buffer.data() + (slotsNum - 1) * slotSize + slotSize - inputSize);
+    ov::test::utils::create_and_fill_tensor(ov::element::f32, inputShape, 10, -5, 4, 1).copy_to(input);
+    for (size_t round = 0; round < rounds; round++) {
+        float* slot = buffer.data() + (round % slotsNum) * slotSize;
+        ov::Tensor concatOutput(ov::element::f32, concatShape, slot);
+        ov::Tensor sigmoidOutput(ov::element::f32, inputShape, slot + slotSize - inputSize);
+        request.set_input_tensor(input);
+        // the plugin tensors are used by the first inference, so the memory bound on the graph creation is replaced
+        if (round > 0) {
+            request.set_output_tensor(0, concatOutput);
+            request.set_output_tensor(1, sigmoidOutput);
+        }
+        request.infer();
+
+        refRequest.set_input_tensor(input);
+        refRequest.infer();
+        ov::test::utils::compare(refRequest.get_output_tensor(0), request.get_output_tensor(0), 1e-5, 1e-5);
+        ov::test::utils::compare(refRequest.get_output_tensor(1), request.get_output_tensor(1), 1e-5, 1e-5);
+
+        if (round > 0) {
+            input = sigmoidOutput;
+        } else {
+            input = ov::Tensor(ov::element::f32, inputShape, sigmoidOutput.data());
+            request.get_output_tensor(1).copy_to(input);
+        }
+    }
+}
+
+} // namespace SubgraphTestsDefinitions
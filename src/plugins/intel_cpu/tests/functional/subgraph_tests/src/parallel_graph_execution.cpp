@@ -0,0 +1,69 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
+
+/*This test runs the following subgraph in the parallel (dataflow) graph execution mode:
+
+                      param
+                        |
+                      Split
+                 /    |     |    \
+              Conv  Conv   Conv  Conv
+               |      |     |     |
+              Relu  Add   Relu   Add
+                 \    |     |    /
+                      Concat
+                        |
+                      Result
+
+The branches are independent, so they are dispatched to different threads. Intermediate tensors of
+the branches share the memory with each other (memory reuse) and convolutions use the common scratchpad,
+so the test checks that the dependencies of the execution DAG keep the results correct.
+*/
+
+using namespace InferenceEngine;
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+
+class ParallelGraphExecution : virtual public ov::test::SubgraphBaseTest {
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        const auto precision = ov::element::f32;
+        ov::test::InputShape input_shape{{}, {{1, 32, 16, 16}}};
+        init_input_shapes({input_shape});
+
+        ov::ParameterVector params;
+        for (auto&& shape : inputDynamicShapes) {
+            params.push_back(std::make_shared<ov::op::v0::Parameter>(precision, shape));
+        }
+        auto split = ngraph::builder::makeSplit(params.front(), precision, 4, 1);
+        auto add_const = ngraph::builder::makeConstant(precision, {1}, std::vector<float>({1.0f}));
+
+        ov::OutputVector branches;
+        for (size_t i = 0; i < split->get_output_size(); i++) {
+            auto conv = ngraph::builder::makeConvolution(split->output(i), precision, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                                         ov::op::PadType::EXPLICIT, 8, true);
+            auto act = i % 2 ? ngraph::builder::makeEltwise(conv, add_const, ngraph::helpers::EltwiseTypes::ADD)
+                             : ngraph::builder::makeActivation(conv, precision, ngraph::helpers::ActivationTypes::Relu);
+            branches.push_back(act);
+        }
+        auto concat = std::make_shared<ov::op::v0::Concat>(branches, 1);
+        ngraph::ResultVector results = {std::make_shared<ngraph::opset3::Result>(concat)};
+        function = std::make_shared<ov::Model>(results, params, "ParallelGraphExecution");
+
+        configuration.insert({PluginConfigInternalParams::KEY_CPU_PARALLEL_GRAPH_EXECUTION, PluginConfigParams::YES});
+    }
+};
+
+TEST_F(ParallelGraphExecution, smoke_CompareWithRefs) {
+    run();
+}
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,112 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
+#include <common_test_utils/ov_tensor_utils.hpp>
+
+/*This test infers the following subgraph in several streams at once with the runtime cache shared between the streams:
+
+    param [1, 8, ?, ?]
+        |
+    Convolution
+        |
+    Multiply (by scalar)
+        |
+      Relu
+        |
+     Result
+
+The convolution and the reorders to the plain layout of the output are shared between the streams, while the eltwise
+executor is cached by each stream. The requests of two compiled models are inferred concurrently with different
+shapes, so the executors are created and looked up by the streams at the same time, and the outputs are compared with
+the ones of the model compiled with the cache of each stream.
+*/
+
+using namespace InferenceEngine;
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+
+using RuntimeCacheSharingParams = std::string;  // the runtime cache sharing mode
+
+class RuntimeCacheSharing : public testing::WithParamInterface<RuntimeCacheSharingParams>,
+                            virtual public ov::test::SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<RuntimeCacheSharingParams>& obj) {
+        std::ostringstream result;
+        result << "sharing=" << obj.param;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+
+        const auto precision = ov::element::f32;
+        auto param = std::make_shared<ov::op::v0::Parameter>(precision, ov::PartialShape{1, 8, -1, -1});
+        auto conv = ngraph::builder::makeConvolution(param, precision, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                                     ov::op::PadType::EXPLICIT, 8);
+        auto scale = ngraph::builder::makeConstant(precision, {1}, std::vector<float>{0.5f});
+        auto multiply = std::make_shared<ov::op::v1::Multiply>(conv, scale);
+        auto relu = std::make_shared<ov::op::v0::Relu>(multiply);
+        function = std::make_shared<ov::Model>(ov::ResultVector{std::make_shared<ov::op::v0::Result>(relu)},
+                                               ov::ParameterVector{param},
+                                               "RuntimeCacheSharing");
+
+        configuration.insert(ov::num_streams(4));
+        configuration.insert({PluginConfigInternalParams::KEY_CPU_RUNTIME_CACHE_SHARING, this->GetParam()});
+    }
+};
+
+TEST_P(RuntimeCacheSharing, ConcurrentStreams) {
+    // the sizes differ from one request to another and change from one round to another
+    const std::vector<std::pair<size_t, size_t>> sizes = {{8, 8}, {13, 7}, {5, 21}, {16, 16}, {3, 3}, {13, 7}, {8, 8}};
+    constexpr size_t modelsNum = 2;
+    constexpr size_t requestsPerModel = 4;
+    constexpr size_t rounds = 6;
+
+    std::vector<ov::CompiledModel> models;
+    std::vector<ov::InferRequest> requests;
+    for (size_t i = 0; i < modelsNum; i++) {
+        models.push_back(core->compile_model(function, targetDevice, configuration));
+        for (size_t j = 0; j < requestsPerModel; j++) {
+            requests.push_back(models.back().create_infer_request());
+        }
+    }
+    auto refModel = core->compile_model(function, targetDevice, ov::AnyMap{ov::num_streams(1)});
+    auto refRequest = refModel.create_infer_request();
+
+    for (size_t round = 0; round < rounds; round++) {
+        std::vector<ov::Tensor> inputs;
+        for (size_t i = 0; i < requests.size(); i++) {
+            const auto& size = sizes[(round + i) % sizes.size()];
+            inputs.push_back(ov::test::utils::create_and_fill_tensor(ov::element::f32, {1, 8, size.first, size.second},
+                                                                     10, -5, 4, static_cast<int>(round * requests.size() + i)));
+            requests[i].set_input_tensor(inputs.back());
+        }
+        for (auto& request : requests) {
+            request.start_async();
+        }
+        for (auto& request : requests) {
+            request.wait();
+        }
+
+        for (size_t i = 0; i < requests.size(); i++) {
+            refRequest.set_input_tensor(inputs[i]);
+            refRequest.infer();
+            const auto expected = refRequest.get_output_tensor();
+            const auto actual = requests[i].get_output_tensor();
+            ASSERT_EQ(actual.get_shape(), expected.get_shape()) << "round " << round << ", request " << i;
+            ov::test::utils::compare(expected, actual, 1e-5, 1e-5);
+        }
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_RuntimeCacheSharing, RuntimeCacheSharing,
+                         ::testing::Values(PluginConfigInternalParams::PER_MODEL, PluginConfigInternalParams::PER_PLUGIN),
+                         RuntimeCacheSharing::getTestCaseName);
+
+} // namespace SubgraphTestsDefinitions
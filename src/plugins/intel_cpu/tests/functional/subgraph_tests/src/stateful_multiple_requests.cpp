@@ -0,0 +1,174 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "openvino/op/util/variable.hpp"
+
+/*This test runs several infer requests of one compiled model with the state:
+
+    ReadValue   param
+        |  \    /   |
+        |   Add     |
+        |  /   \    |
+    Assign   Result          (the state is copied)
+
+    ReadValue   param
+        |  \   /   \|
+        |   Add   Multiply
+        |    |      |
+        |  Assign  Result    (the state is read and written in place)
+
+The state buffers of each request are bound to the graph edges before the inference, so the requests inferred in turn
+must not see each other's state, a request created after the others have inferred must start from the initial state,
+and the requests must keep working after one of them is destroyed.
+*/
+
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+
+namespace {
+constexpr size_t stateSize = 16;
+}  // namespace
+
+using StatefulMultipleRequestsParams = bool;  // the state is written in place
+
+class StatefulMultipleRequests : public testing::WithParamInterface<StatefulMultipleRequestsParams>,
+                                 virtual public ov::test::SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<StatefulMultipleRequestsParams>& obj) {
+        std::ostringstream result;
+        result << "inPlace=" << obj.param;
+        return result.str();
+    }
+
+protected:
+    struct Request {
+        ov::InferRequest request;
+        std::vector<float> state;
+        size_t steps = 0;
+    };
+
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        inPlace = this->GetParam();
+
+        const auto precision = ov::element::f32;
+        const ov::Shape shape{1, stateSize};
+        auto param = std::make_shared<ov::op::v0::Parameter>(precision, shape);
+        auto variable = std::make_shared<ov::op::util::Variable>(ov::op::util::VariableInfo{shape, precision, "state"});
+        auto init = ngraph::builder::makeConstant(precision, shape, std::vector<float>(stateSize, 0.0f));
+        auto read = std::make_shared<ov::op::v6::ReadValue>(init, variable);
+        auto add = std::make_shared<ov::op::v1::Add>(read, param);
+        auto assign = std::make_shared<ov::op::v6::Assign>(add, variable);
+
+        std::shared_ptr<ov::Node> output = add;
+        if (inPlace)
+            output = std::make_shared<ov::op::v1::Multiply>(read, param);
+
+        function = std::make_shared<ov::Model>(ov::ResultVector{std::make_shared<ov::op::v0::Result>(output)},
+                                               ov::SinkVector{assign},
+                                               ov::ParameterVector{param},
+                                               "StatefulMultipleRequests");
+    }
+
+    void create(Request& request) {
+        request.request = compiledModel.create_infer_request();
+        request.state.assign(stateSize, 0.0f);
+        request.steps = 0;
+    }
+
+    // runs one inference of the request and checks the output and the new state against the ones of the request
+    void infer(Request& request, float seed) {
+        const size_t step = ++request.steps;
+        ov::Tensor input(ov::element::f32, {1, stateSize});
+        auto inputData = input.data<float>();
+        for (size_t i = 0; i < stateSize; i++) {
+            inputData[i] = seed + static_cast<float>(step + i);
+        }
+        request.request.set_tensor(function->get_parameters().front(), input);
+        request.request.infer();
+
+        auto outputData = request.request.get_output_tensor(0).data<float>();
+        for (size_t i = 0; i < stateSize; i++) {
+            const float expected = inPlace ? request.state[i] * inputData[i] : request.state[i] + inputData[i];
+            ASSERT_EQ(outputData[i], expected) << "step " << step << ", element " << i;
+            request.state[i] += inputData[i];
+        }
+        ASSERT_NO_FATAL_FAILURE(checkState(request));
+    }
+
+    void checkState(Request& request) {
+        auto states = request.request.query_state();
+        ASSERT_EQ(states.size(), 1);
+        const auto state = states.front().get_state();
+        ASSERT_EQ(state.get_shape(), ov::Shape({1, stateSize}));
+        auto stateData = state.data<float>();
+        for (size_t i = 0; i < stateSize; i++) {
+            ASSERT_EQ(stateData[i], request.state[i]) << "element " << i;
+        }
+    }
+
+    bool inPlace = false;
+};
+
+TEST_P(StatefulMultipleRequests, CompareWithRefs) {
+    compile_model();
+
+    Request first, third;
+    {
+        Request second;
+        create(first);
+        create(second);
+
+        // the requests inferred in turn keep their own states, the number of inferences is odd for one of them,
+        // so the buffers of the requests are swapped out of step
+        ASSERT_NO_FATAL_FAILURE(infer(first, 1.0f));
+        ASSERT_NO_FATAL_FAILURE(infer(second, -2.0f));
+        ASSERT_NO_FATAL_FAILURE(infer(first, 3.0f));
+        ASSERT_NO_FATAL_FAILURE(infer(first, 0.5f));
+        ASSERT_NO_FATAL_FAILURE(infer(second, 4.0f));
+        ASSERT_NO_FATAL_FAILURE(checkState(first));
+
+        // the request created after the others have inferred starts from the initial state
+        create(third);
+        ASSERT_NO_FATAL_FAILURE(checkState(third));
+        ASSERT_NO_FATAL_FAILURE(infer(third, 2.0f));
+        ASSERT_NO_FATAL_FAILURE(infer(second, 1.5f));
+
+        // the request inferred last is destroyed with its buffers bound to the graph
+    }
+
+    ASSERT_NO_FATAL_FAILURE(infer(first, -1.0f));
+    ASSERT_NO_FATAL_FAILURE(infer(third, 5.0f));
+
+    // the reset and the state set by the user affect the one request only
+    first.request.query_state().front().reset();
+    first.state.assign(stateSize, 0.0f);
+    ov::Tensor newState(ov::element::f32, {1, stateSize});
+    std::fill_n(newState.data<float>(), stateSize, 0.25f);
+    third.request.query_state().front().set_state(newState);
+    third.state.assign(stateSize, 0.25f);
+    ASSERT_NO_FATAL_FAILURE(infer(third, 1.0f));
+    ASSERT_NO_FATAL_FAILURE(infer(first, 2.0f));
+
+    // the last request created after one of the requests has gone starts from the initial state as well
+    {
+        Request fourth;
+        create(fourth);
+        ASSERT_NO_FATAL_FAILURE(checkState(fourth));
+        ASSERT_NO_FATAL_FAILURE(infer(fourth, 3.0f));
+        ASSERT_NO_FATAL_FAILURE(infer(first, -0.5f));
+        ASSERT_NO_FATAL_FAILURE(infer(fourth, 1.0f));
+    }
+    ASSERT_NO_FATAL_FAILURE(infer(third, 0.75f));
+    ASSERT_NO_FATAL_FAILURE(infer(first, 2.5f));
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_StatefulMultipleRequests, StatefulMultipleRequests,
+                         ::testing::Values(false, true),
+                         StatefulMultipleRequests::getTestCaseName);
+
+} // namespace SubgraphTestsDefinitions
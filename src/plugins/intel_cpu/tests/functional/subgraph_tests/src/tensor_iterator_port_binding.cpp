@@ -0,0 +1,186 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "ngraph_functions/builders.hpp"
+#include <common_test_utils/ov_tensor_utils.hpp>
+#include <cstring>
+
+/*This test runs the TensorIterator (or Loop) with the following body:
+
+    x (sliced)    h (back edge)
+         |    \  /    |
+         |     \/     |
+         |     /\     |
+         |    /  \    |
+        Add      Multiply
+         |          |
+    hn (back edge,  y (concatenated)
+        last value)
+
+The sliced input and the concatenated output are read and written by the body in place of the outer tensors, and
+the back edge swaps the buffers of hn and h between the iterations. With an even number of iterations the buffers stay
+swapped after the inference, so the model is inferred several times with different data.
+In the copy fallback case x is scaled by a Multiply which may be executed in place, so the body modifies its input
+and x is copied, and hn is concatenated as well, so it's copied to the outer tensor too.
+The dynamic case infers with different shapes, the back edge mappers are reused while the shape doesn't change.
+*/
+
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+
+using TensorIteratorPortBindingParams = std::tuple<std::vector<InputShape>,  // the x and the initial h shapes
+                                                   int64_t,                  // the slicing stride
+                                                   bool,                     // the copy fallback
+                                                   bool>;                    // Loop instead of TensorIterator
+
+class TensorIteratorPortBinding : public testing::WithParamInterface<TensorIteratorPortBindingParams>,
+                                  virtual public ov::test::SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<TensorIteratorPortBindingParams>& obj) {
+        std::vector<InputShape> shapes;
+        int64_t stride;
+        bool copyFallback, useLoop;
+        std::tie(shapes, stride, copyFallback, useLoop) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=" << ov::test::utils::partialShape2str({shapes[0].first}) << "_";
+        result << "TS=";
+        for (const auto& item : shapes[0].second) {
+            result << ov::test::utils::vec2str(item) << "_";
+        }
+        result << "stride=" << stride << "_copyFallback=" << copyFallback << "_" << (useLoop ? "Loop" : "TensorIterator");
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        std::vector<InputShape> shapes;
+        int64_t stride;
+        bool copyFallback, useLoop;
+        std::tie(shapes, stride, copyFallback, useLoop) = this->GetParam();
+        init_input_shapes(shapes);
+
+        const auto precision = ov::element::f32;
+        const int64_t axis = 1;
+        ov::ParameterVector params;
+        for (auto&& shape : inputDynamicShapes) {
+            params.push_back(std::make_shared<ov::op::v0::Parameter>(precision, shape));
+        }
+
+        auto bodyShape = inputDynamicShapes[0];
+        bodyShape[axis] = 1;
+        auto x = std::make_shared<ov::op::v0::Parameter>(precision, bodyShape);
+        auto h = std::make_shared<ov::op::v0::Parameter>(precision, inputDynamicShapes[1]);
+        ov::ParameterVector bodyParams{x, h};
+
+        std::shared_ptr<ov::Node> input = x;
+        if (copyFallback) {
+            auto scale = ngraph::builder::makeConstant(precision, {1}, std::vector<float>{0.5f});
+            input = std::make_shared<ov::op::v1::Multiply>(x, scale);
+        }
+        auto hn = std::make_shared<ov::op::v1::Add>(input, h);
+        auto y = std::make_shared<ov::op::v1::Multiply>(input, h);
+        ov::ResultVector bodyResults{std::make_shared<ov::op::v0::Result>(hn), std::make_shared<ov::op::v0::Result>(y)};
+
+        std::shared_ptr<ov::op::util::SubGraphOp> subGraph;
+        if (useLoop) {
+            const auto iterations = static_cast<int64_t>(targetStaticShapes.front()[0][axis]);
+            auto tripCount = ngraph::builder::makeConstant(ov::element::i64, {1}, std::vector<int64_t>{iterations});
+            auto execCondition = ov::op::v0::Constant::create(ov::element::boolean, {1}, {true});
+            auto bodyCondition = ov::op::v0::Constant::create(ov::element::boolean, {1}, {true});
+            bodyResults.push_back(std::make_shared<ov::op::v0::Result>(bodyCondition));
+            auto loop = std::make_shared<ov::op::v5::Loop>(tripCount, execCondition);
+            loop->set_function(std::make_shared<ov::Model>(bodyResults, bodyParams, "body"));
+            loop->set_special_body_ports({-1, 2});
+            subGraph = loop;
+        } else {
+            auto tensorIterator = std::make_shared<ov::op::v0::TensorIterator>();
+            tensorIterator->set_function(std::make_shared<ov::Model>(bodyResults, bodyParams, "body"));
+            subGraph = tensorIterator;
+        }
+
+        const int64_t start = stride > 0 ? 0 : -1;
+        const int64_t end = stride > 0 ? -1 : 0;
+        subGraph->set_sliced_input(x, params[0], start, stride, 1, end, axis);
+        subGraph->set_merged_input(h, params[1], bodyResults[0]);
+        ov::OutputVector outputs{subGraph->get_iter_value(bodyResults[0], -1),
+                                 subGraph->get_concatenated_slices(bodyResults[1], start, stride, 1, end, axis)};
+        if (copyFallback)
+            outputs.push_back(subGraph->get_concatenated_slices(bodyResults[0], start, stride, 1, end, axis));
+
+        function = std::make_shared<ov::Model>(outputs, params, "TensorIteratorPortBinding");
+    }
+
+    void generate_inputs(const std::vector<ov::Shape>& targetInputStaticShapes) override {
+        inputs.clear();
+        inputCopies.clear();
+        // the data differ from one inference to another
+        const int seed = static_cast<int>(++inferences);
+        const auto& funcInputs = function->inputs();
+        for (size_t i = 0; i < funcInputs.size(); ++i) {
+            auto tensor = ov::test::utils::create_and_fill_tensor(funcInputs[i].get_element_type(), targetInputStaticShapes[i],
+                                                                  10, -5, 4, seed);
+            ov::Tensor copy(tensor.get_element_type(), tensor.get_shape());
+            tensor.copy_to(copy);
+            inputs.insert({funcInputs[i].get_node_shared_ptr(), tensor});
+            inputCopies.push_back(copy);
+        }
+    }
+
+    void infer() override {
+        SubgraphBaseTest::infer();
+        // the body must not write to the outer input tensors it reads in place
+        const auto& funcInputs = function->inputs();
+        for (size_t i = 0; i < funcInputs.size(); ++i) {
+            const auto& tensor = inputs.at(funcInputs[i].get_node_shared_ptr());
+            ASSERT_EQ(std::memcmp(tensor.data(), inputCopies[i].data(), tensor.get_byte_size()), 0)
+                << "input " << i << " is modified by the inference " << inferences;
+        }
+    }
+
+    std::vector<ov::Tensor> inputCopies;
+    size_t inferences = 0;
+};
+
+TEST_P(TensorIteratorPortBinding, CompareWithRefs) {
+    run();
+}
+
+namespace {
+
+// the same static shapes are inferred several times
+const std::vector<std::vector<InputShape>> staticShapes = {
+    {{{}, {{1, 1, 8}, {1, 1, 8}}}, {{}, {{1, 1, 8}, {1, 1, 8}}}},
+    {{{}, {{1, 3, 8}, {1, 3, 8}, {1, 3, 8}}}, {{}, {{1, 1, 8}, {1, 1, 8}, {1, 1, 8}}}},
+    {{{}, {{1, 4, 8}, {1, 4, 8}, {1, 4, 8}}}, {{}, {{1, 1, 8}, {1, 1, 8}, {1, 1, 8}}}},
+    {{{}, {{1, 5, 3, 4}, {1, 5, 3, 4}, {1, 5, 3, 4}}}, {{}, {{1, 1, 3, 4}, {1, 1, 3, 4}, {1, 1, 3, 4}}}},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_TensorIteratorPortBinding_Static, TensorIteratorPortBinding,
+                         ::testing::Combine(::testing::ValuesIn(staticShapes),
+                                            ::testing::Values(1, -1),
+                                            ::testing::Values(false, true),
+                                            ::testing::Values(false, true)),
+                         TensorIteratorPortBinding::getTestCaseName);
+
+// the number of the iterations and the shape of the back edge change, then repeat
+const std::vector<std::vector<InputShape>> dynamicShapes = {
+    {
+        {{1, -1, -1}, {{1, 3, 8}, {1, 3, 8}, {1, 4, 8}, {1, 2, 5}, {1, 2, 5}, {1, 3, 8}}},
+        {{1, 1, -1}, {{1, 1, 8}, {1, 1, 8}, {1, 1, 8}, {1, 1, 5}, {1, 1, 5}, {1, 1, 8}}}
+    },
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_TensorIteratorPortBinding_Dynamic, TensorIteratorPortBinding,
+                         ::testing::Combine(::testing::ValuesIn(dynamicShapes),
+                                            ::testing::Values(1, -1),
+                                            ::testing::Values(false, true),
+                                            ::testing::Values(false)),
+                         TensorIteratorPortBinding::getTestCaseName);
+
+}  // namespace
+} // namespace SubgraphTestsDefinitions
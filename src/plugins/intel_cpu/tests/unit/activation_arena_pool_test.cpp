@@ -0,0 +1,52 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "activation_arena_pool.h"
+
+using namespace ov::intel_cpu;
+
+TEST(ActivationArenaPoolTest, ConcurrentLeasesGetDifferentArenas) {
+    ActivationArenaPool pool;
+    auto lease1 = pool.acquire(1024, nullptr);
+    auto lease2 = pool.acquire(1024, nullptr);
+    ASSERT_NE(nullptr, lease1.getData());
+    ASSERT_NE(nullptr, lease2.getData());
+    ASSERT_NE(lease1.getData(), lease2.getData());
+    ASSERT_EQ(2u, pool.getArenasNum());
+}
+
+TEST(ActivationArenaPoolTest, ReleasedArenaIsReused) {
+    ActivationArenaPool pool;
+    void* data = nullptr;
+    {
+        auto lease = pool.acquire(1024, nullptr);
+        data = lease.getData();
+    }
+    auto lease = pool.acquire(512, nullptr);
+    ASSERT_EQ(data, lease.getData());
+    ASSERT_EQ(1u, pool.getArenasNum());
+    ASSERT_EQ(1024u, pool.getTotalSize());
+}
+
+TEST(ActivationArenaPoolTest, PreferredArenaIsReturned) {
+    ActivationArenaPool pool;
+    auto lease1 = pool.acquire(1024, nullptr);
+    auto lease2 = pool.acquire(1024, nullptr);
+    void* preferred = lease2.getData();
+    lease1.release();
+    lease2.release();
+    auto lease = pool.acquire(1024, preferred);
+    ASSERT_EQ(preferred, lease.getData());
+}
+
+TEST(ActivationArenaPoolTest, ArenaGrows) {
+    ActivationArenaPool pool;
+    pool.acquire(256, nullptr);
+    auto lease = pool.acquire(4096, nullptr);
+    ASSERT_NE(nullptr, lease.getData());
+    ASSERT_EQ(1u, pool.getArenasNum());
+    ASSERT_EQ(4096u, pool.getTotalSize());
+}
@@ -77,3 +77,30 @@ TEST(MemoryTest, ConcurrentResizeGetPrimitive) {
         ASSERT_EQ(dnnl_mem.get_data_handle(), cpu_mem2.getData());
     }
 }
+
+TEST(MemoryTest, GrowingMemoryMngrKeepsData) {
+    dnnl::engine eng(dnnl::engine::kind::cpu, 0);
+    std::unique_ptr<MemoryMngrWithGrowth> mngr(new MemoryMngrWithGrowth());
+    auto mngrPtr = mngr.get();
+    auto desc = std::make_shared<CpuBlockedMemoryDesc>(Precision::FP32, Shape{1, 4, 2});
+    Memory cpu_mem(eng, desc, std::make_shared<DnnlMemoryMngr>(std::move(mngr)));
+    ASSERT_EQ(mngrPtr->getCapacity(), cpu_mem.getSize());
+
+    auto data = static_cast<float*>(cpu_mem.getData());
+    for (size_t i = 0; i < 8; i++)
+        data[i] = static_cast<float>(i);
+
+    // the capacity grows geometrically and the data are kept on reallocation
+    cpu_mem.redefineDesc(desc->cloneWithNewDims({1, 5, 2}, true));
+    const auto capacity = mngrPtr->getCapacity();
+    ASSERT_EQ(capacity, 2 * 8 * sizeof(float));
+    data = static_cast<float*>(cpu_mem.getData());
+    for (size_t i = 0; i < 8; i++)
+        ASSERT_EQ(data[i], static_cast<float>(i));
+    ASSERT_EQ(cpu_mem.getPrimitive().get_data_handle(), cpu_mem.getData());
+
+    // no reallocation within the capacity
+    cpu_mem.redefineDesc(desc->cloneWithNewDims({1, 8, 2}, true));
+    ASSERT_EQ(mngrPtr->getCapacity(), capacity);
+    ASSERT_EQ(static_cast<float*>(cpu_mem.getData()), data);
+}
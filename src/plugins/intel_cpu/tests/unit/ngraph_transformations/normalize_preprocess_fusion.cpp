@@ -0,0 +1,91 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "common_test_utils/ov_test_utils.hpp"
+#include <transformations/cpu_opset/common/pass/normalize_preprocess_fusion.hpp>
+#include <transformations/cpu_opset/common/op/normalize_preprocess.hpp>
+
+#include "openvino/opsets/opset1.hpp"
+
+using namespace testing;
+
+class NormalizePreprocessFusionTest: public TransformationTestsF {
+public:
+    NormalizePreprocessFusionTest() : TransformationTestsF() {
+        comparator.enable(FunctionsComparator::CmpValues::CONST_VALUES);
+    }
+};
+
+TEST_F(NormalizePreprocessFusionTest, ConvertMeanScaleTranspose) {
+    const ov::Shape shape{1, 224, 224, 3};
+    {
+        auto input = std::make_shared<ov::opset1::Parameter>(ov::element::u8, shape);
+        auto convert = std::make_shared<ov::opset1::Convert>(input, ov::element::f32);
+        auto mean = ov::opset1::Constant::create(ov::element::f32, ov::Shape{1, 1, 1, 3}, {1.f, 2.f, 3.f});
+        auto subtract = std::make_shared<ov::opset1::Subtract>(convert, mean);
+        auto scale = ov::opset1::Constant::create(ov::element::f32, ov::Shape{1, 1, 1, 3}, {2.f, 4.f, 8.f});
+        auto divide = std::make_shared<ov::opset1::Divide>(subtract, scale);
+        auto order = ov::opset1::Constant::create(ov::element::i64, ov::Shape{4}, {0, 3, 1, 2});
+        auto transpose = std::make_shared<ov::opset1::Transpose>(divide, order);
+
+        model = std::make_shared<ov::Model>(ov::NodeVector{transpose}, ov::ParameterVector{input});
+        manager.register_pass<ov::intel_cpu::NormalizePreprocessFusion>();
+    }
+    {
+        auto input = std::make_shared<ov::opset1::Parameter>(ov::element::u8, shape);
+        auto scale = ov::opset1::Constant::create(ov::element::f32, ov::Shape{3}, {0.5f, 0.25f, 0.125f});
+        auto shift = ov::opset1::Constant::create(ov::element::f32, ov::Shape{3}, {-0.5f, -0.5f, -0.375f});
+        auto preprocess = std::make_shared<ov::intel_cpu::NormalizePreprocessNode>(input, scale, shift);
+
+        model_ref = std::make_shared<ov::Model>(ov::NodeVector{preprocess}, ov::ParameterVector{input});
+    }
+}
+
+TEST_F(NormalizePreprocessFusionTest, ScalarScaleTranspose) {
+    const ov::Shape shape{2, 16, 16, 4};
+    {
+        auto input = std::make_shared<ov::opset1::Parameter>(ov::element::f32, shape);
+        auto scale = ov::opset1::Constant::create(ov::element::f32, ov::Shape{}, {2.f});
+        auto multiply = std::make_shared<ov::opset1::Multiply>(scale, input);
+        auto order = ov::opset1::Constant::create(ov::element::i64, ov::Shape{4}, {0, 3, 1, 2});
+        auto transpose = std::make_shared<ov::opset1::Transpose>(multiply, order);
+
+        model = std::make_shared<ov::Model>(ov::NodeVector{transpose}, ov::ParameterVector{input});
+        manager.register_pass<ov::intel_cpu::NormalizePreprocessFusion>();
+    }
+    {
+        auto input = std::make_shared<ov::opset1::Parameter>(ov::element::f32, shape);
+        auto scale = ov::opset1::Constant::create(ov::element::f32, ov::Shape{4}, {2.f, 2.f, 2.f, 2.f});
+        auto shift = ov::opset1::Constant::create(ov::element::f32, ov::Shape{4}, {0.f, 0.f, 0.f, 0.f});
+        auto preprocess = std::make_shared<ov::intel_cpu::NormalizePreprocessNode>(input, scale, shift);
+
+        model_ref = std::make_shared<ov::Model>(ov::NodeVector{preprocess}, ov::ParameterVector{input});
+    }
+}
+
+TEST_F(NormalizePreprocessFusionTest, NotFusedWithSharedConvert) {
+    const ov::Shape shape{1, 224, 224, 3};
+    auto input = std::make_shared<ov::opset1::Parameter>(ov::element::u8, shape);
+    auto convert = std::make_shared<ov::opset1::Convert>(input, ov::element::f32);
+    auto mean = ov::opset1::Constant::create(ov::element::f32, ov::Shape{1, 1, 1, 3}, {1.f, 2.f, 3.f});
+    auto subtract = std::make_shared<ov::opset1::Subtract>(convert, mean);
+    auto order = ov::opset1::Constant::create(ov::element::i64, ov::Shape{4}, {0, 3, 1, 2});
+    auto transpose = std::make_shared<ov::opset1::Transpose>(subtract, order);
+
+    model = std::make_shared<ov::Model>(ov::NodeVector{transpose, convert}, ov::ParameterVector{input});
+    manager.register_pass<ov::intel_cpu::NormalizePreprocessFusion>();
+}
+
+TEST_F(NormalizePreprocessFusionTest, NotFusedWithWrongOrder) {
+    const ov::Shape shape{1, 3, 224, 224};
+    auto input = std::make_shared<ov::opset1::Parameter>(ov::element::u8, shape);
+    auto convert = std::make_shared<ov::opset1::Convert>(input, ov::element::f32);
+    auto order = ov::opset1::Constant::create(ov::element::i64, ov::Shape{4}, {0, 2, 3, 1});
+    auto transpose = std::make_shared<ov::opset1::Transpose>(convert, order);
+
+    model = std::make_shared<ov::Model>(ov::NodeVector{transpose}, ov::ParameterVector{input});
+    manager.register_pass<ov::intel_cpu::NormalizePreprocessFusion>();
+}
@@ -0,0 +1,114 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <vector>
+
+#include "graph_context.h"
+#include "ngraph/runtime/shared_buffer.hpp"
+#include "nodes/input.h"
+#include "openvino/op/constant.hpp"
+#include "openvino/util/mmap_object.hpp"
+
+using namespace ov::intel_cpu;
+
+namespace {
+
+constexpr size_t weightsSize = 4 * 16;
+
+// the memory of a model file mapped on the model reading
+class TestMappedMemory : public ov::MappedMemory {
+public:
+    explicit TestMappedMemory(size_t size) : m_data(size) {}
+    char* data() noexcept override {
+        return m_data.data();
+    }
+    size_t size() const noexcept override {
+        return m_data.size();
+    }
+
+private:
+    std::vector<char> m_data;
+};
+
+void fillWeights(float* data) {
+    for (size_t i = 0; i < weightsSize; i++)
+        data[i] = static_cast<float>(i) - 8.0f;
+}
+
+std::shared_ptr<ov::op::v0::Constant> makeWeights() {
+    std::vector<float> values(weightsSize);
+    fillWeights(values.data());
+    return std::make_shared<ov::op::v0::Constant>(ov::element::f32, ov::Shape{4, 16}, values);
+}
+
+OPENVINO_SUPPRESS_DEPRECATED_START
+// the constant shares the weights file mapped by the IR frontend with ov::enable_mmap
+std::shared_ptr<ov::op::v0::Constant> makeMappedWeights() {
+    using SharedMappedMemory = ngraph::runtime::SharedBuffer<std::shared_ptr<ov::MappedMemory>>;
+    using SharedAlignedBuffer = ngraph::runtime::SharedBuffer<std::shared_ptr<ngraph::runtime::AlignedBuffer>>;
+
+    const size_t offset = 64;
+    std::shared_ptr<ov::MappedMemory> file = std::make_shared<TestMappedMemory>(offset + weightsSize * sizeof(float));
+    auto weights = std::make_shared<SharedMappedMemory>(file->data(), file->size(), file);
+    char* data = weights->get_ptr<char>() + offset;
+    fillWeights(reinterpret_cast<float*>(data));
+    auto buffer = std::make_shared<SharedAlignedBuffer>(data, weightsSize * sizeof(float), weights);
+    return std::make_shared<ov::op::v0::Constant>(ov::element::f32, ov::Shape{4, 16}, buffer);
+}
+OPENVINO_SUPPRESS_DEPRECATED_END
+
+std::shared_ptr<node::Input> constantInput(const std::shared_ptr<ov::op::v0::Constant>& constOp,
+                                           bool weightsCache,
+                                           bool constantsInPlace) {
+    Config conf;
+    conf.constantsInPlace = constantsInPlace;
+    auto context = std::make_shared<GraphContext>(conf,
+                                                  nullptr,
+                                                  weightsCache ? std::make_shared<WeightsSharing>() : nullptr,
+                                                  false);
+    return std::make_shared<node::Input>(constOp, context);
+}
+
+}  // namespace
+
+TEST(InputNodeTest, ConstantInPlaceWithoutWeightsCache) {
+    auto constOp = makeWeights();
+    // the constants are used in place regardless of the sockets when there is no weights cache
+    for (bool constantsInPlace : {true, false}) {
+        auto input = constantInput(constOp, false, constantsInPlace);
+        ASSERT_EQ(input->getMemoryPtr()->getData(), constOp->get_data_ptr());
+        ASSERT_FALSE(input->isMappedConstant());
+    }
+}
+
+TEST(InputNodeTest, ConstantInPlaceWithWeightsCache) {
+    auto constOp = makeWeights();
+    // a single socket
+    auto input = constantInput(constOp, true, true);
+    ASSERT_EQ(input->getMemoryPtr()->getData(), constOp->get_data_ptr());
+}
+
+TEST(InputNodeTest, ConstantCopiedPerSocket) {
+    auto constOp = makeWeights();
+    // the weights cache of each socket keeps its own copy of the constant
+    auto input = constantInput(constOp, true, false);
+    auto memory = input->getMemoryPtr();
+    ASSERT_NE(memory->getData(), constOp->get_data_ptr());
+    ASSERT_EQ(memory->getSize(), constOp->get_byte_size());
+    ASSERT_EQ(std::memcmp(memory->getData(), constOp->get_data_ptr(), constOp->get_byte_size()), 0);
+    ASSERT_FALSE(input->isMappedConstant());
+}
+
+TEST(InputNodeTest, MappedConstantInPlacePerSocket) {
+    auto constOp = makeMappedWeights();
+    // the mapped weights stay in the file pages instead of the per socket copies
+    for (bool weightsCache : {true, false}) {
+        auto input = constantInput(constOp, weightsCache, false);
+        ASSERT_EQ(input->getMemoryPtr()->getData(), constOp->get_data_ptr());
+        ASSERT_TRUE(input->isMappedConstant());
+    }
+}
@@ -0,0 +1,256 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+#include <ie_system_conf.h>
+#include "nodes/common/nms_kernel.hpp"
+
+namespace ov {
+namespace intel_cpu {
+// the kernels compiled for each ISA by cross_compiled_file(), declared in the same way as the generated dispatcher does
+namespace ANY {
+float nms_max_iou(const NmsBoxes& boxes, size_t idx, const NmsBoxes& others, size_t begin, size_t end,
+                  const NmsIouConfig& config, float stop_iou, float* ious);
+size_t nms_filter_scores(const float* scores, size_t num, float threshold, bool inclusive, int* indices);
+}  // namespace ANY
+#if defined(HAVE_AVX2)
+namespace AVX2 {
+float nms_max_iou(const NmsBoxes& boxes, size_t idx, const NmsBoxes& others, size_t begin, size_t end,
+                  const NmsIouConfig& config, float stop_iou, float* ious);
+size_t nms_filter_scores(const float* scores, size_t num, float threshold, bool inclusive, int* indices);
+}  // namespace AVX2
+#endif
+#if defined(HAVE_AVX512F)
+namespace AVX512F {
+float nms_max_iou(const NmsBoxes& boxes, size_t idx, const NmsBoxes& others, size_t begin, size_t end,
+                  const NmsIouConfig& config, float stop_iou, float* ious);
+size_t nms_filter_scores(const float* scores, size_t num, float threshold, bool inclusive, int* indices);
+}  // namespace AVX512F
+#endif
+}  // namespace intel_cpu
+}  // namespace ov
+
+using namespace ov::intel_cpu;
+
+namespace {
+
+NmsBoxes generateBoxes(size_t num, float offset, unsigned seed) {
+    std::mt19937 gen(seed);
+    std::uniform_real_distribution<float> coord(0.f, 10.f);
+    std::uniform_real_distribution<float> side(-1.f, 4.f);
+    NmsBoxes boxes;
+    for (size_t i = 0; i < num; i++) {
+        const float ymin = coord(gen), xmin = coord(gen), height = side(gen), width = side(gen);
+        boxes.push_back(ymin, xmin, ymin + height, xmin + width, (height + offset) * (width + offset));
+    }
+    return boxes;
+}
+
+float refIou(const NmsBoxes& boxes, size_t i, size_t j, const NmsIouConfig& config) {
+    float height = std::min(boxes.ymax[i], boxes.ymax[j]) - std::max(boxes.ymin[i], boxes.ymin[j]) + config.offset;
+    float width = std::min(boxes.xmax[i], boxes.xmax[j]) - std::max(boxes.xmin[i], boxes.xmin[j]) + config.offset;
+    if (config.overlap_only) {
+        if (boxes.xmin[j] > boxes.xmax[i] || boxes.xmax[j] < boxes.xmin[i] ||
+            boxes.ymin[j] > boxes.ymax[i] || boxes.ymax[j] < boxes.ymin[i])
+            return 0.f;
+    } else {
+        if (boxes.area[i] <= 0.f || boxes.area[j] <= 0.f)
+            return 0.f;
+        height = std::max(height, 0.f);
+        width = std::max(width, 0.f);
+    }
+    const float intersection = height * width;
+    return intersection / (boxes.area[i] + boxes.area[j] - intersection);
+}
+
+std::vector<size_t> refGreedy(const NmsBoxes& boxes, const NmsIouConfig& config, float threshold, float eta, size_t max_selected) {
+    std::vector<size_t> selected;
+    for (size_t i = 0; i < boxes.size() && selected.size() < max_selected; i++) {
+        bool suppressed = false;
+        for (auto j : selected)
+            suppressed = suppressed || refIou(boxes, i, j, config) >= threshold;
+        if (suppressed)
+            continue;
+        selected.push_back(i);
+        if (eta < 1.f && threshold > 0.5f)
+            threshold *= eta;
+    }
+    return selected;
+}
+
+struct IsaKernels {
+    std::string name;
+    decltype(&ANY::nms_max_iou) max_iou;
+    decltype(&ANY::nms_filter_scores) filter_scores;
+};
+
+// the vectorized kernels supported by the build and by the CPU, they are compared with the ANY (scalar) ones
+std::vector<IsaKernels> vectorKernels() {
+    std::vector<IsaKernels> kernels;
+#if defined(HAVE_AVX2)
+    if (InferenceEngine::with_cpu_x86_avx2())
+        kernels.push_back({"AVX2", AVX2::nms_max_iou, AVX2::nms_filter_scores});
+#endif
+#if defined(HAVE_AVX512F)
+    if (InferenceEngine::with_cpu_x86_avx512f())
+        kernels.push_back({"AVX512F", AVX512F::nms_max_iou, AVX512F::nms_filter_scores});
+#endif
+    return kernels;
+}
+
+// the vector code runs the same operations as the scalar one, so the results match bitwise, NaN payloads aside
+void expectBitExact(float expected, float actual, const std::string& name) {
+    uint32_t expected_bits, actual_bits;
+    std::memcpy(&expected_bits, &expected, sizeof(float));
+    std::memcpy(&actual_bits, &actual, sizeof(float));
+    if (std::isnan(expected)) {
+        ASSERT_TRUE(std::isnan(actual)) << name << ": " << actual << " instead of NaN";
+    } else {
+        ASSERT_EQ(expected_bits, actual_bits) << name << ": " << actual << " instead of " << expected;
+    }
+}
+
+// some of the coordinates of the boxes are NaN
+NmsBoxes generateBoxesWithNaN(size_t num, float offset, unsigned seed) {
+    const float nan = std::numeric_limits<float>::quiet_NaN();
+    auto boxes = generateBoxes(num, offset, seed);
+    for (size_t i = 5; i < num; i += 11) {
+        std::vector<float>* coords[] = {&boxes.ymin, &boxes.xmin, &boxes.ymax, &boxes.xmax, &boxes.area};
+        (*coords[i % 5])[i] = nan;
+    }
+    return boxes;
+}
+
+}  // namespace
+
+TEST(NmsKernelTest, iou_matches_reference) {
+    const float inf = std::numeric_limits<float>::infinity();
+    for (const auto& config : {NmsIouConfig{0.f, false}, NmsIouConfig{1.f, false}, NmsIouConfig{0.f, true}, NmsIouConfig{1.f, true}}) {
+        const auto boxes = generateBoxes(203, config.offset, 1);
+        std::vector<float> ious(boxes.size());
+        for (size_t i = 1; i < boxes.size(); i++) {
+            const float max_iou = XARCH::nms_max_iou(boxes, i, boxes, 0, i, config, inf, ious.data());
+            float ref_max_iou = -inf;
+            for (size_t j = 0; j < i; j++) {
+                const float ref = refIou(boxes, i, j, config);
+                ASSERT_NEAR(ref, ious[j], 1e-6f) << "box " << i << " with " << j;
+                ref_max_iou = std::max(ref_max_iou, ref);
+            }
+            ASSERT_NEAR(ref_max_iou, max_iou, 1e-6f);
+        }
+    }
+}
+
+TEST(NmsKernelTest, iou_early_exit) {
+    const NmsIouConfig config{0.f, false};
+    NmsBoxes box;
+    box.push_back(1.f, 1.f, 3.f, 3.f, 4.f);
+    auto boxes = generateBoxes(100, config.offset, 2);
+    boxes.push_back(box, 0);
+    ASSERT_GE(XARCH::nms_max_iou(box, 0, boxes, 0, boxes.size(), config, 0.5f, nullptr), 0.5f);
+    ASSERT_EQ(-std::numeric_limits<float>::infinity(), XARCH::nms_max_iou(box, 0, boxes, 0, 0, config, 0.5f, nullptr));
+}
+
+TEST(NmsKernelTest, filter_scores) {
+    std::mt19937 gen(3);
+    std::uniform_int_distribution<int> dist(0, 9);
+    std::vector<float> scores(1003);
+    for (auto& score : scores)
+        score = static_cast<float>(dist(gen));
+
+    for (bool inclusive : {false, true}) {
+        std::vector<int> ref;
+        for (size_t i = 0; i < scores.size(); i++) {
+            if (inclusive ? scores[i] >= 5.f : scores[i] > 5.f)
+                ref.push_back(static_cast<int>(i));
+        }
+        std::vector<int> indices(scores.size());
+        indices.resize(XARCH::nms_filter_scores(scores.data(), scores.size(), 5.f, inclusive, indices.data()));
+        ASSERT_EQ(ref, indices);
+    }
+}
+
+TEST(NmsKernelTest, greedy_matches_reference) {
+    const NmsIouConfig config{0.f, false};
+    const auto boxes = generateBoxes(2000, config.offset, 4);
+    for (float eta : {1.f, 0.9f}) {
+        for (size_t max_selected : {size_t(10), boxes.size()}) {
+            const auto ref = refGreedy(boxes, config, 0.7f, eta, max_selected);
+            ASSERT_EQ(ref, nms_greedy(boxes, config, 0.7f, eta, max_selected, false));
+            ASSERT_EQ(ref, nms_greedy(boxes, config, 0.7f, eta, max_selected, true));
+        }
+    }
+}
+
+TEST(NmsKernelTest, iou_of_each_isa_matches_scalar) {
+    const auto kernels = vectorKernels();
+    if (kernels.empty())
+        GTEST_SKIP() << "No vectorized NMS kernels for this CPU";
+
+    const float inf = std::numeric_limits<float>::infinity();
+    for (const auto& config : {NmsIouConfig{0.f, false}, NmsIouConfig{1.f, false}, NmsIouConfig{0.f, true}, NmsIouConfig{1.f, true}}) {
+        for (bool with_nan : {false, true}) {
+            const auto boxes = with_nan ? generateBoxesWithNaN(203, config.offset, 5) : generateBoxes(203, config.offset, 5);
+            std::vector<float> ref_ious(boxes.size());
+            std::vector<float> ious(boxes.size());
+            for (size_t i = 0; i < boxes.size(); i++) {
+                // the ranges start at different offsets, so the vector tails differ as well
+                const size_t begin = i % 7;
+                const float ref_max_iou = ANY::nms_max_iou(boxes, i, boxes, begin, boxes.size(), config, inf, ref_ious.data());
+                for (const auto& isa : kernels) {
+                    const std::string name = isa.name + " box " + std::to_string(i) + (with_nan ? " with NaN" : "");
+                    const float max_iou = isa.max_iou(boxes, i, boxes, begin, boxes.size(), config, inf, ious.data());
+                    expectBitExact(ref_max_iou, max_iou, name);
+                    for (size_t j = 0; j < boxes.size() - begin; j++)
+                        expectBitExact(ref_ious[j], ious[j], name + " with " + std::to_string(begin + j));
+                    // the stop decision is the same, even though the maximum is exact only below stop_iou
+                    for (float stop_iou : {0.3f, 0.5f}) {
+                        const bool ref_stopped = ANY::nms_max_iou(boxes, i, boxes, begin, boxes.size(), config, stop_iou, nullptr) >= stop_iou;
+                        const bool stopped = isa.max_iou(boxes, i, boxes, begin, boxes.size(), config, stop_iou, nullptr) >= stop_iou;
+                        ASSERT_EQ(ref_stopped, stopped) << name << " stopped at " << stop_iou;
+                    }
+                }
+            }
+        }
+    }
+}
+
+TEST(NmsKernelTest, filter_scores_of_each_isa_matches_scalar) {
+    const auto kernels = vectorKernels();
+    if (kernels.empty())
+        GTEST_SKIP() << "No vectorized NMS kernels for this CPU";
+
+    const float threshold = 0.5f;
+    std::mt19937 gen(6);
+    std::uniform_int_distribution<int> dist(0, 3);
+    std::vector<float> scores(1003);
+    for (size_t i = 0; i < scores.size(); i++) {
+        // a quarter of the scores is exactly at the threshold, some of them are NaN
+        scores[i] = 0.25f * static_cast<float>(dist(gen)) + 0.25f;
+        if (i % 13 == 0)
+            scores[i] = std::numeric_limits<float>::quiet_NaN();
+    }
+
+    for (size_t num : {scores.size(), size_t(7), size_t(16), size_t(0)}) {
+        for (bool inclusive : {false, true}) {
+            std::vector<int> ref(num);
+            ref.resize(ANY::nms_filter_scores(scores.data(), num, threshold, inclusive, ref.data()));
+            for (const auto& isa : kernels) {
+                std::vector<int> indices(num);
+                indices.resize(isa.filter_scores(scores.data(), num, threshold, inclusive, indices.data()));
+                ASSERT_EQ(ref, indices) << isa.name << " of " << num << (inclusive ? " inclusive" : "");
+            }
+            for (auto idx : ref) {
+                ASSERT_TRUE(inclusive ? scores[idx] >= threshold : scores[idx] > threshold);
+            }
+        }
+    }
+}
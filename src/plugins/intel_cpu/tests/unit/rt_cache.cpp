@@ -379,3 +379,195 @@ TEST(MultiCacheTests, SmokeTypeIdSync) {
         vecThreads.emplace_back(std::thread(testRoutine, std::ref(vecCache[i])));
     }
 }
+
+TEST(ShardedLruCacheTests, GetPut) {
+    constexpr int capacity = 64;
+    constexpr size_t shardsNum = 8;
+    ShardedLruCache<IntKey, int> cache(capacity, shardsNum);
+    for (int i = 1; i <= capacity; ++i) {
+        ASSERT_NO_THROW(cache.put({i}, i));
+    }
+    ASSERT_LE(cache.size(), static_cast<size_t>(capacity));
+
+    size_t found = 0;
+    for (int i = 1; i <= capacity; ++i) {
+        auto result = cache.get({i});
+        if (result != int()) {
+            ASSERT_EQ(result, i);
+            found++;
+        }
+    }
+    // the records are distributed between the shards unevenly, so some of them may be already evicted
+    ASSERT_EQ(found + cache.getEvictionsCount(), static_cast<size_t>(capacity));
+}
+
+TEST(ShardedLruCacheTests, SingleShardLruPolicy) {
+    constexpr int capacity = 10;
+    ShardedLruCache<IntKey, int> cache(capacity);
+    for (int i = 1; i < capacity; ++i) {
+        ASSERT_NO_THROW(cache.put({i}, i));
+    }
+
+    for (int i = 4; i < capacity; ++i) {
+        ASSERT_EQ(cache.get({i}), i);
+    }
+
+    for (int i = 21; i < 25; ++i) {
+        ASSERT_NO_THROW(cache.put({i}, i));
+    }
+
+    for (int i = 1; i < 4; ++i) {
+        ASSERT_EQ(cache.get({i}), int());
+    }
+    ASSERT_EQ(cache.getEvictionsCount(), 3ul);
+}
+
+TEST(ShardedLruCacheTests, Empty) {
+    constexpr size_t capacity = 0;
+    constexpr int attempts = 10;
+    ShardedLruCache<IntKey, int> cache(capacity, 4);
+    for (int i = 1; i < attempts; ++i) {
+        ASSERT_NO_THROW(cache.put({i}, i));
+    }
+
+    for (int i = 1; i < attempts; ++i) {
+        ASSERT_EQ(cache.get({i}), int());
+    }
+}
+
+namespace {
+struct ReentrantValue {
+    int data;
+};
+} // namespace
+
+namespace ov {
+namespace intel_cpu {
+template<>
+struct is_shareable_cache_value<std::shared_ptr<ReentrantValue>> : std::true_type {};
+}   // namespace intel_cpu
+}   // namespace ov
+
+TEST(MultiCacheTests, Statistics) {
+    using IntValueType = std::shared_ptr<int>;
+
+    constexpr int capacity = 10;
+    auto intBuilder = [&](const IntKey& key) { return std::make_shared<int>(key.data); };
+
+    MultiCache cache(capacity);
+    for (int i = 0; i < 2 * capacity; ++i) {
+        ASSERT_NE(cache.getOrCreate(IntKey{i}, intBuilder).first, IntValueType());
+    }
+    for (int i = capacity; i < 2 * capacity; ++i) {
+        ASSERT_EQ(cache.getOrCreate(IntKey{i}, intBuilder).second, CacheEntryBase::LookUpStatus::Hit);
+    }
+
+    auto stats = cache.getStatistics();
+    ASSERT_EQ(stats.misses, static_cast<size_t>(2 * capacity));
+    ASSERT_EQ(stats.hits, static_cast<size_t>(capacity));
+    ASSERT_EQ(stats.evictions, static_cast<size_t>(capacity));
+}
+
+TEST(MultiCacheTests, SharedBetweenThreads) {
+    using IntValueType = std::shared_ptr<int>;
+    using StrValueType = std::shared_ptr<std::string>;
+
+    constexpr int capacity = 100;
+    constexpr size_t numThreads = 16;
+
+    auto intBuilder = [&](const IntKey& key) { return std::make_shared<int>(key.data); };
+    auto strBuilder = [&](const StringKey& key) { return std::make_shared<std::string>(key.data); };
+
+    MultiCache cache(capacity, numThreads);
+
+    auto testRoutine = [&]() {
+        for (int j = 0; j < 10; ++j) {
+            for (int i = 0; i < capacity; ++i) {
+                auto intResult = cache.getOrCreate(IntKey{i}, intBuilder);
+                ASSERT_NE(intResult.first, IntValueType());
+                ASSERT_EQ(*intResult.first, i);
+                auto strResult = cache.getOrCreate(StringKey{std::to_string(i)}, strBuilder);
+                ASSERT_NE(strResult.first, StrValueType());
+                ASSERT_EQ(*strResult.first, std::to_string(i));
+            }
+        }
+    };
+
+    {
+        std::vector<ScopedThread> vecThreads;
+        vecThreads.reserve(numThreads);
+        for (size_t i = 0; i < numThreads; ++i) {
+            vecThreads.emplace_back(std::thread(testRoutine));
+        }
+    }
+
+    auto stats = cache.getStatistics();
+    ASSERT_EQ(stats.hits + stats.misses, 2 * 10 * capacity * numThreads);
+    // each record is built at least once, but the concurrent misses of the same key may build it several times
+    ASSERT_GE(stats.misses, static_cast<size_t>(2 * capacity));
+}
+
+TEST(MultiCacheTests, StreamsShareReentrantValues) {
+    using SharedValueType = std::shared_ptr<ReentrantValue>;
+    using IntValueType = std::shared_ptr<int>;
+
+    constexpr int capacity = 100;
+    constexpr size_t numStreams = 8;
+    constexpr int repeats = 10;
+
+    std::atomic_size_t sharedBuilt{0};
+    auto sharedBuilder = [&](const IntKey& key) {
+        sharedBuilt++;
+        return std::make_shared<ReentrantValue>(ReentrantValue{key.data});
+    };
+    auto intBuilder = [&](const IntKey& key) { return std::make_shared<int>(key.data); };
+
+    auto sharedCache = std::make_shared<MultiCache>(capacity, numStreams);
+    std::vector<MultiCache> streamCaches(numStreams, MultiCache(capacity, sharedCache));
+    std::vector<std::vector<IntValueType>> streamValues(numStreams);
+
+    auto streamRoutine = [&](size_t stream) {
+        auto& cache = streamCaches[stream];
+        for (int j = 0; j < repeats; ++j) {
+            for (int i = 0; i < capacity; ++i) {
+                auto sharedResult = cache.getOrCreate(IntKey{i}, sharedBuilder);
+                ASSERT_NE(sharedResult.first, SharedValueType());
+                ASSERT_EQ(sharedResult.first->data, i);
+                auto intResult = cache.getOrCreate(IntKey{i}, intBuilder);
+                ASSERT_NE(intResult.first, IntValueType());
+                ASSERT_EQ(*intResult.first, i);
+                // the values which are not reentrant are never shared, so each stream gets its own ones
+                ASSERT_EQ(intResult.second, j ? CacheEntryBase::LookUpStatus::Hit : CacheEntryBase::LookUpStatus::Miss);
+                if (j == 0)
+                    streamValues[stream].push_back(intResult.first);
+            }
+        }
+    };
+
+    {
+        std::vector<ScopedThread> vecThreads;
+        vecThreads.reserve(numStreams);
+        for (size_t i = 0; i < numStreams; ++i) {
+            vecThreads.emplace_back(std::thread(streamRoutine, i));
+        }
+    }
+
+    for (size_t stream = 1; stream < numStreams; ++stream) {
+        for (int i = 0; i < capacity; ++i) {
+            ASSERT_NE(streamValues[stream][i], streamValues[0][i]);
+        }
+    }
+
+    // the reentrant values are looked up in the shared cache only
+    auto sharedStats = sharedCache->getStatistics();
+    ASSERT_EQ(sharedStats.hits + sharedStats.misses, static_cast<size_t>(repeats * capacity) * numStreams);
+    ASSERT_EQ(sharedStats.misses, sharedBuilt.load());
+    // each value is built at least once, but the concurrent misses of the same key may build it several times
+    ASSERT_GE(sharedBuilt.load(), static_cast<size_t>(capacity));
+    ASSERT_LT(sharedBuilt.load(), static_cast<size_t>(capacity) * numStreams + 1);
+    for (const auto& cache : streamCaches) {
+        auto stats = cache.getStatistics();
+        ASSERT_EQ(stats.misses, static_cast<size_t>(capacity));
+        ASSERT_EQ(stats.hits, static_cast<size_t>((repeats - 1) * capacity));
+    }
+}
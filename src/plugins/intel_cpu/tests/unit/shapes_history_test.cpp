@@ -0,0 +1,118 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#include "cache/shapes_history.h"
+
+using namespace ov::intel_cpu;
+
+TEST(ShapesHistoryTest, Record) {
+    ShapesHistory history(2);
+    ASSERT_FALSE(history.isModified());
+    ASSERT_TRUE(history.record({{"input", {1, 3, 10}}}));
+    ASSERT_FALSE(history.record({{"input", {1, 3, 10}}}));
+    ASSERT_TRUE(history.record({{"input", {1, 3, 20}}}));
+    // capacity is exceeded
+    ASSERT_FALSE(history.record({{"input", {1, 3, 30}}}));
+    ASSERT_TRUE(history.isModified());
+    ASSERT_EQ(history.getSignatures().size(), 2ul);
+}
+
+TEST(ShapesHistoryTest, RecordConcurrently) {
+    constexpr size_t threadsNum = 8;
+    constexpr size_t signaturesNum = 100;
+    ShapesHistory history(signaturesNum);
+    std::vector<size_t> inserted(threadsNum, 0);
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < threadsNum; t++) {
+        threads.emplace_back([&, t] {
+            // every thread records all the signatures, each of them must be inserted only once
+            for (size_t i = 0; i < signaturesNum; i++) {
+                if (history.record({{"input", {1, (i * 7 + t) % signaturesNum}}}))
+                    inserted[t]++;
+            }
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    size_t insertedTotal = 0;
+    for (const auto count : inserted)
+        insertedTotal += count;
+    ASSERT_EQ(insertedTotal, signaturesNum);
+    ASSERT_EQ(history.getSignatures().size(), signaturesNum);
+}
+
+TEST(ShapesHistoryTest, RecordConcurrentlyOverCapacity) {
+    constexpr size_t threadsNum = 8;
+    constexpr size_t signaturesNum = 64;
+    constexpr size_t capacity = 5;
+    for (size_t round = 0; round < 100; round++) {
+        ShapesHistory history(capacity);
+        std::vector<size_t> inserted(threadsNum, 0);
+        std::vector<std::thread> threads;
+        std::atomic<bool> start{false};
+        for (size_t t = 0; t < threadsNum; t++) {
+            threads.emplace_back([&, t] {
+                while (!start) {
+                    std::this_thread::yield();
+                }
+                // the threads record the different signatures at once, while only a few of them fit the history
+                for (size_t i = 0; i < signaturesNum / threadsNum; i++) {
+                    if (history.record({{"input", {1, t * signaturesNum + i}}}))
+                        inserted[t]++;
+                }
+            });
+        }
+        start = true;
+        for (auto& thread : threads)
+            thread.join();
+
+        size_t insertedTotal = 0;
+        for (const auto count : inserted)
+            insertedTotal += count;
+        ASSERT_EQ(insertedTotal, capacity);
+        ASSERT_EQ(history.getSignatures().size(), capacity);
+    }
+}
+
+TEST(ShapesHistoryTest, SaveLoad) {
+    ShapesHistory history(10);
+    history.record({{"input 0", {1, 3, 10}}, {"input;1", {1}}});
+    history.record({{"input 0", {1, 3, 20}}, {"input;1", {}}});
+    std::stringstream stream;
+    history.save(stream);
+    ASSERT_FALSE(history.isModified());
+
+    ShapesHistory restored(10);
+    restored.load(stream);
+    ASSERT_FALSE(restored.isModified());
+    ASSERT_EQ(restored.getSignatures(), history.getSignatures());
+}
+
+TEST(ShapesHistoryTest, LoadCorrupted) {
+    std::stringstream stream("not a shapes history");
+    ShapesHistory history(10);
+    ASSERT_NO_THROW(history.load(stream));
+    ASSERT_TRUE(history.getSignatures().empty());
+}
+
+TEST(ShapesHistoryTest, LoadTruncated) {
+    ShapesHistory history(10);
+    history.record({{"input", {1, 3, 10}}});
+    std::stringstream stream;
+    history.save(stream);
+    const auto content = stream.str();
+
+    std::stringstream truncated(content.substr(0, content.size() - 4));
+    ShapesHistory restored(10);
+    ASSERT_NO_THROW(restored.load(truncated));
+    ASSERT_TRUE(restored.getSignatures().empty());
+}
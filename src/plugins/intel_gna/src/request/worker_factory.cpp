@@ -96,16 +96,12 @@ std::vector<std::shared_ptr<Subrequest>> WorkerFactory::createModelSubrequestsFP
 
     std::vector<std::shared_ptr<Subrequest>> subrequests;
 
-    std::weak_ptr<backend::AMIntelDNN> weak_dnn = dnn;
+    // the runtime keeps the data prepared for the model between the inferences, it refers to dnn weakly
+    auto runtime = std::make_shared<runtime::FP>(std::move(dnn));
 
-    auto enqueFP32 = [weak_dnn]() -> uint32_t {
-        if (auto dnn = weak_dnn.lock()) {
-            auto runtime = runtime::FP(dnn);
-            runtime.infer();
-            return kFakeRequestID;
-        }
-        // maybe warning would be enough
-        THROW_GNA_EXCEPTION << "dnn is nullptr";
+    auto enqueFP32 = [runtime]() -> uint32_t {
+        runtime->infer();
+        return kFakeRequestID;
     };
 
     auto waitSimple = [](uint32_t, int64_t) {
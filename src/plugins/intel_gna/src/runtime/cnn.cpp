@@ -8,6 +8,7 @@
 #include <cstdint>
 #include <cstdio>
 #include <limits>
+#include <vector>
 
 #include "backend/dnn_types.hpp"
 #include "backend/gna_limitations.hpp"
@@ -18,8 +19,57 @@
 
 using namespace ov::intel_gna::gna_convolution_layer;
 using namespace ov::intel_gna::limitations;
+using ov::intel_gna::runtime::parallel_ranges;
+using ov::intel_gna::runtime::Shape2D;
+using ov::intel_gna::runtime::SimdKernels;
 
-void CNNFilter32(intel_dnn_component_t* component) {
+namespace {
+
+// [filter][coefficient] -> [coefficient][filter]
+std::vector<float> interleaveFilters1D(const intel_dnn_component_t* component) {
+    auto filters = reinterpret_cast<const float*>(component->op.conv1D.ptr_filters);
+    const auto filterSize = component->op.conv1D.num_filter_coefficients;
+    const auto numberOfFilters = component->op.conv1D.num_filters;
+    std::vector<float> interleavedFilters(static_cast<size_t>(filterSize) * numberOfFilters);
+    for (uint32_t i = 0; i < numberOfFilters; i++) {
+        for (uint32_t k = 0; k < filterSize; k++) {
+            interleavedFilters[static_cast<size_t>(k) * numberOfFilters + i] =
+                filters[static_cast<size_t>(i) * filterSize + k];
+        }
+    }
+    return interleavedFilters;
+}
+
+// [OC][aligned kh * kw * kc] -> [kh][kw][kc][OC]
+std::vector<float> interleaveFilters2D(const intel_dnn_component_t* component) {
+    auto filters = reinterpret_cast<const float*>(component->op.conv2D.ptr_filters);
+    const auto OC = component->tensors[2].dimensions[0];
+    const auto kernelSize =
+        component->tensors[2].dimensions[1] * component->tensors[2].dimensions[2] * component->tensors[2].dimensions[3];
+    const auto alignedKernelSize = ALIGN(kernelSize, Limitations::kConvEachKernelByteAlignment / sizeof(float));
+    std::vector<float> interleavedFilters(static_cast<size_t>(kernelSize) * OC);
+    for (uint32_t oc = 0; oc < OC; oc++) {
+        for (uint32_t i = 0; i < kernelSize; i++) {
+            interleavedFilters[static_cast<size_t>(i) * OC + oc] =
+                filters[static_cast<size_t>(oc) * alignedKernelSize + i];
+        }
+    }
+    return interleavedFilters;
+}
+
+}  // namespace
+
+std::vector<float> CNNInterleaveFilters(const intel_dnn_component_t* component) {
+    if (component->operation == kDnnConvolutional1dOp && component->op.conv1D.ptr_filters != nullptr) {
+        return interleaveFilters1D(component);
+    }
+    if (component->operation == kDnnConvolutional2dOp && component->op.conv2D.ptr_filters != nullptr) {
+        return interleaveFilters2D(component);
+    }
+    return {};
+}
+
+void CNNFilter32(intel_dnn_component_t* component, const SimdKernels* kernels, const float* interleavedFilters) {
     auto filters = reinterpret_cast<float*>(component->op.conv1D.ptr_filters);
     auto biases = reinterpret_cast<float*>(component->op.conv1D.ptr_biases);
     auto input = reinterpret_cast<float*>(component->ptr_inputs);
@@ -40,6 +90,29 @@ void CNNFilter32(intel_dnn_component_t* component) {
         THROW_GNA_EXCEPTION << "Bad num_columns_out in CNNFilter32!" << layer_name;
     }
 
+    if (kernels != nullptr) {
+        // vector lanes compute different filters, so the coefficients of the filters are interleaved
+        std::vector<float> localFilters;
+        if (interleavedFilters == nullptr) {
+            localFilters = interleaveFilters1D(component);
+            interleavedFilters = localFilters.data();
+        }
+        parallel_ranges(numberOfOutputsPerFilter,
+                        static_cast<size_t>(filterSize) * numberOfFilters,
+                        [&](size_t begin, size_t end) {
+                            kernels->convolution_1d(input,
+                                                    interleavedFilters,
+                                                    biases,
+                                                    output,
+                                                    numberOfFilters,
+                                                    filterSize,
+                                                    convolutionStride,
+                                                    begin,
+                                                    end);
+                        });
+        return;
+    }
+
     for (uint32_t j = 0; j < numberOfOutputsPerFilter; j++, input += convolutionStride, output += numberOfFilters) {
         auto filter = filters;
         for (uint32_t i = 0; i < numberOfFilters; i++, filter += filterSize) {
@@ -55,7 +128,8 @@ namespace {
 
 void CNNMaxPoolLegacy(intel_dnn_component_t* component,
                       intel_dnn_number_type_t number_type,
-                      const bool sumPoolingOverRide) {
+                      const bool sumPoolingOverRide,
+                      const SimdKernels* kernels) {
     const uint32_t num_inputs =
         component->op.maxpool.inCHW[0] * component->op.maxpool.inCHW[1] * component->op.maxpool.inCHW[2];
     const uint32_t in_c = component->op.maxpool.inCHW[0];
@@ -63,6 +137,24 @@ void CNNMaxPoolLegacy(intel_dnn_component_t* component,
     const uint32_t num_pool_step = component->op.maxpool.poolingStrideXY[0];
     const uint32_t num_rows_in = num_inputs / in_c;
 
+    if (kernels != nullptr && number_type == kDnnFloat) {
+        const float* ptr_inputs = reinterpret_cast<float*>(component->ptr_inputs);
+        float* ptr_outputs = reinterpret_cast<float*>(component->ptr_outputs);
+        const uint32_t num_rows_out = (num_rows_in + num_pool_step - 1) / num_pool_step;
+        parallel_ranges(num_rows_out, static_cast<size_t>(in_c) * num_pool_size, [&](size_t begin, size_t end) {
+            kernels->pool_1d(ptr_inputs,
+                             ptr_outputs,
+                             in_c,
+                             num_rows_in,
+                             num_pool_size,
+                             num_pool_step,
+                             sumPoolingOverRide,
+                             begin,
+                             end);
+        });
+        return;
+    }
+
     if (number_type == kDnnInt) {
         int32_t* ptr_inputs = reinterpret_cast<int32_t*>(component->ptr_inputs);
         int32_t* ptr_outputs = reinterpret_cast<int32_t*>(component->ptr_outputs);
@@ -160,7 +252,7 @@ float MaxPool2D32SingleHWC(const unsigned poolWinH,
     return output;
 }
 
-void CNNMaxPool2DFloat(intel_dnn_component_t* component) {
+void CNNMaxPool2DFloat(intel_dnn_component_t* component, const SimdKernels* kernels) {
     float* ptr_inputs = reinterpret_cast<float*>(component->ptr_inputs);
     float* ptr_outputs = reinterpret_cast<float*>(component->ptr_outputs);
     const auto OC = component->op.maxpool.outCHW[0];
@@ -176,6 +268,14 @@ void CNNMaxPool2DFloat(intel_dnn_component_t* component) {
     const auto poolStrideW = component->op.maxpool.poolingStrideXY[0];
     const auto poolStrideH = component->op.maxpool.poolingStrideXY[1];
 
+    if (kernels != nullptr) {
+        const Shape2D shape{IH, IW, IC, OH, OW, OC, poolWinH, poolWinW, 0, poolStrideH, poolStrideW, 0, 0};
+        parallel_ranges(OH, static_cast<size_t>(OW) * OC * poolWinH * poolWinW, [&](size_t begin, size_t end) {
+            kernels->max_pool_2d(ptr_inputs, ptr_outputs, shape, begin, end);
+        });
+        return;
+    }
+
     for (unsigned oc = 0; oc < OC; oc++) {
         for (unsigned ow = 0; ow < OW; ow++) {
             for (unsigned oh = 0; oh < OH; oh++) {
@@ -256,9 +356,13 @@ float CNN2DFilter32SingleHWC(const float bias,
     return output;
 }
 
+bool fitsPaddedInput(uint32_t outputSize, uint32_t filterSize, uint32_t inputSize, uint32_t padding, uint32_t stride) {
+    return outputSize == 0 || filterSize == 0 || stride * (outputSize - 1) + filterSize - 1 < inputSize + 2 * padding;
+}
+
 }  // namespace
 
-void CNN2DFilter32(intel_dnn_component_t* component) {
+void CNN2DFilter32(intel_dnn_component_t* component, const SimdKernels* kernels, const float* interleavedFilters) {
     float* ptr_filters = reinterpret_cast<float*>(component->op.conv2D.ptr_filters);
     float* ptr_biases = reinterpret_cast<float*>(component->op.conv2D.ptr_biases);
     float* ptr_inputs = reinterpret_cast<float*>(component->ptr_inputs);
@@ -286,6 +390,38 @@ void CNN2DFilter32(intel_dnn_component_t* component) {
     if (kc != IC) {
         THROW_GNA_EXCEPTION << "Depth of filter should be equal to input depth!" << layer_name;
     }
+
+    const auto& convStride = component->op.conv2D.convStride;
+    const auto& zeroPadding = component->op.conv2D.zeroPadding;
+    // the padded area is validated once for the whole output, the reference implementation reports the error
+    if (kernels != nullptr && fitsPaddedInput(OH, kh, IH, zeroPadding[0], convStride[0]) &&
+        fitsPaddedInput(OW, kw, IW, zeroPadding[1], convStride[1])) {
+        // vector lanes compute different output channels, so the kernels are interleaved to [kh][kw][kc][OC]
+        const auto kernelSize = kh * kw * kc;
+        std::vector<float> localFilters;
+        if (interleavedFilters == nullptr) {
+            localFilters = interleaveFilters2D(component);
+            interleavedFilters = localFilters.data();
+        }
+        const Shape2D shape{IH,
+                            IW,
+                            IC,
+                            OH,
+                            OW,
+                            OC,
+                            kh,
+                            kw,
+                            kc,
+                            convStride[0],
+                            convStride[1],
+                            zeroPadding[0],
+                            zeroPadding[1]};
+        parallel_ranges(OH, static_cast<size_t>(OW) * OC * kernelSize, [&](size_t begin, size_t end) {
+            kernels->convolution_2d(ptr_inputs, interleavedFilters, ptr_biases, ptr_outputs, shape, begin, end);
+        });
+        return;
+    }
+
     auto kernelIndex = 0;
     for (unsigned oc = 0; oc < OC; oc++) {
         for (unsigned ow = 0; ow < OW; ow++) {
@@ -322,15 +458,16 @@ bool is2D(T&& vec) {
 void CNNMaxPool(intel_dnn_component_t* component,
                 intel_dnn_number_type_t number_type,
                 const bool fused_with_convolution_2d,
-                const bool sumPoolingOverRide) {
+                const bool sumPoolingOverRide,
+                const SimdKernels* kernels) {
     if (fused_with_convolution_2d || is2D(component->op.maxpool.poolingStrideXY) ||
         is2D(component->op.maxpool.poolingWindowXY)) {
         if (!sumPoolingOverRide) {
-            CNNMaxPool2DFloat(component);
+            CNNMaxPool2DFloat(component, kernels);
         } else {
             THROW_GNA_EXCEPTION << "SUM pooling2D not supported";
         }
     } else {
-        CNNMaxPoolLegacy(component, number_type, sumPoolingOverRide);
+        CNNMaxPoolLegacy(component, number_type, sumPoolingOverRide, kernels);
     }
 }
@@ -6,15 +6,27 @@
 
 #include <cstdio>
 #include <cstdlib>
+#include <vector>
 
 #include "backend/dnn_types.hpp"
+#include "simd_kernels.hpp"
 
 #define CNN_MAX_POOL_SIZE 6
 
-void CNNFilter32(intel_dnn_component_t* component);
+// the filters of the convolution component in the layout of the vectorized kernels, empty for the other components
+std::vector<float> CNNInterleaveFilters(const intel_dnn_component_t* component);
+
+// kernels run the vectorized and multi-threaded implementation, nullptr runs the reference one;
+// the interleaved filters are computed on each call unless they are prepared by CNNInterleaveFilters
+void CNNFilter32(intel_dnn_component_t* component,
+                 const ov::intel_gna::runtime::SimdKernels* kernels = nullptr,
+                 const float* interleavedFilters = nullptr);
 void CNNMaxPool(intel_dnn_component_t* component,
                 intel_dnn_number_type_t number_type,
                 const bool fused_with_convolution_2d,
-                const bool sumPoolingOverRide = false);
+                const bool sumPoolingOverRide = false,
+                const ov::intel_gna::runtime::SimdKernels* kernels = nullptr);
 
-void CNN2DFilter32(intel_dnn_component_t* component);
+void CNN2DFilter32(intel_dnn_component_t* component,
+                   const ov::intel_gna::runtime::SimdKernels* kernels = nullptr,
+                   const float* interleavedFilters = nullptr);
@@ -6,17 +6,31 @@
 #include <cstdint>
 
 #include "backend/dnn_types.hpp"
+#include "cnn.h"
 #include "log/debug.hpp"
+#include "simd_kernels.hpp"
 
 namespace ov {
 namespace intel_gna {
 namespace runtime {
 
 void FP::infer() {
+    auto dnn = this->dnn.lock();
     if (!dnn) {
         THROW_GNA_EXCEPTION << "[GNA FP32 RUNTIME] not initialized";
     }
 
+    if (get_simd_kernels() != nullptr && interleaved_filters.size() != dnn->component.size()) {
+        interleaved_filters.resize(dnn->component.size());
+        for (size_t i = 0; i < dnn->component.size(); i++) {
+            interleaved_filters[i] = CNNInterleaveFilters(&dnn->component[i]);
+        }
+    }
+    auto get_interleaved_filters = [this](uint32_t i) -> const float* {
+        return i < interleaved_filters.size() && !interleaved_filters[i].empty() ? interleaved_filters[i].data()
+                                                                                  : nullptr;
+    };
+
     for (uint32_t i = 0; i < dnn->component.size(); i++) {
         intel_dnn_component_t* comp = &dnn->component[i];
         uint32_t* ptr_active_outputs = nullptr;
@@ -59,11 +73,11 @@ void FP::infer() {
             break;
         }
         case kDnnConvolutional1dOp: {
-            ApplyConvolutional1DTransform(comp);
+            ApplyConvolutional1DTransform(comp, get_interleaved_filters(i));
             break;
         }
         case kDnnConvolutional2dOp: {
-            ApplyConvolutional2DTransform(comp);
+            ApplyConvolutional2DTransform(comp, get_interleaved_filters(i));
             break;
         }
         case kDnnPiecewiselinearOp: {
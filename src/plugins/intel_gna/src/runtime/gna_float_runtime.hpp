@@ -4,6 +4,8 @@
 
 #pragma once
 #include <backend/am_intel_dnn.hpp>
+#include <memory>
+#include <vector>
 
 namespace ov {
 namespace intel_gna {
@@ -14,7 +16,10 @@ namespace runtime {
  * execute them on CPU
  */
 class FP {
-    std::shared_ptr<backend::AMIntelDNN> dnn;
+    std::weak_ptr<backend::AMIntelDNN> dnn;
+    // filters of the convolution components in the layout of the vectorized kernels, indexed by the component,
+    // they are prepared by the first inference and reused by the next ones
+    std::vector<std::vector<float>> interleaved_filters;
 
 public:
     FP(std::shared_ptr<backend::AMIntelDNN> dnn) : dnn(dnn) {}
@@ -26,8 +31,10 @@ public:
     static void ApplyAffineTransform(intel_dnn_component_t* component, uint32_t* list, uint32_t listsize);
     static void ApplyDiagonalTransform(intel_dnn_component_t* component);
     static void ApplyRecurrentTransform(intel_dnn_component_t* component, uint32_t row, void* ptr_feedbacks);
-    static void ApplyConvolutional1DTransform(intel_dnn_component_t* component);
-    static void ApplyConvolutional2DTransform(intel_dnn_component_t* component);
+    static void ApplyConvolutional1DTransform(intel_dnn_component_t* component,
+                                              const float* interleaved_filters = nullptr);
+    static void ApplyConvolutional2DTransform(intel_dnn_component_t* component,
+                                              const float* interleaved_filters = nullptr);
     static void ApplyPiecewiseLinearTransform(intel_dnn_component_t* component,
                                               intel_dnn_number_type_t number_type,
                                               uint32_t listsize);
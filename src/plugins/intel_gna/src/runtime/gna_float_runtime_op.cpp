@@ -6,6 +6,7 @@
 #include "floatmath.h"
 #include "gna_float_runtime.hpp"
 #include "pwl.h"
+#include "simd_kernels.hpp"
 
 namespace ov {
 namespace intel_gna {
@@ -28,6 +29,13 @@ void FP::ApplyAffineTransform(intel_dnn_component_t* component, uint32_t* list,
     auto B = reinterpret_cast<float*>(component->ptr_inputs);
     auto C = reinterpret_cast<float*>(component->ptr_outputs);
     auto bias = reinterpret_cast<float*>(transform->ptr_biases);
+    const auto kernels = get_simd_kernels();
+    if (kernels != nullptr) {
+        parallel_ranges(list == nullptr ? m : listsize, static_cast<size_t>(n) * k, [&](size_t begin, size_t end) {
+            kernels->affine(A, B, bias, C, list, n, k, lda, ldb, ldc, begin, end);
+        });
+        return;
+    }
     if (list == nullptr) {
         for (uint32_t i = 0; i < m; i++) {
             for (uint32_t j = 0; j < n; j++) {
@@ -75,6 +83,13 @@ void FP::ApplyDiagonalTransform(intel_dnn_component_t* component) {
     auto B = reinterpret_cast<float*>(component->ptr_inputs);
     auto C = reinterpret_cast<float*>(component->ptr_outputs);
     auto bias = reinterpret_cast<float*>(transform->ptr_biases);
+    const auto kernels = get_simd_kernels();
+    if (kernels != nullptr) {
+        parallel_ranges(m, n, [&](size_t begin, size_t end) {
+            kernels->diagonal(A, B, bias, C, n, ldc, begin, end);
+        });
+        return;
+    }
     for (uint32_t i = 0; i < m; i++) {
         for (uint32_t j = 0; j < n; j++) {
             C[i * ldc + j] = bias[i];
@@ -110,15 +125,15 @@ void FP::ApplyRecurrentTransform(intel_dnn_component_t* component, uint32_t row,
     sgemv_split(n, k1, k2, A1, A2, X, B, C);
 }
 
-void FP::ApplyConvolutional1DTransform(intel_dnn_component_t* component) {
+void FP::ApplyConvolutional1DTransform(intel_dnn_component_t* component, const float* interleaved_filters) {
     if (4 != component->num_bytes_per_input) {
         THROW_GNA_EXCEPTION << "Bad data width: " << component->num_bytes_per_input;
     }
-    CNNFilter32(component);
+    CNNFilter32(component, get_simd_kernels(), interleaved_filters);
 }
 
-void FP::ApplyConvolutional2DTransform(intel_dnn_component_t* component) {
-    CNN2DFilter32(component);
+void FP::ApplyConvolutional2DTransform(intel_dnn_component_t* component, const float* interleaved_filters) {
+    CNN2DFilter32(component, get_simd_kernels(), interleaved_filters);
 }
 
 void FP::ApplyPiecewiseLinearTransform(intel_dnn_component_t* component,
@@ -127,7 +142,7 @@ void FP::ApplyPiecewiseLinearTransform(intel_dnn_component_t* component,
     if (kDnnFloat != number_type) {
         THROW_GNA_EXCEPTION << "Bad number type: " << number_type;
     }
-    PwlApply32(component, listsize);
+    PwlApply32(component, listsize, get_simd_kernels());
 }
 
 void FP::ApplyPiecewiseLinearTransform(intel_dnn_component_t* component,
@@ -137,7 +152,7 @@ void FP::ApplyPiecewiseLinearTransform(intel_dnn_component_t* component,
     if (kDnnFloat != number_type) {
         THROW_GNA_EXCEPTION << "Bad number type: " << number_type;
     }
-    PwlApply32(component, num_row, num_row, 0, listsize - 1);
+    PwlApply32(component, num_row, num_row, 0, listsize - 1, get_simd_kernels());
 }
 
 void FP::ApplyMaxPoolTransform(intel_dnn_component_t* component,
@@ -146,7 +161,7 @@ void FP::ApplyMaxPoolTransform(intel_dnn_component_t* component,
     if (4 != component->num_bytes_per_input) {
         THROW_GNA_EXCEPTION << "Bad data width: " << component->num_bytes_per_input;
     }
-    CNNMaxPool(component, number_type, fused_with_convolution_2d);
+    CNNMaxPool(component, number_type, fused_with_convolution_2d, false, get_simd_kernels());
 }
 
 void FP::ApplyTranspose(intel_dnn_component_t* component) {
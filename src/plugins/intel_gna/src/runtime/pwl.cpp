@@ -394,19 +394,23 @@ void PwlDesign(const DnnActivation& activation_type,
     }
 }
 
-void PwlApply32(intel_dnn_component_t* component, uint32_t num_subset_size) {
+void PwlApply32(intel_dnn_component_t* component,
+                uint32_t num_subset_size,
+                const ov::intel_gna::runtime::SimdKernels* kernels) {
     if (component->orientation_in == kDnnInterleavedOrientation) {  // subsets only supported in interleaved orientation
-        PwlApply32(component, 0, num_subset_size - 1, 0, component->num_columns_in - 1);
+        PwlApply32(component, 0, num_subset_size - 1, 0, component->num_columns_in - 1, kernels);
     } else {
-        PwlApply32(component, 0, component->num_rows_in - 1, 0, component->num_columns_in - 1);
+        PwlApply32(component, 0, component->num_rows_in - 1, 0, component->num_columns_in - 1, kernels);
     }
 }
 
-void PwlApply32(intel_dnn_component_t* component,
-                uint32_t num_row_start,
-                uint32_t num_row_end,
-                uint32_t num_col_start,
-                uint32_t num_col_end) {
+namespace {
+
+void PwlApply32Reference(intel_dnn_component_t* component,
+                         uint32_t num_row_start,
+                         uint32_t num_row_end,
+                         uint32_t num_col_start,
+                         uint32_t num_col_end) {
     intel_piecewiselinear_t* transform = reinterpret_cast<intel_piecewiselinear_t*>(&component->op.pwl);
     float* ptr_in = reinterpret_cast<float*>(component->ptr_inputs);
     float* ptr_out = reinterpret_cast<float*>(component->ptr_outputs);
@@ -553,3 +557,95 @@ void PwlApply32(intel_dnn_component_t* component,
                             << ", Unknown piecewise linear function type: " << transform->func_id.type;
     }
 }
+
+// returns false for the functions without a vectorized kernel, complete rows are processed as a single span
+bool PwlApply32Simd(intel_dnn_component_t* component,
+                    uint32_t num_row_start,
+                    uint32_t num_row_end,
+                    uint32_t num_col_start,
+                    uint32_t num_col_end,
+                    const ov::intel_gna::runtime::SimdKernels& kernels) {
+    const auto& func_id = component->op.pwl.func_id;
+    const float* ptr_in = reinterpret_cast<float*>(component->ptr_inputs);
+    float* ptr_out = reinterpret_cast<float*>(component->ptr_outputs);
+    const uint32_t num_columns = component->num_columns_in;
+    const bool complete_rows = num_col_start == 0 && num_col_end + 1 == num_columns;
+    const size_t row_size = complete_rows ? static_cast<size_t>(num_row_end - num_row_start + 1) * num_columns
+                                          : num_col_end - num_col_start + 1;
+    const uint32_t last_row = complete_rows ? num_row_start : num_row_end;
+    for (uint32_t i = num_row_start; i <= last_row; i++) {
+        const size_t offset = static_cast<size_t>(i) * num_columns + num_col_start;
+        switch (func_id.type) {
+        case kActRelu:
+            kernels.relu(ptr_in + offset, ptr_out + offset, row_size, func_id.args.lrelu.negative_slope);
+            break;
+        case kActKaldiLstmClipping:
+            kernels.clamp(ptr_in + offset, ptr_out + offset, row_size, func_id.args.clamp.low, func_id.args.clamp.high);
+            break;
+        case kActAbs:
+            kernels.abs(ptr_in + offset, ptr_out + offset, row_size);
+            break;
+        case kActSign:
+            kernels.sign(ptr_in + offset, ptr_out + offset, row_size);
+            break;
+        default:
+            return false;
+        }
+    }
+    return true;
+}
+
+// rough cost of an element relative to a multiply-add, 0 for the functions rejected by the reference implementation
+size_t PwlElementCost(DnnActivationType type) {
+    switch (type) {
+    case kActRelu:
+    case kActIdentity:
+    case kActKaldiLstmClipping:
+    case kActAbs:
+    case kActSign:
+        return 1;
+    case kActSigmoid:
+    case kActTanh:
+    case kActSoftSign:
+    case kActExp:
+    case kActLog:
+    case kActNegLog:
+    case kActNegHalfLog:
+    case kActPow:
+    case kActFakeQuantize:
+        return 32;
+    default:
+        return 0;
+    }
+}
+
+}  // namespace
+
+void PwlApply32(intel_dnn_component_t* component,
+                uint32_t num_row_start,
+                uint32_t num_row_end,
+                uint32_t num_col_start,
+                uint32_t num_col_end,
+                const ov::intel_gna::runtime::SimdKernels* kernels) {
+    const size_t element_cost = PwlElementCost(component->op.pwl.func_id.type);
+    if (kernels == nullptr || element_cost == 0 || num_row_end < num_row_start || num_col_end < num_col_start) {
+        PwlApply32Reference(component, num_row_start, num_row_end, num_col_start, num_col_end);
+        return;
+    }
+
+    // the transcendental functions are computed by the reference implementation on several threads,
+    // the rows are split between the threads unless there is only one of them
+    const uint32_t num_rows = num_row_end - num_row_start + 1;
+    const uint32_t num_cols = num_col_end - num_col_start + 1;
+    const bool split_rows = num_rows > 1;
+    const size_t item_cost = element_cost * (split_rows ? num_cols : 1);
+    ov::intel_gna::runtime::parallel_ranges(split_rows ? num_rows : num_cols, item_cost, [&](size_t begin, size_t end) {
+        const uint32_t row_start = split_rows ? num_row_start + static_cast<uint32_t>(begin) : num_row_start;
+        const uint32_t row_end = split_rows ? num_row_start + static_cast<uint32_t>(end) - 1 : num_row_end;
+        const uint32_t col_start = split_rows ? num_col_start : num_col_start + static_cast<uint32_t>(begin);
+        const uint32_t col_end = split_rows ? num_col_end : num_col_start + static_cast<uint32_t>(end) - 1;
+        if (!PwlApply32Simd(component, row_start, row_end, col_start, col_end, *kernels)) {
+            PwlApply32Reference(component, row_start, row_end, col_start, col_end);
+        }
+    });
+}
@@ -10,6 +10,7 @@
 
 #include "backend/dnn_types.hpp"
 #include "backend/gna_types.hpp"
+#include "simd_kernels.hpp"
 
 #define SIGMOID_NUM_SEGMENTS    65
 #define SIGMOID_DOMAIN          10.0f  // portion of input to be approximated (-10,10)
@@ -71,12 +72,16 @@ double calculate_error_pct(const DnnActivation& activation_type,
                            const double offset,
                            const int samples);
 
-void PwlApply32(intel_dnn_component_t* component, const uint32_t num_subset_size);
+// kernels run the vectorized and multi-threaded implementation, nullptr runs the reference one
+void PwlApply32(intel_dnn_component_t* component,
+                const uint32_t num_subset_size,
+                const ov::intel_gna::runtime::SimdKernels* kernels = nullptr);
 void PwlApply32(intel_dnn_component_t* component,
                 const uint32_t num_row_start,
                 const uint32_t num_row_end,
                 const uint32_t num_col_start,
-                const uint32_t num_col_end);
+                const uint32_t num_col_end,
+                const ov::intel_gna::runtime::SimdKernels* kernels = nullptr);
 void PwlDesign(const DnnActivation& activation_type,
                gna_pwl_segment_t* ptr_segment,
                const uint32_t num_segments,
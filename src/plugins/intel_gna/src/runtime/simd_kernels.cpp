@@ -0,0 +1,49 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "simd_kernels.hpp"
+
+#include <ie_system_conf.h>
+
+#include <algorithm>
+
+#include "openvino/core/parallel.hpp"
+
+namespace ov {
+namespace intel_gna {
+namespace runtime {
+
+const SimdKernels* get_simd_kernels() {
+    static const SimdKernels* kernels = []() -> const SimdKernels* {
+        if (InferenceEngine::with_cpu_x86_avx512f() && get_simd_kernels_avx512()) {
+            return get_simd_kernels_avx512();
+        }
+        if (InferenceEngine::with_cpu_x86_avx2() && get_simd_kernels_avx2()) {
+            return get_simd_kernels_avx2();
+        }
+        return nullptr;
+    }();
+    return kernels;
+}
+
+void parallel_ranges(size_t size, size_t item_cost, const std::function<void(size_t, size_t)>& body) {
+    // a few microseconds of work per thread at least
+    constexpr size_t min_range_cost = 1 << 15;
+    const size_t min_range_size = std::max<size_t>(1, min_range_cost / std::max<size_t>(1, item_cost));
+    const size_t num_ranges = std::min(static_cast<size_t>(parallel_get_max_threads()),
+                                       (size + min_range_size - 1) / min_range_size);
+    if (num_ranges <= 1) {
+        body(0, size);
+        return;
+    }
+    ov::parallel_for(num_ranges, [&](size_t range) {
+        size_t begin = 0, end = 0;
+        ov::splitter(size, num_ranges, range, begin, end);
+        body(begin, end);
+    });
+}
+
+}  // namespace runtime
+}  // namespace intel_gna
+}  // namespace ov
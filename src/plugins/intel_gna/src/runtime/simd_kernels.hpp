@@ -0,0 +1,131 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+namespace ov {
+namespace intel_gna {
+namespace runtime {
+
+/**
+ * @brief Dimensions of a 2D convolution or pooling, all tensors are stored in HWC layout
+ */
+struct Shape2D {
+    uint32_t IH, IW, IC;  // input
+    uint32_t OH, OW, OC;  // output
+    uint32_t KH, KW, KC;  // kernel or pooling window, KC is not used by pooling
+    uint32_t SH, SW;      // stride
+    uint32_t PH, PW;      // zero padding, not used by pooling
+};
+
+/**
+ * @brief Vectorized kernels of the floating point runtime.
+ * The lanes of a vector always hold independent output elements and every element is accumulated in the same
+ * order as in the reference implementation, so the results are bit-exact with it.
+ * Every kernel computes the [begin, end) range of the outermost output dimension, so the ranges can be
+ * processed by different threads.
+ */
+struct SimdKernels {
+    /**
+     * @brief 1D convolution, output positions are the range dimension
+     * @param filters filters transposed to [filter_size][num_filters]
+     */
+    void (*convolution_1d)(const float* input,
+                           const float* filters,
+                           const float* biases,
+                           float* output,
+                           uint32_t num_filters,
+                           uint32_t filter_size,
+                           uint32_t stride,
+                           size_t begin,
+                           size_t end);
+    /**
+     * @brief 2D convolution, output rows are the range dimension
+     * @param filters filters transposed to [KH][KW][KC][OC]
+     */
+    void (*convolution_2d)(const float* input,
+                           const float* filters,
+                           const float* biases,
+                           float* output,
+                           const Shape2D& shape,
+                           size_t begin,
+                           size_t end);
+    /**
+     * @brief 2D max pooling, output rows are the range dimension
+     */
+    void (*max_pool_2d)(const float* input, float* output, const Shape2D& shape, size_t begin, size_t end);
+    /**
+     * @brief 1D max or sum pooling of [num_rows][num_channels] input, output rows are the range dimension
+     */
+    void (*pool_1d)(const float* input,
+                    float* output,
+                    uint32_t num_channels,
+                    uint32_t num_rows,
+                    uint32_t window,
+                    uint32_t stride,
+                    bool sum,
+                    size_t begin,
+                    size_t end);
+    /**
+     * @brief outputs = weights * inputs + biases, output rows are the range dimension
+     * @param rows indices of the weights rows to compute output rows from, nullptr for all of them
+     */
+    void (*affine)(const float* weights,
+                   const float* inputs,
+                   const float* biases,
+                   float* outputs,
+                   const uint32_t* rows,
+                   uint32_t num_columns,
+                   uint32_t num_inputs,
+                   uint32_t ld_weights,
+                   uint32_t ld_inputs,
+                   uint32_t ld_outputs,
+                   size_t begin,
+                   size_t end);
+    /**
+     * @brief outputs = diag(weights) * inputs + biases, output rows are the range dimension
+     */
+    void (*diagonal)(const float* weights,
+                     const float* inputs,
+                     const float* biases,
+                     float* outputs,
+                     uint32_t num_columns,
+                     uint32_t ld_outputs,
+                     size_t begin,
+                     size_t end);
+    /**
+     * @brief element-wise activations, input and output may be the same buffer
+     */
+    void (*relu)(const float* input, float* output, size_t size, float negative_slope);
+    void (*clamp)(const float* input, float* output, size_t size, float low, float high);
+    void (*abs)(const float* input, float* output, size_t size);
+    void (*sign)(const float* input, float* output, size_t size);
+};
+
+/**
+ * @brief Returns the kernels for the widest instruction set supported by the CPU or nullptr if there are none
+ */
+const SimdKernels* get_simd_kernels();
+
+/**
+ * @brief Returns the kernels of the instruction set or nullptr if the plugin was compiled without them,
+ * the caller is responsible for checking that the CPU supports the instruction set
+ */
+const SimdKernels* get_simd_kernels_avx2();
+const SimdKernels* get_simd_kernels_avx512();
+
+/**
+ * @brief Splits [0, size) into ranges and runs them on the threads of the plugin threading backend
+ * @param item_cost approximate number of operations per item, the range is not split into pieces which are too small
+ * to pay off the synchronization
+ */
+void parallel_ranges(size_t size, size_t item_cost, const std::function<void(size_t, size_t)>& body);
+
+}  // namespace runtime
+}  // namespace intel_gna
+}  // namespace ov
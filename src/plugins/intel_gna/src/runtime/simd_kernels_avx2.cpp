@@ -0,0 +1,105 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "simd_kernels.hpp"
+
+#ifdef HAVE_AVX2
+#    include <immintrin.h>
+
+#    include "simd_kernels_impl.hpp"
+
+namespace ov {
+namespace intel_gna {
+namespace runtime {
+namespace {
+
+struct Avx2 {
+    using Vec = __m256;
+    using Mask = __m256i;
+    static constexpr uint32_t width = 8;
+
+    static Mask mask(uint32_t size) {
+        return _mm256_cmpgt_epi32(_mm256_set1_epi32(static_cast<int32_t>(size)),
+                                  _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+    }
+    static Vec load(const float* ptr) {
+        return _mm256_loadu_ps(ptr);
+    }
+    static Vec load(const float* ptr, Mask mask) {
+        return _mm256_maskload_ps(ptr, mask);
+    }
+    static void store(float* ptr, Vec value) {
+        _mm256_storeu_ps(ptr, value);
+    }
+    static void store(float* ptr, Vec value, Mask mask) {
+        _mm256_maskstore_ps(ptr, mask, value);
+    }
+    static Vec gather(const float* base, const int32_t* offsets) {
+        return _mm256_i32gather_ps(base, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(offsets)), 4);
+    }
+    static Vec gather(const float* base, const int32_t* offsets, Mask mask) {
+        return _mm256_mask_i32gather_ps(_mm256_setzero_ps(),
+                                        base,
+                                        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(offsets)),
+                                        _mm256_castsi256_ps(mask),
+                                        4);
+    }
+    static Vec set1(float value) {
+        return _mm256_set1_ps(value);
+    }
+    static Vec zero() {
+        return _mm256_setzero_ps();
+    }
+    static Vec add(Vec a, Vec b) {
+        return _mm256_add_ps(a, b);
+    }
+    static Vec mul(Vec a, Vec b) {
+        return _mm256_mul_ps(a, b);
+    }
+    // a > b ? a : b, the same as std::max(b, a) including NaN
+    static Vec max(Vec a, Vec b) {
+        return _mm256_max_ps(a, b);
+    }
+    static Vec relu(Vec value, Vec negative_slope) {
+        return _mm256_blendv_ps(value,
+                                _mm256_mul_ps(value, negative_slope),
+                                _mm256_cmp_ps(value, _mm256_setzero_ps(), _CMP_LT_OQ));
+    }
+    static Vec clamp(Vec value, Vec low, Vec high) {
+        const Vec result = _mm256_blendv_ps(value, low, _mm256_cmp_ps(value, low, _CMP_LT_OQ));
+        return _mm256_blendv_ps(result, high, _mm256_cmp_ps(value, high, _CMP_GT_OQ));
+    }
+    static Vec abs(Vec value) {
+        return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), value);
+    }
+    static Vec sign(Vec value) {
+        const Vec zero = _mm256_setzero_ps();
+        const Vec result =
+            _mm256_blendv_ps(_mm256_set1_ps(-1.0f), _mm256_set1_ps(1.0f), _mm256_cmp_ps(value, zero, _CMP_GT_OQ));
+        return _mm256_blendv_ps(result, zero, _mm256_cmp_ps(value, zero, _CMP_EQ_OQ));
+    }
+};
+
+}  // namespace
+}  // namespace runtime
+}  // namespace intel_gna
+}  // namespace ov
+#endif  // HAVE_AVX2
+
+namespace ov {
+namespace intel_gna {
+namespace runtime {
+
+const SimdKernels* get_simd_kernels_avx2() {
+#ifdef HAVE_AVX2
+    static const SimdKernels kernels = make_simd_kernels<Avx2>();
+    return &kernels;
+#else
+    return nullptr;
+#endif  // HAVE_AVX2
+}
+
+}  // namespace runtime
+}  // namespace intel_gna
+}  // namespace ov
@@ -0,0 +1,102 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "simd_kernels.hpp"
+
+#ifdef HAVE_AVX512F
+#    include <immintrin.h>
+
+#    include "simd_kernels_impl.hpp"
+
+namespace ov {
+namespace intel_gna {
+namespace runtime {
+namespace {
+
+struct Avx512 {
+    using Vec = __m512;
+    using Mask = __mmask16;
+    static constexpr uint32_t width = 16;
+
+    static Mask mask(uint32_t size) {
+        return static_cast<Mask>((1u << size) - 1);
+    }
+    static Vec load(const float* ptr) {
+        return _mm512_loadu_ps(ptr);
+    }
+    static Vec load(const float* ptr, Mask mask) {
+        return _mm512_maskz_loadu_ps(mask, ptr);
+    }
+    static void store(float* ptr, Vec value) {
+        _mm512_storeu_ps(ptr, value);
+    }
+    static void store(float* ptr, Vec value, Mask mask) {
+        _mm512_mask_storeu_ps(ptr, mask, value);
+    }
+    static Vec gather(const float* base, const int32_t* offsets) {
+        return _mm512_i32gather_ps(_mm512_loadu_si512(offsets), base, 4);
+    }
+    static Vec gather(const float* base, const int32_t* offsets, Mask mask) {
+        return _mm512_mask_i32gather_ps(_mm512_setzero_ps(), mask, _mm512_maskz_loadu_epi32(mask, offsets), base, 4);
+    }
+    static Vec set1(float value) {
+        return _mm512_set1_ps(value);
+    }
+    static Vec zero() {
+        return _mm512_setzero_ps();
+    }
+    static Vec add(Vec a, Vec b) {
+        return _mm512_add_ps(a, b);
+    }
+    static Vec mul(Vec a, Vec b) {
+        return _mm512_mul_ps(a, b);
+    }
+    // a > b ? a : b, the same as std::max(b, a) including NaN
+    static Vec max(Vec a, Vec b) {
+        return _mm512_max_ps(a, b);
+    }
+    static Vec relu(Vec value, Vec negative_slope) {
+        return _mm512_mask_mul_ps(value,
+                                  _mm512_cmp_ps_mask(value, _mm512_setzero_ps(), _CMP_LT_OQ),
+                                  value,
+                                  negative_slope);
+    }
+    static Vec clamp(Vec value, Vec low, Vec high) {
+        const Vec result = _mm512_mask_blend_ps(_mm512_cmp_ps_mask(value, low, _CMP_LT_OQ), value, low);
+        return _mm512_mask_blend_ps(_mm512_cmp_ps_mask(value, high, _CMP_GT_OQ), result, high);
+    }
+    static Vec abs(Vec value) {
+        return _mm512_castsi512_ps(_mm512_andnot_si512(_mm512_set1_epi32(INT32_MIN), _mm512_castps_si512(value)));
+    }
+    static Vec sign(Vec value) {
+        const Vec zero = _mm512_setzero_ps();
+        const Vec result = _mm512_mask_blend_ps(_mm512_cmp_ps_mask(value, zero, _CMP_GT_OQ),
+                                                _mm512_set1_ps(-1.0f),
+                                                _mm512_set1_ps(1.0f));
+        return _mm512_mask_blend_ps(_mm512_cmp_ps_mask(value, zero, _CMP_EQ_OQ), result, zero);
+    }
+};
+
+}  // namespace
+}  // namespace runtime
+}  // namespace intel_gna
+}  // namespace ov
+#endif  // HAVE_AVX512F
+
+namespace ov {
+namespace intel_gna {
+namespace runtime {
+
+const SimdKernels* get_simd_kernels_avx512() {
+#ifdef HAVE_AVX512F
+    static const SimdKernels kernels = make_simd_kernels<Avx512>();
+    return &kernels;
+#else
+    return nullptr;
+#endif  // HAVE_AVX512F
+}
+
+}  // namespace runtime
+}  // namespace intel_gna
+}  // namespace ov
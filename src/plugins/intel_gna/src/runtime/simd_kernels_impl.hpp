@@ -0,0 +1,484 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+// Kernels shared by the instruction set specific translation units, V provides the vector operations.
+// The file is compiled with the wider instruction set enabled, so it must not use inline functions of the standard
+// library: the linker may pick their copies with the wider instructions for the whole plugin.
+
+#pragma once
+
+#include <cfloat>
+#include <cstddef>
+#include <cstdint>
+
+#include "simd_kernels.hpp"
+
+namespace ov {
+namespace intel_gna {
+namespace runtime {
+namespace {
+
+// all lanes of a vector
+template <class V>
+struct FullLanes {
+    typename V::Vec load(const float* ptr) const {
+        return V::load(ptr);
+    }
+    void store(float* ptr, typename V::Vec value) const {
+        V::store(ptr, value);
+    }
+    typename V::Vec gather(const float* base, const int32_t* offsets) const {
+        return V::gather(base, offsets);
+    }
+};
+
+// first lanes of the last vector of a row, the rest of them is neither read nor written
+template <class V>
+struct TailLanes {
+    typename V::Mask mask;
+
+    typename V::Vec load(const float* ptr) const {
+        return V::load(ptr, mask);
+    }
+    void store(float* ptr, typename V::Vec value) const {
+        V::store(ptr, value, mask);
+    }
+    typename V::Vec gather(const float* base, const int32_t* offsets) const {
+        return V::gather(base, offsets, mask);
+    }
+};
+
+template <class V, class L>
+void convolution_1d_block(const L& lanes,
+                          const float* input,
+                          const float* filters,
+                          const float* biases,
+                          float* output,
+                          uint32_t num_filters,
+                          uint32_t filter_size) {
+    typename V::Vec acc = lanes.load(biases);
+    for (uint32_t k = 0; k < filter_size; k++) {
+        acc = V::add(acc, V::mul(V::set1(input[k]), lanes.load(filters + static_cast<size_t>(k) * num_filters)));
+    }
+    lanes.store(output, acc);
+}
+
+template <class V>
+void convolution_1d(const float* input,
+                    const float* filters,
+                    const float* biases,
+                    float* output,
+                    uint32_t num_filters,
+                    uint32_t filter_size,
+                    uint32_t stride,
+                    size_t begin,
+                    size_t end) {
+    for (size_t j = begin; j < end; j++) {
+        const float* in = input + j * stride;
+        float* out = output + j * num_filters;
+        uint32_t i = 0;
+        for (; i + V::width <= num_filters; i += V::width) {
+            convolution_1d_block<V>(FullLanes<V>(), in, filters + i, biases + i, out + i, num_filters, filter_size);
+        }
+        if (i < num_filters) {
+            convolution_1d_block<V>(TailLanes<V>{V::mask(num_filters - i)},
+                                    in,
+                                    filters + i,
+                                    biases + i,
+                                    out + i,
+                                    num_filters,
+                                    filter_size);
+        }
+    }
+}
+
+template <class V, class L>
+void convolution_2d_block(const L& lanes,
+                          const float* input,
+                          const float* filters,
+                          const float* biases,
+                          float* output,
+                          const Shape2D& s,
+                          uint32_t oh,
+                          uint32_t ow) {
+    typename V::Vec acc = V::zero();
+    for (uint32_t kh = 0; kh < s.KH; kh++) {
+        const uint32_t ih = s.SH * oh + kh;
+        if (ih < s.PH || ih >= s.IH + s.PH) {
+            continue;
+        }
+        for (uint32_t kw = 0; kw < s.KW; kw++) {
+            const uint32_t iw = s.SW * ow + kw;
+            if (iw < s.PW || iw >= s.IW + s.PW) {
+                continue;
+            }
+            const float* pixel = input + (static_cast<size_t>(ih - s.PH) * s.IW + (iw - s.PW)) * s.IC;
+            const float* filter = filters + (static_cast<size_t>(kh) * s.KW + kw) * s.KC * s.OC;
+            for (uint32_t kc = 0; kc < s.KC; kc++) {
+                acc = V::add(acc, V::mul(V::set1(pixel[kc]), lanes.load(filter + static_cast<size_t>(kc) * s.OC)));
+            }
+        }
+    }
+    lanes.store(output, V::add(acc, lanes.load(biases)));
+}
+
+template <class V>
+void convolution_2d(const float* input,
+                    const float* filters,
+                    const float* biases,
+                    float* output,
+                    const Shape2D& s,
+                    size_t begin,
+                    size_t end) {
+    for (uint32_t oh = static_cast<uint32_t>(begin); oh < end; oh++) {
+        for (uint32_t ow = 0; ow < s.OW; ow++) {
+            float* out = output + (static_cast<size_t>(oh) * s.OW + ow) * s.OC;
+            uint32_t oc = 0;
+            for (; oc + V::width <= s.OC; oc += V::width) {
+                convolution_2d_block<V>(FullLanes<V>(), input, filters + oc, biases + oc, out + oc, s, oh, ow);
+            }
+            if (oc < s.OC) {
+                convolution_2d_block<V>(TailLanes<V>{V::mask(s.OC - oc)},
+                                        input,
+                                        filters + oc,
+                                        biases + oc,
+                                        out + oc,
+                                        s,
+                                        oh,
+                                        ow);
+            }
+        }
+    }
+}
+
+template <class V, class L>
+void max_pool_2d_block(const L& lanes, const float* input, float* output, const Shape2D& s, uint32_t oh, uint32_t ow) {
+    typename V::Vec acc = V::set1(-FLT_MAX);
+    const uint32_t h = oh * s.SH;
+    const uint32_t w = ow * s.SW;
+    for (uint32_t kh = 0; kh < s.KH && h + kh < s.IH; kh++) {
+        for (uint32_t kw = 0; kw < s.KW && w + kw < s.IW; kw++) {
+            acc = V::max(lanes.load(input + (static_cast<size_t>(h + kh) * s.IW + w + kw) * s.IC), acc);
+        }
+    }
+    lanes.store(output, acc);
+}
+
+template <class V>
+void max_pool_2d(const float* input, float* output, const Shape2D& s, size_t begin, size_t end) {
+    for (uint32_t oh = static_cast<uint32_t>(begin); oh < end; oh++) {
+        for (uint32_t ow = 0; ow < s.OW; ow++) {
+            float* out = output + (static_cast<size_t>(oh) * s.OW + ow) * s.OC;
+            uint32_t oc = 0;
+            for (; oc + V::width <= s.OC; oc += V::width) {
+                max_pool_2d_block<V>(FullLanes<V>(), input + oc, out + oc, s, oh, ow);
+            }
+            if (oc < s.OC) {
+                max_pool_2d_block<V>(TailLanes<V>{V::mask(s.OC - oc)}, input + oc, out + oc, s, oh, ow);
+            }
+        }
+    }
+}
+
+template <class V, class L>
+void pool_1d_block(const L& lanes,
+                   const float* input,
+                   float* output,
+                   uint32_t num_channels,
+                   uint32_t first,
+                   uint32_t last,
+                   bool sum) {
+    typename V::Vec acc = sum ? V::zero() : V::set1(-FLT_MAX);
+    for (uint32_t k = first; k < last; k++) {
+        const typename V::Vec value = lanes.load(input + static_cast<size_t>(k) * num_channels);
+        acc = sum ? V::add(acc, value) : V::max(value, acc);
+    }
+    lanes.store(output, acc);
+}
+
+template <class V>
+void pool_1d(const float* input,
+             float* output,
+             uint32_t num_channels,
+             uint32_t num_rows,
+             uint32_t window,
+             uint32_t stride,
+             bool sum,
+             size_t begin,
+             size_t end) {
+    for (size_t m = begin; m < end; m++) {
+        const uint32_t first = static_cast<uint32_t>(m) * stride;
+        const uint32_t last = first + window > num_rows ? num_rows : first + window;
+        float* out = output + m * num_channels;
+        uint32_t i = 0;
+        for (; i + V::width <= num_channels; i += V::width) {
+            pool_1d_block<V>(FullLanes<V>(), input + i, out + i, num_channels, first, last, sum);
+        }
+        if (i < num_channels) {
+            pool_1d_block<V>(TailLanes<V>{V::mask(num_channels - i)},
+                             input + i,
+                             out + i,
+                             num_channels,
+                             first,
+                             last,
+                             sum);
+        }
+    }
+}
+
+// lanes hold the columns of an output row
+template <class V, class L>
+void affine_row_block(const L& lanes,
+                      const float* weights,
+                      const float* inputs,
+                      float bias,
+                      float* outputs,
+                      uint32_t num_inputs,
+                      uint32_t ld_inputs) {
+    typename V::Vec acc = V::set1(bias);
+    for (uint32_t k = 0; k < num_inputs; k++) {
+        acc = V::add(acc, V::mul(V::set1(weights[k]), lanes.load(inputs + static_cast<size_t>(k) * ld_inputs)));
+    }
+    lanes.store(outputs, acc);
+}
+
+// lanes hold the rows of an output column, used when there are less columns than lanes
+template <class V, class L>
+void affine_column_block(const L& lanes,
+                         const float* weights,
+                         const float* inputs,
+                         const float* biases,
+                         float* outputs,
+                         const int32_t* offsets,
+                         const int32_t* indices,
+                         uint32_t num_rows,
+                         uint32_t num_columns,
+                         uint32_t num_inputs,
+                         uint32_t ld_inputs,
+                         uint32_t ld_outputs) {
+    typename V::Vec acc[V::width];
+    const typename V::Vec bias = lanes.gather(biases, indices);
+    for (uint32_t j = 0; j < num_columns; j++) {
+        acc[j] = bias;
+    }
+    for (uint32_t k = 0; k < num_inputs; k++) {
+        const typename V::Vec weight = lanes.gather(weights + k, offsets);
+        const float* in = inputs + static_cast<size_t>(k) * ld_inputs;
+        for (uint32_t j = 0; j < num_columns; j++) {
+            acc[j] = V::add(acc[j], V::mul(weight, V::set1(in[j])));
+        }
+    }
+    float values[V::width];
+    for (uint32_t j = 0; j < num_columns; j++) {
+        V::store(values, acc[j]);
+        for (uint32_t r = 0; r < num_rows; r++) {
+            outputs[static_cast<size_t>(r) * ld_outputs + j] = values[r];
+        }
+    }
+}
+
+template <class V>
+void affine(const float* weights,
+            const float* inputs,
+            const float* biases,
+            float* outputs,
+            const uint32_t* rows,
+            uint32_t num_columns,
+            uint32_t num_inputs,
+            uint32_t ld_weights,
+            uint32_t ld_inputs,
+            uint32_t ld_outputs,
+            size_t begin,
+            size_t end) {
+    if (num_columns >= V::width) {
+        for (size_t l = begin; l < end; l++) {
+            const size_t i = rows ? rows[l] : l;
+            const float* w = weights + i * ld_weights;
+            float* out = outputs + l * ld_outputs;
+            uint32_t j = 0;
+            for (; j + V::width <= num_columns; j += V::width) {
+                affine_row_block<V>(FullLanes<V>(), w, inputs + j, biases[i], out + j, num_inputs, ld_inputs);
+            }
+            if (j < num_columns) {
+                affine_row_block<V>(TailLanes<V>{V::mask(num_columns - j)},
+                                    w,
+                                    inputs + j,
+                                    biases[i],
+                                    out + j,
+                                    num_inputs,
+                                    ld_inputs);
+            }
+        }
+        return;
+    }
+
+    int32_t offsets[V::width] = {};
+    int32_t indices[V::width] = {};
+    for (size_t l = begin; l < end; l += V::width) {
+        const uint32_t num_rows = static_cast<uint32_t>(end - l < V::width ? end - l : V::width);
+        for (uint32_t r = 0; r < num_rows; r++) {
+            indices[r] = static_cast<int32_t>(rows ? rows[l + r] : l + r);
+            offsets[r] = indices[r] * static_cast<int32_t>(ld_weights);
+        }
+        float* out = outputs + l * ld_outputs;
+        if (num_rows == V::width) {
+            affine_column_block<V>(FullLanes<V>(),
+                                   weights,
+                                   inputs,
+                                   biases,
+                                   out,
+                                   offsets,
+                                   indices,
+                                   num_rows,
+                                   num_columns,
+                                   num_inputs,
+                                   ld_inputs,
+                                   ld_outputs);
+        } else {
+            affine_column_block<V>(TailLanes<V>{V::mask(num_rows)},
+                                   weights,
+                                   inputs,
+                                   biases,
+                                   out,
+                                   offsets,
+                                   indices,
+                                   num_rows,
+                                   num_columns,
+                                   num_inputs,
+                                   ld_inputs,
+                                   ld_outputs);
+        }
+    }
+}
+
+template <class V, class L>
+void diagonal_block(const L& lanes,
+                    typename V::Vec weights,
+                    typename V::Vec biases,
+                    const float* inputs,
+                    float* outputs) {
+    lanes.store(outputs, V::add(biases, V::mul(weights, lanes.load(inputs))));
+}
+
+template <class V>
+void diagonal(const float* weights,
+              const float* inputs,
+              const float* biases,
+              float* outputs,
+              uint32_t num_columns,
+              uint32_t ld_outputs,
+              size_t begin,
+              size_t end) {
+    if (num_columns == 1 && ld_outputs == 1) {
+        // single column, lanes hold the rows
+        size_t i = begin;
+        for (; i + V::width <= end; i += V::width) {
+            const FullLanes<V> lanes;
+            diagonal_block<V>(lanes, lanes.load(weights + i), lanes.load(biases + i), inputs + i, outputs + i);
+        }
+        if (i < end) {
+            const TailLanes<V> lanes{V::mask(static_cast<uint32_t>(end - i))};
+            diagonal_block<V>(lanes, lanes.load(weights + i), lanes.load(biases + i), inputs + i, outputs + i);
+        }
+        return;
+    }
+
+    for (size_t i = begin; i < end; i++) {
+        const typename V::Vec weight = V::set1(weights[i]);
+        const typename V::Vec bias = V::set1(biases[i]);
+        const float* in = inputs + i * num_columns;
+        float* out = outputs + i * ld_outputs;
+        uint32_t j = 0;
+        for (; j + V::width <= num_columns; j += V::width) {
+            diagonal_block<V>(FullLanes<V>(), weight, bias, in + j, out + j);
+        }
+        if (j < num_columns) {
+            diagonal_block<V>(TailLanes<V>{V::mask(num_columns - j)}, weight, bias, in + j, out + j);
+        }
+    }
+}
+
+template <class V, class Op>
+void elementwise(const float* input, float* output, size_t size, const Op& op) {
+    size_t i = 0;
+    for (; i + V::width <= size; i += V::width) {
+        V::store(output + i, op(V::load(input + i)));
+    }
+    if (i < size) {
+        const typename V::Mask mask = V::mask(static_cast<uint32_t>(size - i));
+        V::store(output + i, op(V::load(input + i, mask)), mask);
+    }
+}
+
+template <class V>
+struct ReluOp {
+    typename V::Vec negative_slope;
+    typename V::Vec operator()(typename V::Vec value) const {
+        return V::relu(value, negative_slope);
+    }
+};
+
+template <class V>
+struct ClampOp {
+    typename V::Vec low;
+    typename V::Vec high;
+    typename V::Vec operator()(typename V::Vec value) const {
+        return V::clamp(value, low, high);
+    }
+};
+
+template <class V>
+struct AbsOp {
+    typename V::Vec operator()(typename V::Vec value) const {
+        return V::abs(value);
+    }
+};
+
+template <class V>
+struct SignOp {
+    typename V::Vec operator()(typename V::Vec value) const {
+        return V::sign(value);
+    }
+};
+
+template <class V>
+void relu(const float* input, float* output, size_t size, float negative_slope) {
+    elementwise<V>(input, output, size, ReluOp<V>{V::set1(negative_slope)});
+}
+
+template <class V>
+void clamp(const float* input, float* output, size_t size, float low, float high) {
+    elementwise<V>(input, output, size, ClampOp<V>{V::set1(low), V::set1(high)});
+}
+
+template <class V>
+void absolute(const float* input, float* output, size_t size) {
+    elementwise<V>(input, output, size, AbsOp<V>());
+}
+
+template <class V>
+void signum(const float* input, float* output, size_t size) {
+    elementwise<V>(input, output, size, SignOp<V>());
+}
+
+template <class V>
+SimdKernels make_simd_kernels() {
+    SimdKernels kernels;
+    kernels.convolution_1d = convolution_1d<V>;
+    kernels.convolution_2d = convolution_2d<V>;
+    kernels.max_pool_2d = max_pool_2d<V>;
+    kernels.pool_1d = pool_1d<V>;
+    kernels.affine = affine<V>;
+    kernels.diagonal = diagonal<V>;
+    kernels.relu = relu<V>;
+    kernels.clamp = clamp<V>;
+    kernels.abs = absolute<V>;
+    kernels.sign = signum<V>;
+    return kernels;
+}
+
+}  // namespace
+}  // namespace runtime
+}  // namespace intel_gna
+}  // namespace ov
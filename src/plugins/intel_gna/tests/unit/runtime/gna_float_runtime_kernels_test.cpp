@@ -0,0 +1,604 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <ie_system_conf.h>
+
+#include <chrono>
+#include <cstring>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "backend/gna_limitations.hpp"
+#include "runtime/cnn.h"
+#include "runtime/floatmath.h"
+#include "runtime/gna_float_runtime.hpp"
+#include "runtime/pwl.h"
+#include "runtime/simd_kernels.hpp"
+
+using namespace ov::intel_gna::runtime;
+
+namespace {
+
+using NamedKernels = std::pair<std::string, const SimdKernels*>;
+
+std::vector<NamedKernels> supportedKernels() {
+    std::vector<NamedKernels> kernels;
+    if (InferenceEngine::with_cpu_x86_avx2() && get_simd_kernels_avx2() != nullptr) {
+        kernels.emplace_back("AVX2", get_simd_kernels_avx2());
+    }
+    if (InferenceEngine::with_cpu_x86_avx512f() && get_simd_kernels_avx512() != nullptr) {
+        kernels.emplace_back("AVX512F", get_simd_kernels_avx512());
+    }
+    return kernels;
+}
+
+std::vector<float> randomData(size_t size, unsigned seed, float low = -2.f, float high = 2.f) {
+    std::mt19937 gen(seed);
+    std::uniform_real_distribution<float> dist(low, high);
+    std::vector<float> data(size);
+    for (auto& value : data) {
+        value = dist(gen);
+    }
+    return data;
+}
+
+// the results are compared bitwise, so even the signs of zeros and the NaNs have to match
+void expectBitExact(const std::vector<float>& expected, const std::vector<float>& actual, const std::string& name) {
+    ASSERT_EQ(expected.size(), actual.size()) << name;
+    for (size_t i = 0; i < expected.size(); i++) {
+        uint32_t expected_bits, actual_bits;
+        std::memcpy(&expected_bits, &expected[i], sizeof(float));
+        std::memcpy(&actual_bits, &actual[i], sizeof(float));
+        ASSERT_EQ(expected_bits, actual_bits)
+            << name << ": element " << i << " is " << actual[i] << " instead of " << expected[i];
+    }
+}
+
+void fillWithSpecialValues(std::vector<float>& data) {
+    const float special[] = {0.f,
+                             -0.f,
+                             std::numeric_limits<float>::infinity(),
+                             -std::numeric_limits<float>::infinity(),
+                             std::numeric_limits<float>::quiet_NaN(),
+                             std::numeric_limits<float>::denorm_min()};
+    for (size_t i = 0; i < sizeof(special) / sizeof(special[0]) && 7 * i < data.size(); i++) {
+        data[7 * i] = special[i];
+    }
+}
+
+// runs the reference implementation and then every supported kernel on the same component
+void compareWithReference(intel_dnn_component_t& component,
+                          size_t output_size,
+                          const std::vector<NamedKernels>& kernels,
+                          const std::function<void(const SimdKernels*)>& run) {
+    std::vector<float> expected(output_size);
+    component.ptr_outputs = expected.data();
+    run(nullptr);
+    for (const auto& named : kernels) {
+        std::vector<float> actual(output_size);
+        component.ptr_outputs = actual.data();
+        run(named.second);
+        expectBitExact(expected, actual, named.first);
+    }
+}
+
+double measureMicroseconds(const std::function<void()>& body) {
+    constexpr int kRepetitions = 20;
+    body();  // warm up
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < kRepetitions; i++) {
+        body();
+    }
+    const auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::micro>(end - start).count() / kRepetitions;
+}
+
+void reportSpeedup(const std::string& name, const std::function<void(const SimdKernels*)>& run) {
+    const auto kernels = get_simd_kernels();
+    const double reference = measureMicroseconds([&] {
+        run(nullptr);
+    });
+    const double accelerated = measureMicroseconds([&] {
+        run(kernels);
+    });
+    std::cout << name << ": reference " << reference << " us, accelerated " << accelerated << " us, speedup "
+              << reference / accelerated << std::endl;
+}
+
+struct Convolution1D {
+    std::vector<float> input, filters, biases;
+    intel_dnn_component_t component{};
+    size_t output_size;
+
+    Convolution1D(uint32_t num_filters, uint32_t filter_size, uint32_t stride, uint32_t num_inputs)
+        : input(randomData(num_inputs, 1)),
+          filters(randomData(static_cast<size_t>(num_filters) * filter_size, 2)),
+          biases(randomData(num_filters, 3)) {
+        const uint32_t num_outputs = (num_inputs - filter_size) / stride + 1;
+        output_size = static_cast<size_t>(num_outputs) * num_filters;
+        component.operation = kDnnConvolutional1dOp;
+        component.num_rows_in = 1;
+        component.num_columns_in = num_inputs;
+        component.num_rows_out = 1;
+        component.num_columns_out = static_cast<uint32_t>(output_size);
+        component.op.conv1D.num_filters = num_filters;
+        component.op.conv1D.num_filter_coefficients = filter_size;
+        component.op.conv1D.convStride = stride;
+        component.op.conv1D.ptr_filters = filters.data();
+        component.op.conv1D.ptr_biases = biases.data();
+        component.ptr_inputs = input.data();
+        component.original_layer_name = "convolution_1d";
+    }
+};
+
+struct Convolution2D {
+    std::vector<float> input, filters, biases;
+    intel_dnn_component_t component{};
+    size_t output_size;
+
+    Convolution2D(uint32_t IH, uint32_t IW, uint32_t IC, uint32_t OC, uint32_t K, uint32_t S, uint32_t P)
+        : input(randomData(static_cast<size_t>(IH) * IW * IC, 4)),
+          biases(randomData(OC, 6)) {
+        const uint32_t OH = (IH + 2 * P - K) / S + 1;
+        const uint32_t OW = (IW + 2 * P - K) / S + 1;
+        // every kernel starts at an aligned offset, as it does in the plugin memory
+        const uint32_t alignment =
+            ov::intel_gna::limitations::Limitations::kConvEachKernelByteAlignment / sizeof(float);
+        const uint32_t kernel_size = (K * K * IC + alignment - 1) / alignment * alignment;
+        filters = randomData(static_cast<size_t>(OC) * kernel_size, 5);
+        output_size = static_cast<size_t>(OH) * OW * OC;
+        component.operation = kDnnConvolutional2dOp;
+        component.tensors = {{{1, IH, IW, IC}, OvGnaTypeInt32, OvGnaModeDefault},
+                             {{1, OH, OW, OC}, OvGnaTypeInt32, OvGnaModeDefault},
+                             {{OC, K, K, IC}, OvGnaTypeInt32, OvGnaModeDefault}};
+        component.op.conv2D.convStride = {S, S};
+        component.op.conv2D.zeroPadding = {P, P};
+        component.op.conv2D.ptr_filters = filters.data();
+        component.op.conv2D.ptr_biases = biases.data();
+        component.ptr_inputs = input.data();
+        component.original_layer_name = "convolution_2d";
+    }
+};
+
+}  // namespace
+
+class GNAFloatRuntimeKernelsTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        kernels = supportedKernels();
+        if (kernels.empty()) {
+            GTEST_SKIP() << "No vectorized kernels for this CPU";
+        }
+    }
+
+    std::vector<NamedKernels> kernels;
+};
+
+TEST_F(GNAFloatRuntimeKernelsTest, convolution1DIsBitExact) {
+    for (uint32_t num_filters : {8u, 13u, 40u}) {
+        Convolution1D convolution(num_filters, 24, 8, 968);
+        compareWithReference(convolution.component, convolution.output_size, kernels, [&](const SimdKernels* k) {
+            CNNFilter32(&convolution.component, k);
+        });
+        // the filters prepared once for the component, as the runtime does
+        const auto interleaved_filters = CNNInterleaveFilters(&convolution.component);
+        compareWithReference(convolution.component, convolution.output_size, kernels, [&](const SimdKernels* k) {
+            CNNFilter32(&convolution.component, k, interleaved_filters.data());
+        });
+    }
+}
+
+TEST_F(GNAFloatRuntimeKernelsTest, convolution2DIsBitExact) {
+    for (uint32_t num_filters : {8u, 21u}) {
+        for (uint32_t stride : {1u, 2u}) {
+            Convolution2D convolution(9, 11, 5, num_filters, 3, stride, 1);
+            compareWithReference(convolution.component, convolution.output_size, kernels, [&](const SimdKernels* k) {
+                CNN2DFilter32(&convolution.component, k);
+            });
+            const auto interleaved_filters = CNNInterleaveFilters(&convolution.component);
+            compareWithReference(convolution.component, convolution.output_size, kernels, [&](const SimdKernels* k) {
+                CNN2DFilter32(&convolution.component, k, interleaved_filters.data());
+            });
+        }
+    }
+}
+
+TEST_F(GNAFloatRuntimeKernelsTest, maxPool2DIsBitExact) {
+    const uint32_t C = 19, H = 10, W = 12, window = 3, stride = 2;
+    // the last windows are partial, as they are in the plugin
+    const uint32_t OH = (H - 1) / stride + 1, OW = (W - 1) / stride + 1;
+    auto input = randomData(static_cast<size_t>(C) * H * W, 7);
+    fillWithSpecialValues(input);
+
+    intel_dnn_component_t component{};
+    component.op.maxpool.inCHW = {C, H, W};
+    component.op.maxpool.outCHW = {C, OH, OW};
+    component.op.maxpool.poolingWindowXY = {window, window};
+    component.op.maxpool.poolingStrideXY = {stride, stride};
+    component.ptr_inputs = input.data();
+    component.original_layer_name = "max_pool_2d";
+    compareWithReference(component, static_cast<size_t>(C) * OH * OW, kernels, [&](const SimdKernels* k) {
+        CNNMaxPool(&component, kDnnFloat, true, false, k);
+    });
+}
+
+TEST_F(GNAFloatRuntimeKernelsTest, pool1DIsBitExact) {
+    const uint32_t C = 37, rows = 23, window = 3, step = 2;
+    auto input = randomData(static_cast<size_t>(C) * rows, 8);
+    fillWithSpecialValues(input);
+
+    for (bool sum : {false, true}) {
+        intel_dnn_component_t component{};
+        component.op.maxpool.inCHW = {C, rows, 1};
+        component.op.maxpool.poolingWindowXY = {window, 1};
+        component.op.maxpool.poolingStrideXY = {step, 1};
+        component.ptr_inputs = input.data();
+        component.original_layer_name = "pool_1d";
+        const size_t output_size = static_cast<size_t>((rows + step - 1) / step) * C;
+        compareWithReference(component, output_size, kernels, [&](const SimdKernels* k) {
+            CNNMaxPool(&component, kDnnFloat, false, sum, k);
+        });
+    }
+}
+
+TEST_F(GNAFloatRuntimeKernelsTest, pwlIsBitExact) {
+    const uint32_t rows = 7, columns = 133;
+    auto input = randomData(static_cast<size_t>(rows) * columns, 9, -4.f, 4.f);
+    fillWithSpecialValues(input);
+    float fq_low = -1.f, fq_high = 1.f;
+
+    for (auto type : {kActRelu,
+                      kActIdentity,
+                      kActKaldiLstmClipping,
+                      kActAbs,
+                      kActSign,
+                      kActSigmoid,
+                      kActTanh,
+                      kActSoftSign,
+                      kActExp,
+                      kActLog,
+                      kActPow,
+                      kActFakeQuantize}) {
+        intel_dnn_component_t component{};
+        component.num_rows_in = rows;
+        component.num_columns_in = columns;
+        component.orientation_in = kDnnNonInterleavedOrientation;
+        component.op.pwl.func_id = DnnActivation::fromType(type);
+        if (type == kActRelu) {
+            component.op.pwl.func_id.args.lrelu.negative_slope = 0.1f;
+        } else if (type == kActKaldiLstmClipping) {
+            component.op.pwl.func_id.args.clamp = {-0.5f, 0.7f};
+        } else if (type == kActPow) {
+            component.op.pwl.func_id.args.pow = {2.f, 1.5f, 0.25f};
+        } else if (type == kActFakeQuantize) {
+            component.op.pwl.func_id.fqParams.levels = 256;
+            component.op.pwl.func_id.fqParams.input_low = &fq_low;
+            component.op.pwl.func_id.fqParams.input_high = &fq_high;
+            component.op.pwl.func_id.fqParams.output_low = &fq_low;
+            component.op.pwl.func_id.fqParams.output_high = &fq_high;
+        }
+        component.ptr_inputs = input.data();
+        const std::string name = "activation " + std::to_string(static_cast<int>(type));
+
+        SCOPED_TRACE(name);
+        compareWithReference(component, input.size(), kernels, [&](const SimdKernels* k) {
+            PwlApply32(&component, rows, k);
+        });
+        // a part of the columns only, the other elements must stay untouched
+        compareWithReference(component, input.size(), kernels, [&](const SimdKernels* k) {
+            PwlApply32(&component, 1, rows - 2, 3, columns - 20, k);
+        });
+    }
+}
+
+TEST_F(GNAFloatRuntimeKernelsTest, affineIsBitExact) {
+    const uint32_t m = 77, k = 53;
+    const std::vector<uint32_t> list = {5, 0, 76, 13, 14, 15, 42, 41, 70, 2, 33};
+    const auto weights = randomData(static_cast<size_t>(m) * k, 10);
+    const auto biases = randomData(m, 11);
+
+    for (uint32_t n : {1u, 3u, 20u}) {
+        const auto inputs = randomData(static_cast<size_t>(k) * n, 12);
+        for (bool subset : {false, true}) {
+            const uint32_t rows = subset ? static_cast<uint32_t>(list.size()) : m;
+            std::vector<float> expected(static_cast<size_t>(rows) * n);
+            for (uint32_t i = 0; i < rows; i++) {
+                for (uint32_t j = 0; j < n; j++) {
+                    expected[i * n + j] = biases[subset ? list[i] : i];
+                }
+            }
+            if (subset) {
+                cblas_sgemm_subset(CblasRowMajor,
+                                   CblasNoTrans,
+                                   CblasNoTrans,
+                                   m,
+                                   n,
+                                   k,
+                                   1.0,
+                                   weights.data(),
+                                   k,
+                                   inputs.data(),
+                                   n,
+                                   1.0,
+                                   expected.data(),
+                                   n,
+                                   list.data(),
+                                   rows);
+            } else {
+                cblas_sgemm1(CblasRowMajor,
+                             CblasNoTrans,
+                             CblasNoTrans,
+                             m,
+                             n,
+                             k,
+                             1.0,
+                             weights.data(),
+                             k,
+                             inputs.data(),
+                             n,
+                             1.0,
+                             expected.data(),
+                             n);
+            }
+
+            for (const auto& named : kernels) {
+                std::vector<float> actual(expected.size());
+                // two ranges, as the threads compute them
+                for (const auto& range : {std::make_pair(size_t{0}, size_t{rows / 3}),
+                                          std::make_pair(size_t{rows / 3}, size_t{rows})}) {
+                    named.second->affine(weights.data(),
+                                         inputs.data(),
+                                         biases.data(),
+                                         actual.data(),
+                                         subset ? list.data() : nullptr,
+                                         n,
+                                         k,
+                                         k,
+                                         n,
+                                         n,
+                                         range.first,
+                                         range.second);
+                }
+                expectBitExact(expected, actual, named.first + " with " + std::to_string(n) + " columns");
+            }
+        }
+    }
+}
+
+TEST_F(GNAFloatRuntimeKernelsTest, diagonalIsBitExact) {
+    const uint32_t m = 75;
+    const auto weights = randomData(m, 13);
+    const auto biases = randomData(m, 14);
+
+    for (uint32_t n : {1u, 20u}) {
+        const auto inputs = randomData(static_cast<size_t>(m) * n, 15);
+        std::vector<float> expected(static_cast<size_t>(m) * n);
+        std::vector<float> weights_row(n);
+        for (uint32_t i = 0; i < m; i++) {
+            std::fill(weights_row.begin(), weights_row.end(), weights[i]);
+            std::fill(expected.begin() + i * n, expected.begin() + (i + 1) * n, biases[i]);
+            cblas_ssbmv1(CblasRowMajor,
+                         CblasLower,
+                         n,
+                         0,
+                         1.0,
+                         weights_row.data(),
+                         1,
+                         inputs.data() + i * n,
+                         1,
+                         1.0,
+                         expected.data() + i * n,
+                         1);
+        }
+
+        for (const auto& named : kernels) {
+            std::vector<float> actual(expected.size());
+            named.second->diagonal(weights.data(), inputs.data(), biases.data(), actual.data(), n, n, 0, m);
+            expectBitExact(expected, actual, named.first + " with " + std::to_string(n) + " columns");
+        }
+    }
+}
+
+// the runtime entry points take the sizes and the strides from the component, the outputs are padded
+TEST_F(GNAFloatRuntimeKernelsTest, affineTransformIsBitExact) {
+    const uint32_t m = 45, k = 29;
+    const std::vector<uint32_t> list = {44, 0, 7, 8, 9, 30, 2, 21, 22, 23, 24};
+    const auto weights = randomData(static_cast<size_t>(m) * k, 16);
+    const auto biases = randomData(m, 17);
+    const float padding = 42.f;
+
+    // less columns than lanes and more columns than lanes with a tail
+    for (uint32_t n : {5u, 19u}) {
+        const uint32_t ldc = n + 3;
+        const auto inputs = randomData(static_cast<size_t>(k) * n, 18);
+        for (bool subset : {false, true}) {
+            const uint32_t rows = subset ? static_cast<uint32_t>(list.size()) : m;
+            std::vector<float> expected(static_cast<size_t>(rows) * ldc, padding);
+            for (uint32_t l = 0; l < rows; l++) {
+                for (uint32_t j = 0; j < n; j++) {
+                    expected[l * ldc + j] = biases[subset ? list[l] : l];
+                }
+            }
+            if (subset) {
+                cblas_sgemm_subset(CblasRowMajor,
+                                   CblasNoTrans,
+                                   CblasNoTrans,
+                                   m,
+                                   n,
+                                   k,
+                                   1.0,
+                                   weights.data(),
+                                   k,
+                                   inputs.data(),
+                                   n,
+                                   1.0,
+                                   expected.data(),
+                                   ldc,
+                                   list.data(),
+                                   rows);
+            } else {
+                cblas_sgemm1(CblasRowMajor,
+                             CblasNoTrans,
+                             CblasNoTrans,
+                             m,
+                             n,
+                             k,
+                             1.0,
+                             weights.data(),
+                             k,
+                             inputs.data(),
+                             n,
+                             1.0,
+                             expected.data(),
+                             ldc);
+            }
+
+            std::vector<float> actual(expected.size(), padding);
+            intel_dnn_component_t component{};
+            component.operation = kDnnAffineOp;
+            component.num_bytes_per_input = sizeof(float);
+            component.num_rows_in = k;
+            component.num_columns_in = n;
+            component.num_rows_out = m;
+            component.num_columns_out = ldc;
+            component.op.affine.ptr_weights = const_cast<float*>(weights.data());
+            component.op.affine.ptr_biases = const_cast<float*>(biases.data());
+            component.ptr_inputs = const_cast<float*>(inputs.data());
+            component.ptr_outputs = actual.data();
+            FP::ApplyAffineTransform(&component,
+                                     subset ? const_cast<uint32_t*>(list.data()) : nullptr,
+                                     subset ? rows : 0);
+            expectBitExact(expected, actual, std::to_string(n) + " columns" + (subset ? " of the active list" : ""));
+        }
+    }
+}
+
+TEST_F(GNAFloatRuntimeKernelsTest, diagonalTransformIsBitExact) {
+    const uint32_t m = 37;
+    const auto weights = randomData(m, 19);
+    const auto biases = randomData(m, 20);
+    const float padding = 42.f;
+
+    for (uint32_t n : {3u, 21u}) {
+        const uint32_t ldc = n + 5;
+        const auto inputs = randomData(static_cast<size_t>(m) * n, 21);
+        std::vector<float> expected(static_cast<size_t>(m) * ldc, padding);
+        std::vector<float> weights_row(n);
+        for (uint32_t i = 0; i < m; i++) {
+            std::fill(weights_row.begin(), weights_row.end(), weights[i]);
+            std::fill(expected.begin() + i * ldc, expected.begin() + i * ldc + n, biases[i]);
+            cblas_ssbmv1(CblasRowMajor,
+                         CblasLower,
+                         n,
+                         0,
+                         1.0,
+                         weights_row.data(),
+                         1,
+                         inputs.data() + i * n,
+                         1,
+                         1.0,
+                         expected.data() + i * ldc,
+                         1);
+        }
+
+        std::vector<float> actual(expected.size(), padding);
+        intel_dnn_component_t component{};
+        component.operation = kDnnDiagonalOp;
+        component.num_bytes_per_input = sizeof(float);
+        component.num_rows_in = m;
+        component.num_columns_in = n;
+        component.num_rows_out = m;
+        component.num_columns_out = ldc;
+        component.op.affine.ptr_weights = const_cast<float*>(weights.data());
+        component.op.affine.ptr_biases = const_cast<float*>(biases.data());
+        component.ptr_inputs = const_cast<float*>(inputs.data());
+        component.ptr_outputs = actual.data();
+        FP::ApplyDiagonalTransform(&component);
+        expectBitExact(expected, actual, std::to_string(n) + " columns");
+    }
+}
+
+// compares the performance of the software emulation kernels with the reference ones
+TEST_F(GNAFloatRuntimeKernelsTest, DISABLED_benchmark) {
+    {
+        Convolution1D convolution(32, 48, 16, 16000);
+        std::vector<float> output(convolution.output_size);
+        convolution.component.ptr_outputs = output.data();
+        reportSpeedup("convolution 1D", [&](const SimdKernels* k) {
+            CNNFilter32(&convolution.component, k);
+        });
+    }
+    {
+        Convolution2D convolution(64, 64, 16, 32, 3, 1, 1);
+        std::vector<float> output(convolution.output_size);
+        convolution.component.ptr_outputs = output.data();
+        reportSpeedup("convolution 2D", [&](const SimdKernels* k) {
+            CNN2DFilter32(&convolution.component, k);
+        });
+    }
+    {
+        const uint32_t m = 1024, k = 1024, n = 8;
+        const auto weights = randomData(static_cast<size_t>(m) * k, 1);
+        const auto inputs = randomData(static_cast<size_t>(k) * n, 2);
+        const auto biases = randomData(m, 3);
+        std::vector<float> output(static_cast<size_t>(m) * n);
+        reportSpeedup("affine 1024x1024x8", [&](const SimdKernels* kernels) {
+            if (kernels == nullptr) {
+                for (uint32_t i = 0; i < m; i++) {
+                    std::fill(output.begin() + i * n, output.begin() + (i + 1) * n, biases[i]);
+                }
+                cblas_sgemm1(CblasRowMajor,
+                             CblasNoTrans,
+                             CblasNoTrans,
+                             m,
+                             n,
+                             k,
+                             1.0,
+                             weights.data(),
+                             k,
+                             inputs.data(),
+                             n,
+                             1.0,
+                             output.data(),
+                             n);
+                return;
+            }
+            parallel_ranges(m, static_cast<size_t>(n) * k, [&](size_t begin, size_t end) {
+                kernels->affine(weights.data(),
+                                inputs.data(),
+                                biases.data(),
+                                output.data(),
+                                nullptr,
+                                n,
+                                k,
+                                k,
+                                n,
+                                n,
+                                begin,
+                                end);
+            });
+        });
+    }
+    for (auto type : {kActRelu, kActTanh}) {
+        const uint32_t rows = 8, columns = 65536;
+        auto input = randomData(static_cast<size_t>(rows) * columns, 4);
+        std::vector<float> output(input.size());
+        intel_dnn_component_t component{};
+        component.num_rows_in = rows;
+        component.num_columns_in = columns;
+        component.orientation_in = kDnnNonInterleavedOrientation;
+        component.op.pwl.func_id = DnnActivation::fromType(type);
+        component.ptr_inputs = input.data();
+        component.ptr_outputs = output.data();
+        reportSpeedup(type == kActRelu ? "relu" : "tanh", [&](const SimdKernels* k) {
+            PwlApply32(&component, rows, k);
+        });
+    }
+}
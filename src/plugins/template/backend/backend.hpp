@@ -66,8 +66,9 @@ public:
 
     /// \brief Compiles a Function.
     /// \param func The function to compile
+    /// \param parallel_execution Allows to execute independent operations in parallel
     /// \returns compiled function or nullptr on failure
-    virtual std::shared_ptr<Executable> compile(std::shared_ptr<ov::Model> model) = 0;
+    virtual std::shared_ptr<Executable> compile(std::shared_ptr<ov::Model> model, bool parallel_execution = false) = 0;
 };
 
 }  // namespace runtime
@@ -26,6 +26,7 @@ ov::Tensor ov::runtime::interpreter::INTBackend::create_tensor(const element::Ty
 }
 
 std::shared_ptr<ov::runtime::Executable> ov::runtime::interpreter::INTBackend::compile(
-    std::shared_ptr<ov::Model> model) {
-    return std::make_shared<INTExecutable>(model);
+    std::shared_ptr<ov::Model> model,
+    bool parallel_execution) {
+    return std::make_shared<INTExecutable>(model, parallel_execution);
 }
@@ -4,11 +4,15 @@
 
 #include "int_executable.hpp"
 
+#include <algorithm>
 #include <cstring>
+#include <exception>
 #include <limits>
+#include <numeric>
 
 #include "evaluates_map.hpp"
 #include "openvino/core/except.hpp"
+#include "openvino/core/parallel.hpp"
 #include "openvino/core/shape_util.hpp"
 #include "openvino/op/parameter.hpp"
 #include "openvino/op/result.hpp"
@@ -18,35 +22,139 @@
 
 class TemporaryOverrideOutputs {
     std::shared_ptr<ov::Model> model;
-    std::unordered_map<std::shared_ptr<ov::descriptor::Tensor>, ov::PartialShape> orig_paramter_shapes_map;
+    std::vector<ov::PartialShape> orig_parameter_shapes;
 
 public:
-    TemporaryOverrideOutputs(std::shared_ptr<ov::Model>& model,
-                             const std::unordered_map<std::shared_ptr<ov::descriptor::Tensor>, ov::Tensor>& tensor_map)
-        : model(model) {
-        for (const auto& param : model->get_parameters()) {
-            auto output_tensor = param->output(0).get_tensor_ptr();
-            orig_paramter_shapes_map.insert({output_tensor, param->get_partial_shape()});
-            param->set_partial_shape(tensor_map.at(output_tensor).get_shape());
+    TemporaryOverrideOutputs(std::shared_ptr<ov::Model>& model, const std::vector<ov::Tensor>& inputs) : model(model) {
+        const auto& params = model->get_parameters();
+        for (size_t i = 0; i < params.size(); ++i) {
+            orig_parameter_shapes.push_back(params[i]->get_partial_shape());
+            params[i]->set_partial_shape(inputs[i].get_shape());
         }
         model->validate_nodes_and_infer_types();
     }
 
     ~TemporaryOverrideOutputs() {
-        for (const auto& param : model->get_parameters()) {
-            auto output_tensor = param->output(0).get_tensor_ptr();
-            param->set_partial_shape(orig_paramter_shapes_map.at(output_tensor));
+        const auto& params = model->get_parameters();
+        for (size_t i = 0; i < params.size(); ++i) {
+            params[i]->set_partial_shape(orig_parameter_shapes[i]);
         }
         model->validate_nodes_and_infer_types();
     }
 };
 
-ov::runtime::interpreter::INTExecutable::INTExecutable(const std::shared_ptr<ov::Model>& model) : m_is_compiled{true} {
+ov::runtime::interpreter::INTExecutable::INTExecutable(const std::shared_ptr<ov::Model>& model,
+                                                       bool parallel_execution)
+    : m_is_compiled{true} {
     m_model = model->clone();
     for (auto node : m_model->get_ordered_ops()) {
         m_nodes.push_back(node);
     }
     set_parameters_and_results(*m_model);
+
+    // Assign a slot to each tensor of the model, so that the call doesn't need to look up tensors by descriptors
+    std::unordered_map<const ov::descriptor::Tensor*, size_t> slots;
+    auto get_slot = [&slots](const ov::descriptor::Tensor& tensor) {
+        return slots.emplace(&tensor, slots.size()).first->second;
+    };
+    for (const auto& param : get_parameters()) {
+        m_parameter_slots.push_back(get_slot(param->output(0).get_tensor()));
+    }
+    std::unordered_map<const Node*, size_t> results_map;
+    for (size_t i = 0; i < get_results().size(); ++i) {
+        results_map.emplace(get_results()[i].get(), i);
+    }
+
+    // Stateful operations share the variable context, so they keep the order of the model
+    parallel_execution =
+        parallel_execution && std::none_of(m_nodes.begin(), m_nodes.end(), [](const std::shared_ptr<Node>& node) {
+            return std::dynamic_pointer_cast<ov::op::util::VariableExtension>(node) != nullptr;
+        });
+
+    // Level of the operation is the length of the longest path from the parameters,
+    // operations of the same level don't depend on each other
+    std::unordered_map<const Node*, size_t> node_levels;
+    std::vector<size_t> levels;
+    for (const auto& node : m_nodes) {
+        size_t level = 0;
+        for (const auto& input : node->inputs()) {
+            level = std::max(level, node_levels[input.get_source_output().get_node()] + 1);
+        }
+        for (const auto& dependency : node->get_control_dependencies()) {
+            level = std::max(level, node_levels[dependency.get()] + 1);
+        }
+        node_levels[node.get()] = level;
+        if (ov::op::util::is_parameter(node)) {
+            continue;
+        }
+
+        Step step;
+        step.node = node;
+        for (const auto& input : node->inputs()) {
+            step.inputs.push_back(get_slot(input.get_tensor()));
+        }
+        for (const auto& output : node->outputs()) {
+            step.outputs.push_back(get_slot(output.get_tensor()));
+        }
+        auto result = results_map.find(node.get());
+        if (result != results_map.end()) {
+            step.result = result->second;
+        }
+        m_steps.push_back(std::move(step));
+        levels.push_back(level);
+    }
+    m_slots_count = slots.size();
+
+    if (parallel_execution) {
+        // Stable sort keeps topological order of the steps
+        std::vector<size_t> order(m_steps.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [&levels](size_t lhs, size_t rhs) {
+            return levels[lhs] < levels[rhs];
+        });
+        std::vector<Step> steps;
+        steps.reserve(m_steps.size());
+        for (size_t i = 0; i < order.size(); ++i) {
+            steps.push_back(std::move(m_steps[order[i]]));
+            if (i == 0 || levels[order[i]] != levels[order[i - 1]]) {
+                m_groups.push_back({i, i + 1, {}});
+            } else {
+                m_groups.back().end = i + 1;
+            }
+        }
+        m_steps = std::move(steps);
+    } else {
+        for (size_t i = 0; i < m_steps.size(); ++i) {
+            m_groups.push_back({i, i + 1, {}});
+        }
+    }
+
+    // Intermediate tensors are released after the last group which uses them.
+    // Inputs and outputs of the model are owned by the caller, so they are never released.
+    std::vector<bool> releasable(m_slots_count, true);
+    for (auto slot : m_parameter_slots) {
+        releasable[slot] = false;
+    }
+    std::vector<size_t> last_use(m_slots_count, 0);
+    for (size_t group = 0; group < m_groups.size(); ++group) {
+        for (size_t i = m_groups[group].begin; i < m_groups[group].end; ++i) {
+            const auto& step = m_steps[i];
+            for (auto slot : step.inputs) {
+                last_use[slot] = group;
+            }
+            for (auto slot : step.outputs) {
+                last_use[slot] = group;
+                if (step.result != std::string::npos) {
+                    releasable[slot] = false;
+                }
+            }
+        }
+    }
+    for (size_t slot = 0; slot < m_slots_count; ++slot) {
+        if (releasable[slot]) {
+            m_groups[last_use[slot]].released.push_back(slot);
+        }
+    }
 }
 
 void ov::runtime::interpreter::INTExecutable::cancel() {
@@ -86,84 +194,160 @@ bool ov::runtime::interpreter::INTExecutable::call(std::vector<ov::Tensor>& outp
     }
 
     CHECK_TERMINATE()
-    // map function params -> ov::Tensor
-    std::unordered_map<std::shared_ptr<ov::descriptor::Tensor>, ov::Tensor> tensor_map;
-    size_t input_count = 0;
-    for (const auto& param : get_parameters()) {
-        for (size_t i = 0; i < param->get_output_size(); ++i) {
-            auto tensor = param->output(i).get_tensor_ptr();
-            tensor_map.insert({tensor, inputs[input_count++]});
-        }
-    }
+    std::vector<ov::Tensor> tensors(m_slots_count);
+    // Slots with tensors taken from the pool, only these tensors go back to the pool when they are released
+    std::vector<bool> pooled(m_slots_count, false);
 
-    std::unordered_map<std::shared_ptr<ov::descriptor::Tensor>, size_t> results_map;
-    // map function outputs -> ov::Tensor
-    for (size_t output_count = 0; output_count < get_results().size(); ++output_count) {
-        auto output = get_results()[output_count]->output(0).get_tensor_ptr();
-        if (!results_map.count(output))
-            results_map.emplace(output, output_count);
+    // Shapes are inferred again only if the inputs don't match the shapes of the model
+    bool override_shapes = false;
+    for (size_t i = 0; i < m_parameter_slots.size(); ++i) {
+        tensors[m_parameter_slots[i]] = inputs[i];
+        const auto& shape = get_parameters()[i]->get_partial_shape();
+        override_shapes = override_shapes || shape.is_dynamic() || shape.to_shape() != inputs[i].get_shape();
+    }
+    std::unique_ptr<TemporaryOverrideOutputs> overrider;
+    if (override_shapes) {
+        overrider.reset(new TemporaryOverrideOutputs(m_model, inputs));
     }
 
-    auto overrider = TemporaryOverrideOutputs(m_model, tensor_map);
-
-    // for each ordered op in the graph
-    for (const auto& op : m_nodes) {
+    std::vector<ov::TensorVector> op_inputs;
+    std::vector<ov::TensorVector> op_outputs;
+    for (const auto& group : m_groups) {
         CHECK_TERMINATE()
-        if (std::dynamic_pointer_cast<ov::op::v0::Parameter>(op)) {
-            continue;
-        }
-        // get op inputs from map
-        std::vector<ov::Tensor> op_inputs;
-        for (auto input : op->inputs()) {
-            auto tensor = input.get_tensor_ptr();
-            op_inputs.push_back(tensor_map.at(tensor));
-        }
-
-        // get op outputs from map or create
-        std::vector<ov::Tensor> op_outputs;
-        for (size_t i = 0; i < op->get_output_size(); ++i) {
-            auto tensor = op->output(i).get_tensor_ptr();
-            ov::Tensor host_tensor;
-            auto it = tensor_map.find(tensor);
-            auto output = op->output(i);
-            if (op::util::is_output(op) || it == tensor_map.end() || !it->second) {
-                OPENVINO_SUPPRESS_DEPRECATED_START
-                host_tensor = ov::Tensor(
-                    output.get_element_type(),
-                    output.get_partial_shape().is_dynamic() ? ov::util::make_dynamic_shape() : output.get_shape());
-                OPENVINO_SUPPRESS_DEPRECATED_END
-            } else {
-                host_tensor = it->second;
+        const size_t group_size = group.end - group.begin;
+        op_inputs.resize(std::max(op_inputs.size(), group_size));
+        op_outputs.resize(std::max(op_outputs.size(), group_size));
+
+        // get op inputs from slots and allocate outputs
+        for (size_t i = 0; i < group_size; ++i) {
+            const auto& step = m_steps[group.begin + i];
+            auto& step_inputs = op_inputs[i];
+            step_inputs.clear();
+            for (auto slot : step.inputs) {
+                step_inputs.push_back(tensors[slot]);
+            }
+            auto& step_outputs = op_outputs[i];
+            step_outputs.clear();
+            for (size_t j = 0; j < step.outputs.size(); ++j) {
+                const auto output = step.node->output(j);
+                const auto& type = output.get_element_type();
+                const auto& shape = output.get_partial_shape();
+                ov::Tensor host_tensor;
+                if (step.result != std::string::npos) {
+                    // Result writes directly to the output tensor if it is already allocated
+                    const auto& result_tensor = outputs[step.result];
+                    if (result_tensor && shape.is_static() && result_tensor.get_element_type() == type &&
+                        result_tensor.get_shape() == shape.to_shape()) {
+                        host_tensor = result_tensor;
+                    }
+                } else if (shape.is_static()) {
+                    host_tensor = allocate_tensor(type, shape.to_shape());
+                    pooled[step.outputs[j]] = true;
+                }
+                if (!host_tensor) {
+                    OPENVINO_SUPPRESS_DEPRECATED_START
+                    host_tensor =
+                        ov::Tensor(type, shape.is_dynamic() ? ov::util::make_dynamic_shape() : shape.to_shape());
+                    OPENVINO_SUPPRESS_DEPRECATED_END
+                }
+                tensors[step.outputs[j]] = host_tensor;
+                step_outputs.push_back(host_tensor);
             }
-            op_outputs.push_back(host_tensor);
         }
 
-        {
+        auto evaluate_step = [&](size_t i) {
+            const auto& op = m_steps[group.begin + i].node;
             PERF(op, collect_performance);
             // Call evaluate for cloned_node with static shapes
-            if (!op->evaluate(op_outputs, op_inputs, context)) {
+            if (!op->evaluate(op_outputs[i], op_inputs[i], context)) {
                 // TODO: extend evaluate map for the context
-                evaluate_node(op, op_outputs, op_inputs);
+                evaluate_node(op, op_outputs[i], op_inputs[i]);
+            }
+        };
+        if (group_size == 1) {
+            evaluate_step(0);
+        } else {
+            std::vector<std::exception_ptr> exceptions(group_size);
+            ov::parallel_for(group_size, [&](size_t i) {
+                try {
+                    evaluate_step(i);
+                } catch (...) {
+                    exceptions[i] = std::current_exception();
+                }
+            });
+            for (auto& exception : exceptions) {
+                if (exception)
+                    std::rethrow_exception(exception);
             }
         }
-        // Update tensors in tensor map
-        for (size_t i = 0; i < op->get_output_size(); ++i) {
-            auto tensor = op->output(i).get_tensor_ptr();
-            tensor_map.insert({tensor, op_outputs[i]});
-            if (op::util::is_output(op)) {
-                auto& output = outputs[results_map[tensor]];
-                if (!output || output.get_shape() != op_outputs[i].get_shape()) {
-                    outputs[results_map[tensor]] = op_outputs[i];
-                } else {
-                    op_outputs[i].copy_to(output);
+
+        // Update tensors in slots
+        for (size_t i = 0; i < group_size; ++i) {
+            const auto& step = m_steps[group.begin + i];
+            const auto& step_outputs = op_outputs[i];
+            bool replaced = false;
+            for (size_t j = 0; j < step.outputs.size(); ++j) {
+                const auto slot = step.outputs[j];
+                const auto& op_output = step_outputs[j];
+                if (pooled[slot]) {
+                    replaced = replaced || !op_output || op_output.data() != tensors[slot].data() ||
+                               op_output.get_shape() != step.node->get_output_shape(j);
+                } else if (step.node->get_output_partial_shape(j).is_dynamic()) {
+                    replaced = true;
+                }
+                tensors[slot] = op_output;
+                if (step.result != std::string::npos) {
+                    auto& output = outputs[step.result];
+                    if (!output || output.get_shape() != op_output.get_shape()) {
+                        output = op_output;
+                    } else if (output.data() != op_output.data()) {
+                        op_output.copy_to(output);
+                    }
+                }
+            }
+            // The operation has created its own outputs which may share the memory with other tensors of the
+            // operation, so these tensors are not reused during this call
+            if (replaced) {
+                for (auto slot : step.inputs) {
+                    pooled[slot] = false;
                 }
+                for (auto slot : step.outputs) {
+                    pooled[slot] = false;
+                }
+            }
+        }
+
+        for (auto slot : group.released) {
+            if (pooled[slot]) {
+                release_tensor(std::move(tensors[slot]));
             }
+            tensors[slot] = {};
         }
     }
 
+    // Shapes of the intermediate tensors depend on the inputs, so the pool is kept only for the static shapes
+    if (override_shapes) {
+        m_tensor_pool.clear();
+    }
+
     return true;
 }
 
+ov::Tensor ov::runtime::interpreter::INTExecutable::allocate_tensor(const ov::element::Type& type,
+                                                                    const ov::Shape& shape) {
+    auto it = m_tensor_pool.find({type, shape});
+    if (it == m_tensor_pool.end() || it->second.empty()) {
+        return ov::Tensor(type, shape);
+    }
+    auto tensor = std::move(it->second.back());
+    it->second.pop_back();
+    return tensor;
+}
+
+void ov::runtime::interpreter::INTExecutable::release_tensor(ov::Tensor&& tensor) {
+    m_tensor_pool[{tensor.get_element_type(), tensor.get_shape()}].push_back(std::move(tensor));
+}
+
 std::shared_ptr<ov::op::v0::Parameter> ov::runtime::interpreter::INTExecutable::get_parameter(size_t index) const {
     const ParameterVector& parameters = get_parameters();
     OPENVINO_ASSERT(index < parameters.size(), "create_tensor for input out of bounds");
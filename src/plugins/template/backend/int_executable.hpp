@@ -6,6 +6,7 @@
 
 #include <initializer_list>
 #include <iostream>
+#include <map>
 #include <memory>
 #include <sstream>
 #include <string>
@@ -26,7 +27,7 @@ class INTExecutable : public Executable {
     friend class INTBackend;
 
 public:
-    INTExecutable(const std::shared_ptr<ov::Model>& model);
+    INTExecutable(const std::shared_ptr<ov::Model>& model, bool parallel_execution = false);
 
     void cancel() override;
 
@@ -54,9 +55,35 @@ protected:
     bool evaluate_node(const std::shared_ptr<Node>& node,
                        ov::TensorVector& outputs,
                        const ov::TensorVector& inputs) const;
+    ov::Tensor allocate_tensor(const ov::element::Type& type, const ov::Shape& shape);
+    void release_tensor(ov::Tensor&& tensor);
+
+    // Operation of the model with its inputs and outputs resolved to tensor slots
+    struct Step {
+        std::shared_ptr<Node> node;
+        std::vector<size_t> inputs;
+        std::vector<size_t> outputs;
+        // Index of the model output produced by the step or npos
+        size_t result = std::string::npos;
+    };
+
+    // Range of steps which don't depend on each other
+    struct Group {
+        size_t begin;
+        size_t end;
+        // Slots which are not used after the group
+        std::vector<size_t> released;
+    };
+
     bool m_is_compiled = false;
     std::shared_ptr<ov::Model> m_model;
     std::vector<std::shared_ptr<Node>> m_nodes;
+    std::vector<Step> m_steps;
+    std::vector<Group> m_groups;
+    std::vector<size_t> m_parameter_slots;
+    size_t m_slots_count = 0;
+    // Intermediate tensors which are not used anymore, reused by the next steps and calls
+    std::map<std::pair<ov::element::Type_t, ov::Shape>, std::vector<ov::Tensor>> m_tensor_pool;
     std::atomic_bool m_cancel_execution{false};
     std::mutex m_mutex;
 
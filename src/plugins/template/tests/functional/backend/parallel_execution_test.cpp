@@ -0,0 +1,171 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "functional_test_utils/ov_plugin_cache.hpp"
+#include "openvino/opsets/opset11.hpp"
+#include "template/properties.hpp"
+
+namespace {
+
+// Replaces its output tensor by the input one, so the output shares the memory with the input
+class AliasInput : public ov::op::Op {
+public:
+    OPENVINO_OP("AliasInput");
+
+    AliasInput() = default;
+    explicit AliasInput(const ov::Output<ov::Node>& arg) : Op({arg}) {
+        constructor_validate_and_infer_types();
+    }
+
+    void validate_and_infer_types() override {
+        set_output_type(0, get_input_element_type(0), get_input_partial_shape(0));
+    }
+
+    std::shared_ptr<ov::Node> clone_with_new_inputs(const ov::OutputVector& new_args) const override {
+        return std::make_shared<AliasInput>(new_args.at(0));
+    }
+
+    bool has_evaluate() const override {
+        return true;
+    }
+
+    bool evaluate(ov::TensorVector& outputs, const ov::TensorVector& inputs) const override {
+        outputs[0] = inputs[0];
+        return true;
+    }
+};
+
+std::shared_ptr<ov::Model> make_branched_model(const ov::PartialShape& shape) {
+    auto data = std::make_shared<ov::opset11::Parameter>(ov::element::f32, shape);
+    auto relu = std::make_shared<ov::opset11::Relu>(data);
+    auto sigmoid = std::make_shared<ov::opset11::Sigmoid>(data);
+    auto abs = std::make_shared<ov::opset11::Abs>(data);
+    auto add = std::make_shared<ov::opset11::Add>(relu, sigmoid);
+    auto multiply = std::make_shared<ov::opset11::Multiply>(add, abs);
+    auto negative = std::make_shared<ov::opset11::Negative>(multiply);
+    auto concat = std::make_shared<ov::opset11::Concat>(ov::OutputVector{negative, relu, abs}, 0);
+    return std::make_shared<ov::Model>(ov::OutputVector{concat, add}, ov::ParameterVector{data});
+}
+
+std::vector<std::vector<float>> infer(ov::CompiledModel& compiled_model, const std::vector<float>& input) {
+    auto request = compiled_model.create_infer_request();
+    std::vector<std::vector<float>> results;
+    // Several inferences check that the reused buffers don't affect the results
+    for (size_t i = 0; i < 3; ++i) {
+        std::vector<float> data(input);
+        for (auto& value : data)
+            value *= static_cast<float>(i + 1);
+        request.set_input_tensor(ov::Tensor(ov::element::f32, ov::Shape{data.size()}, data.data()));
+        request.infer();
+        for (const auto& output : compiled_model.outputs()) {
+            auto tensor = request.get_tensor(output);
+            results.emplace_back(tensor.data<float>(), tensor.data<float>() + tensor.get_size());
+        }
+    }
+    return results;
+}
+
+// The output of Relu is aliased by AliasInput, so its buffer must not be reused by Multiply of the same shape.
+// Split has several outputs, and the shape of the NonZero output depends on the data.
+std::shared_ptr<ov::Model> make_aliasing_model(const ov::PartialShape& shape) {
+    auto data = std::make_shared<ov::opset11::Parameter>(ov::element::f32, shape);
+    auto relu = std::make_shared<ov::opset11::Relu>(data);
+    auto abs = std::make_shared<ov::opset11::Abs>(data);
+    auto alias = std::make_shared<AliasInput>(relu);
+    auto negative = std::make_shared<ov::opset11::Negative>(abs);
+    auto non_zero = std::make_shared<ov::opset11::NonZero>(relu, ov::element::i64);
+    auto multiply = std::make_shared<ov::opset11::Multiply>(negative, abs);
+    auto axis = ov::opset11::Constant::create(ov::element::i64, ov::Shape{}, {0});
+    auto split = std::make_shared<ov::opset11::Split>(alias, axis, 2);
+    auto convert = std::make_shared<ov::opset11::Convert>(non_zero, ov::element::f32);
+    auto add = std::make_shared<ov::opset11::Add>(split->output(0), split->output(1));
+    return std::make_shared<ov::Model>(ov::OutputVector{alias, multiply, add, split->output(1), convert},
+                                       ov::ParameterVector{data});
+}
+
+void compare_with_reference(ov::CompiledModel& compiled_model,
+                            const std::shared_ptr<ov::Model>& model,
+                            const std::vector<float>& input,
+                            bool preallocate_outputs) {
+    auto request = compiled_model.create_infer_request();
+    // Several inferences check that the reused buffers don't affect the results
+    for (size_t i = 0; i < 3; ++i) {
+        std::vector<float> data(input);
+        for (auto& value : data)
+            value *= (i % 2 ? -1.f : 1.f) * static_cast<float>(i + 1);
+        ov::Tensor input_tensor(ov::element::f32, ov::Shape{data.size()}, data.data());
+
+        std::vector<ov::Tensor> preallocated(compiled_model.outputs().size());
+        for (size_t j = 0; preallocate_outputs && j < preallocated.size(); ++j) {
+            const auto& output = compiled_model.output(j);
+            if (output.get_partial_shape().is_static()) {
+                preallocated[j] = ov::Tensor(output.get_element_type(), output.get_shape());
+                request.set_tensor(output, preallocated[j]);
+            }
+        }
+        request.set_input_tensor(input_tensor);
+        request.infer();
+
+        ov::TensorVector expected(model->get_results().size());
+        ASSERT_TRUE(model->evaluate(expected, ov::TensorVector{input_tensor}));
+        for (size_t j = 0; j < expected.size(); ++j) {
+            auto tensor = request.get_tensor(compiled_model.output(j));
+            if (preallocated[j]) {
+                ASSERT_EQ(tensor.data(), preallocated[j].data()) << "output " << j << ", inference " << i;
+            }
+            ASSERT_EQ(tensor.get_element_type(), expected[j].get_element_type());
+            ASSERT_EQ(tensor.get_shape(), expected[j].get_shape()) << "output " << j << ", inference " << i;
+            ASSERT_EQ(std::memcmp(tensor.data(), expected[j].data(), tensor.get_byte_size()), 0)
+                << "output " << j << ", inference " << i;
+        }
+    }
+}
+
+}  // namespace
+
+TEST(ParallelExecutionTests, TestTemplatePluginProperty) {
+    auto core = ov::test::utils::PluginCache::get().core("TEMPLATE");
+    auto compiled_model = core->compile_model(make_branched_model(ov::Shape{5}),
+                                              "TEMPLATE",
+                                              ov::template_plugin::parallel_execution(true));
+    ASSERT_TRUE(compiled_model.get_property(ov::template_plugin::parallel_execution));
+    ASSERT_FALSE(core->get_property("TEMPLATE", ov::template_plugin::parallel_execution));
+}
+
+TEST(ParallelExecutionTests, ResultsMatchSequentialExecution) {
+    const std::vector<float> input{-2.f, -0.5f, 0.f, 1.5f, 3.f};
+    auto core = ov::test::utils::PluginCache::get().core("TEMPLATE");
+    for (const auto& shape : {ov::PartialShape{5}, ov::PartialShape::dynamic(1)}) {
+        auto sequential = core->compile_model(make_branched_model(shape), "TEMPLATE");
+        auto parallel =
+            core->compile_model(make_branched_model(shape), "TEMPLATE", ov::template_plugin::parallel_execution(true));
+        const auto expected = infer(sequential, input);
+        ASSERT_EQ(expected, infer(parallel, input));
+        ASSERT_EQ(expected, infer(sequential, input));
+    }
+}
+
+TEST(ParallelExecutionTests, AliasedAndDataDependentOutputs) {
+    const std::vector<float> input{-2.f, -0.5f, 0.f, 1.5f, 3.f, 0.25f};
+    auto core = ov::test::utils::PluginCache::get().core("TEMPLATE");
+    for (const auto& shape : {ov::PartialShape{6}, ov::PartialShape::dynamic(1)}) {
+        for (bool parallel_execution : {false, true}) {
+            auto model = make_aliasing_model(shape);
+            auto compiled_model =
+                core->compile_model(model, "TEMPLATE", ov::template_plugin::parallel_execution(parallel_execution));
+            for (bool preallocate_outputs : {false, true}) {
+                SCOPED_TRACE("shape " + shape.to_string() + ", parallel " + std::to_string(parallel_execution) +
+                             ", preallocated " + std::to_string(preallocate_outputs));
+                compare_with_reference(compiled_model, model, input, preallocate_outputs);
+            }
+        }
+    }
+}